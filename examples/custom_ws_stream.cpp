@@ -4,30 +4,16 @@
 
 struct SomeFunctor
 {
-    Json::CharReaderBuilder charbuilder;
-    Json::CharReader* charreader;
-    std::string parse_errors;
     std::string msg_buffer;
-    Json::Value stream_msg;
 
     SomeFunctor()
-        : msg_buffer{ "" }, parse_errors{ }, charreader{ charbuilder.newCharReader() }
+        : msg_buffer{ "" }
     {}
 
 
-    SomeFunctor operator()(const std::string& response)
+    void operator()(const AggTradeEvent& trade) // decoded from the "data" payload of the combined stream
     {
-        this->stream_msg.clear();
-        this->parse_errors.clear();
-
-        this->charreader->parse(response.c_str(),
-            response.c_str() + response.size(),
-            &this->stream_msg,
-            &parse_errors);
-
-        std::cout << this->stream_msg;
-
-        return *this;
+        std::cout << trade.symbol << "  price: " << trade.price << "  quantity: " << trade.quantity << "\n";
     }
 };
 
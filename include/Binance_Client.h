@@ -13,6 +13,7 @@
 #include <curl/curl.h>
 #include <openssl/hmac.h>
 #include <openssl/sha.h>
+#include <openssl/evp.h>
 
 #include <simdjson.h>
 #include <simdjson/dom/array.h>
@@ -20,12 +21,25 @@
 #include <simdjson/error.h>
 
 // STL
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cmath>
 #include <chrono>
+#include <charconv>
+#include <type_traits>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <future>
+#include <functional>
+#include <memory>
 
 
 namespace beast = boost::beast;
@@ -36,14 +50,24 @@ using tcp = boost::asio::ip::tcp;
 
 // this library
 #include "Client_Exceptions.h"
+#include "Decimal.h"
+#include "Latency_Stats.h"
 #include "REST_Client.h"
 #include "WS_Client.h"
+#include "Stream_Events.h"
 #include "Exchange_Client.h"
+#include "Order_Book.h"
+#include "Exchange_Info.h"
+#include "Exchange_Clock.h"
 
 // inl files
+#include "inl_files/Decimal.inl"
 #include "inl_files/Websocket_methods.inl"
 #include "inl_files/Client_methods.inl"
 #include "inl_files/REST_methods.inl"
+#include "inl_files/Order_Book.inl"
+#include "inl_files/Exchange_Info.inl"
+#include "inl_files/Exchange_Clock.inl"
 
 
 
@@ -41,6 +41,12 @@ public:
 	BadSetupHeadersREST();
 };
 
+class RateLimitExceeded : public ClientException // for requests rejected by the client-side rate limiter
+{
+public:
+	RateLimitExceeded();
+};
+
 // WS Client Exceptions
 
 class BadStreamOpenWS : public ClientException
@@ -87,6 +93,14 @@ public:
 	MissingEndpoint();
 };
 
+class OrderRejected : public ClientException // for orders failing a filter of 'OrderValidator' - not sent
+{
+public:
+	explicit OrderRejected(const std::string& rejection_reason);
+
+	const std::string reason; // i.e: price_filter, lot_size, min_notional, percent_price, unknown_symbol, symbol_not_trading, invalid_batch
+};
+
 // Custom Client Exception
 
 class CustomException : public ClientException
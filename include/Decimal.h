@@ -0,0 +1,50 @@
+#ifndef DECIMAL_H
+#define DECIMAL_H
+
+
+class Decimal
+	// a fixed-point decimal - an integer number of units of 10^-scale, up to 18 digits.
+	// comparisons are exact (also between scales), and conversions from and to strings do not go through double.
+	// the scale of the prices and quantities of a symbol is derived from its tickSize and stepSize ('scale_of()')
+{
+private:
+	int64_t _units;
+	unsigned char _scale;
+
+	static const int64_t _POWERS_OF_10[19];
+	static int _compare(const Decimal& first, const Decimal& second);
+
+public:
+	static const unsigned int MAX_SCALE = 18;
+	static const size_t MAX_FORMAT_SIZE = 24; // sign, 18 digits, point and leading zeros
+
+	Decimal();
+	Decimal(const int64_t units, const unsigned int scale);
+
+	static bool parse(std::string_view text, Decimal& value);
+	static bool parse(std::string_view text, const unsigned int scale, Decimal& value);
+	static Decimal from_double(const double value, const unsigned int scale);
+	static bool from_double(const double value, const unsigned int scale, Decimal& decimal);
+	static unsigned int scale_of(std::string_view step);
+
+	int64_t units() const;
+	unsigned int scale() const;
+	bool is_zero() const;
+	Decimal rescale(const unsigned int scale) const;
+	bool rescale(const unsigned int scale, Decimal& value) const;
+	double to_double() const;
+
+	size_t format(char* buffer) const;
+	std::string to_string() const;
+
+	friend bool operator==(const Decimal& first, const Decimal& second);
+	friend bool operator!=(const Decimal& first, const Decimal& second);
+	friend bool operator<(const Decimal& first, const Decimal& second);
+	friend bool operator>(const Decimal& first, const Decimal& second);
+	friend bool operator<=(const Decimal& first, const Decimal& second);
+	friend bool operator>=(const Decimal& first, const Decimal& second);
+	friend std::ostream& operator<<(std::ostream& out, const Decimal& value);
+};
+
+
+#endif
@@ -4,13 +4,52 @@
 unsigned long long local_timestamp();
 char binary_to_hex_digit(unsigned a);
 std::string binary_to_hex(unsigned char const* binary, unsigned binary_len);
+void binary_to_hex(unsigned char const* binary, unsigned binary_len, char* hex_buffer);
 std::string HMACsha256(std::string const& message, std::string const& key);
+void url_encode(std::string_view text, std::string& encoded);
+void url_decode(std::string_view text, std::string& decoded);
+std::string_view versioned_endpoint(char* buffer, const size_t buffer_size, std::string_view prefix, const unsigned int version, std::string_view suffix);
+
+class OrderValidator;
+class ExchangeClock;
+
+
+class HMACSigner
+	// HMAC sha256 with the key schedule computed once - the keyed states are copied for each signature
+{
+private:
+	EVP_MD_CTX* _inner_ctx; // sha256 state after hashing (key ^ ipad)
+	EVP_MD_CTX* _outer_ctx; // sha256 state after hashing (key ^ opad)
+
+public:
+	static const unsigned int SIGNATURE_SIZE = 64; // hex characters
+
+	explicit HMACSigner(const std::string& secret);
+	HMACSigner(const HMACSigner& signer, std::string_view message_prefix);
+	HMACSigner(HMACSigner&& signer) noexcept;
+
+	HMACSigner(const HMACSigner&) = delete;
+	HMACSigner& operator=(const HMACSigner&) = delete;
+	HMACSigner& operator=(HMACSigner&&) = delete;
+
+	void sign(std::string_view message, char* signature_buffer) const;
+	std::string sign(std::string_view message) const;
+
+	~HMACSigner();
+};
+
 
 
 
 struct Params
-	// Params will be stored in a map of <str, str> and parsed by the query generator.
+	// Params are stored as key / value slots in insertion order, and parsed by the query generator.
+	// flushed slots keep their buffers, so refilling the same keys does not allocate memory.
 {
+	struct Param
+	{
+		std::string key;
+		std::string value; // encoded
+	};
 
 	Params();
 	explicit Params(Params& param_obj);
@@ -20,7 +59,6 @@ struct Params
 	Params& operator=(const Params& params_obj);
 	Params& operator=(Params&& params_obj);
 
-	std::unordered_map<std::string, std::string> param_map;
 	bool default_recv;
 	unsigned int default_recv_amt;
 
@@ -28,15 +66,107 @@ struct Params
 	void set_param(const std::string& key, const PT& value);
 	template <typename PT>
 	void set_param(const std::string& key, PT&& value);
+	void set_param(const std::string& key, const double value, const unsigned int precision);
 
 	bool delete_param(const std::string& key);
+	const std::string* get_param(const std::string& key) const;
 
 	void set_recv(const bool& set_always, const unsigned int& recv_val = 0);
 
 	void flush_params();
 	bool empty() const;
+	size_t size() const;
 
+	const Param* begin() const;
+	const Param* end() const;
+
+private:
+	std::vector<Param> _params; // slots [0, _size) are set, the rest are kept for reuse
+	size_t _size;
 
+	std::string& _value_slot(const std::string& key);
+
+	template <typename PT>
+	static void _encode(std::string& encoded_value, const PT& value);
+};
+
+
+class QueryBuilder
+	// builds the full path of a request (base, endpoint, query, signature) into one buffer, reused between requests
+{
+private:
+	std::string _buffer;
+	size_t _query_start; // position of the '?', npos if no query
+
+public:
+	explicit QueryBuilder(const size_t reserve_size = 1024);
+
+	void reset(std::string_view base, std::string_view endpoint);
+	void append_param(std::string_view key, std::string_view value);
+	void append_params(const Params* params_ptr);
+	void append_timestamp(const unsigned long long timestamp);
+	void sign(const HMACSigner& signer);
+
+	std::string_view query() const; // including the '?', empty if no params
+	const std::string& str() const;
+};
+
+
+class OrderTemplate
+	// a new order request with its static params (symbol, side, type...) serialized and hashed once
+	// each send only appends price, quantity, client order id and timestamp, then signs
+{
+private:
+	RestSession* _rest_client; // not owned - the template must not outlive its client
+	std::string _path_prefix; // base + endpoint + '?' + static query
+	size_t _query_start; // position of the static query in the prefix, after the '?'
+	HMACSigner _signer; // keyed, with the static query already hashed
+	unsigned int _price_precision;
+	unsigned int _quantity_precision;
+	const ExchangeClock* _clock; // not owned, null for the system clock
+
+	static std::string _serialize_prefix(std::string_view order_path, const Params& static_params);
+
+public:
+	OrderTemplate(RestSession* rest_client, const HMACSigner& signer, std::string_view order_path, const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision, const ExchangeClock* clock = nullptr);
+
+	RestResponse send(std::string_view price, std::string_view quantity, std::string_view client_order_id = {}) const;
+	RestResponse send(const double price, const double quantity, std::string_view client_order_id = {}) const;
+	RestResponse send(const Decimal& price, const Decimal& quantity, std::string_view client_order_id = {}) const;
+
+	std::string_view static_query() const;
+};
+
+
+struct BatchOrderResult
+	// the result of one order of a batch (see 'FuturesClient::batch_new_orders()')
+{
+	bool placed; // accepted by the exchange
+	int64_t code; // error code of the exchange, 0 if placed or not sent
+	std::string error; // msg of the exchange, 'order_rejected_' + reason if rejected by the validator, or the error of the request of its chunk
+	simdjson::dom::element order; // the order (or error) returned by the exchange, null if not sent - valid while its BatchResponse lives
+};
+
+
+class BatchResponse
+	// the results of a batch of orders, in the order of the input - holds the responses of the chunks
+{
+private:
+	std::vector<RestResponse> _responses; // one per chunk
+	std::vector<BatchOrderResult> _results;
+
+public:
+	explicit BatchResponse(const size_t order_count);
+
+	BatchResponse(BatchResponse&&) noexcept = default;
+	BatchResponse& operator=(BatchResponse&&) noexcept = default;
+
+	void add_response(RestResponse&& response, const size_t* order_indices, const size_t order_count);
+	void set_error(const size_t order_index, std::string error);
+
+	const BatchOrderResult& operator[](const size_t order_index) const;
+	size_t size() const;
+	size_t placed_count() const;
 };
 
 
@@ -49,6 +179,9 @@ private:
 protected:
 	std::string _api_key;
 	std::string _api_secret;
+	HMACSigner* _signer = nullptr; // keyed with _api_secret, null for public clients
+	OrderValidator* _order_validator = nullptr; // not owned, null for no validation
+	const ExchangeClock* _clock = nullptr; // not owned, null for the system clock
 
 
 public:
@@ -59,10 +192,19 @@ public:
 	unsigned int refresh_listenkey_interval;
 
 	std::string _generate_query(const Params* params_ptr, const bool& sign_query = 0) const;
+	const std::string& _generate_path(std::string_view base, std::string_view endpoint, const Params* params_ptr, const bool& sign_query = 0) const;
+	RestRequest _build_request(const RestRequestType request_type, std::string_view base, std::string_view endpoint, const Params* params_ptr, const bool& sign_query = 0) const;
 	void close_stream(const std::string& stream_name);
 	bool is_stream_open(const std::string& stream_name);
 	std::vector<std::string> get_open_streams();
 	void ws_auto_reconnect(const bool reconnect);
+	void ws_set_context_pool(WebsocketContextPool* context_pool);
+	void ws_set_receive_buffer(const size_t reserve, const size_t max_capacity);
+	StreamConnection* ws_open_connection();
+	void ws_set_latency_stats(const bool state);
+	std::shared_ptr<const StreamLatency> ws_latency_stats(const std::string& stream_name) const;
+	std::string ws_latency_report() const;
+	void ws_reset_latency_stats();
 	void set_refresh_key_interval(const unsigned int val);
 	void set_max_reconnect_count(const unsigned int val);
 
@@ -74,28 +216,28 @@ public:
 
 	bool ping_client();
 	unsigned long long exchange_time();
-	simdjson::dom::element exchange_info();
-	simdjson::dom::element order_book(const Params* params_ptr);
-	simdjson::dom::element public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element public_trades_historical(const Params* params_ptr);
-	simdjson::dom::element public_trades_agg(const Params* params_ptr);
-	simdjson::dom::element klines(const Params* params_ptr);
-	simdjson::dom::element daily_ticker_stats(const Params* params_ptr = nullptr);
-	simdjson::dom::element get_ticker(const Params* params_ptr = nullptr);
-	simdjson::dom::element get_order_book_ticker(const Params* params_ptr = nullptr);
+	RestResponse exchange_info();
+	RestResponse order_book(const Params* params_ptr);
+	RestResponse public_trades_recent(const Params* params_ptr);
+	RestResponse public_trades_historical(const Params* params_ptr);
+	RestResponse public_trades_agg(const Params* params_ptr);
+	RestResponse klines(const Params* params_ptr);
+	RestResponse daily_ticker_stats(const Params* params_ptr = nullptr);
+	RestResponse get_ticker(const Params* params_ptr = nullptr);
+	RestResponse get_order_book_ticker(const Params* params_ptr = nullptr);
 
 
 	// Trading endpoints
 
-	simdjson::dom::element test_new_order(const Params* params_ptr);
-	simdjson::dom::element new_order(const Params* params_ptr);
-	simdjson::dom::element cancel_order(const Params* params_ptr);
-	simdjson::dom::element cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element query_order(const Params* params_ptr);
-	simdjson::dom::element open_orders(const Params* params_ptr = nullptr);
-	simdjson::dom::element all_orders(const Params* params_ptr);
-	simdjson::dom::element account_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element account_trades_list(const Params* params_ptr);
+	RestResponse test_new_order(const Params* params_ptr);
+	RestResponse new_order(const Params* params_ptr);
+	RestResponse cancel_order(const Params* params_ptr);
+	RestResponse cancel_all_orders(const Params* params_ptr);
+	RestResponse query_order(const Params* params_ptr);
+	RestResponse open_orders(const Params* params_ptr = nullptr);
+	RestResponse all_orders(const Params* params_ptr);
+	RestResponse account_info(const Params* params_ptr = nullptr);
+	RestResponse account_trades_list(const Params* params_ptr);
 
 	// WS Streams
 
@@ -136,8 +278,8 @@ public:
 	unsigned int stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key = 0);
 
 	std::string get_listen_key();
-	simdjson::dom::element ping_listen_key(const std::string& listen_key = ""); // only spot requires key
-	simdjson::dom::element revoke_listen_key(const std::string& listen_key = ""); // only spot requires key
+	RestResponse ping_listen_key(const std::string& listen_key = ""); // only spot requires key
+	RestResponse revoke_listen_key(const std::string& listen_key = ""); // only spot requires key
 
 
 	// Library methods
@@ -148,9 +290,18 @@ public:
 
 	// ----------------------end CRTP methods
 
-	bool init_rest_session();
+	bool init_rest_session(const unsigned int warm_connections = 1);
+	void warm_rest_session(const unsigned int connections);
 	bool set_headers(RestSession* rest_client);
 	void rest_set_verbose(const bool& state);
+	void rest_set_max_connections(const unsigned int max_connections);
+	bool rest_set_http2(const bool state);
+	void rest_set_rate_limit(const RateLimitPolicy policy, const unsigned int weight_per_minute = 1200, const unsigned int orders_per_10s = 50);
+	void rest_set_order_validator(OrderValidator* order_validator);
+	void rest_set_clock(const ExchangeClock* clock);
+	std::vector<EndpointSnapshot> rest_stats() const;
+	std::string rest_stats_report() const;
+	void rest_reset_stats();
 
 	// Global requests (wallet, account etc)
 
@@ -162,17 +313,17 @@ public:
 		explicit Wallet(const Client<T>& client);
 		~Wallet();
 
-		simdjson::dom::element get_all_coins(const Params* params_ptr = nullptr);
-		simdjson::dom::element daily_snapshot(const Params* params_ptr);
-		simdjson::dom::element fast_withdraw_switch(const bool& state);
-		simdjson::dom::element withdraw_balances(const Params* params_ptr);
-		simdjson::dom::element deposit_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element withdraw_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element deposit_address(const Params* params_ptr);
-		simdjson::dom::element dust_transfer(const Params* params_ptr);
-		simdjson::dom::element asset_dividend_records(const Params* params_ptr = nullptr);
-		simdjson::dom::element make_user_transfer_universal(const Params* params_ptr);
-		simdjson::dom::element query_user_transfer_universal(const Params* params_ptr);
+		RestResponse get_all_coins(const Params* params_ptr = nullptr);
+		RestResponse daily_snapshot(const Params* params_ptr);
+		RestResponse fast_withdraw_switch(const bool& state);
+		RestResponse withdraw_balances(const Params* params_ptr);
+		RestResponse deposit_history(const Params* params_ptr = nullptr);
+		RestResponse withdraw_history(const Params* params_ptr = nullptr);
+		RestResponse deposit_address(const Params* params_ptr);
+		RestResponse dust_transfer(const Params* params_ptr);
+		RestResponse asset_dividend_records(const Params* params_ptr = nullptr);
+		RestResponse make_user_transfer_universal(const Params* params_ptr);
+		RestResponse query_user_transfer_universal(const Params* params_ptr);
 
 	};
 
@@ -183,24 +334,24 @@ public:
 		explicit FuturesWallet(const Client<T>& client);
 		~FuturesWallet();
 
-		simdjson::dom::element futures_transfer(const Params* params_ptr);
-		simdjson::dom::element futures_transfer_history(const Params* params_ptr);
-		simdjson::dom::element collateral_borrow(const Params* params_ptr);
-		simdjson::dom::element collateral_borrow_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element collateral_cross_repay(const Params* params_ptr);
-		simdjson::dom::element collateral_repay_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element collateral_wallet(const Params* params_ptr = nullptr, const unsigned int = 1);
-		simdjson::dom::element collateral_info(const Params* params_ptr = nullptr, const unsigned int = 1);
-		simdjson::dom::element collateral_adjust_calc_rate(const Params* params_ptr, const unsigned int = 1);
-		simdjson::dom::element collateral_adjust_get_max(const Params* params_ptr, const unsigned int = 1);
-		simdjson::dom::element collateral_adjust(const Params* params_ptr, const unsigned int = 1);
-		simdjson::dom::element collateral_adjust_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element collateral_liquidation_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element collateral_check_repay_limit(const Params* params_ptr);
-		simdjson::dom::element collateral_get_repay_quote(const Params* params_ptr);
-		simdjson::dom::element collateral_repay(const Params* params_ptr);
-		simdjson::dom::element collateral_repay_result(const Params* params_ptr);
-		simdjson::dom::element collateral_cross_interest_history(const Params* params_ptr);
+		RestResponse futures_transfer(const Params* params_ptr);
+		RestResponse futures_transfer_history(const Params* params_ptr);
+		RestResponse collateral_borrow(const Params* params_ptr);
+		RestResponse collateral_borrow_history(const Params* params_ptr = nullptr);
+		RestResponse collateral_cross_repay(const Params* params_ptr);
+		RestResponse collateral_repay_history(const Params* params_ptr = nullptr);
+		RestResponse collateral_wallet(const Params* params_ptr = nullptr, const unsigned int = 1);
+		RestResponse collateral_info(const Params* params_ptr = nullptr, const unsigned int = 1);
+		RestResponse collateral_adjust_calc_rate(const Params* params_ptr, const unsigned int = 1);
+		RestResponse collateral_adjust_get_max(const Params* params_ptr, const unsigned int = 1);
+		RestResponse collateral_adjust(const Params* params_ptr, const unsigned int = 1);
+		RestResponse collateral_adjust_history(const Params* params_ptr = nullptr);
+		RestResponse collateral_liquidation_history(const Params* params_ptr = nullptr);
+		RestResponse collateral_check_repay_limit(const Params* params_ptr);
+		RestResponse collateral_get_repay_quote(const Params* params_ptr);
+		RestResponse collateral_repay(const Params* params_ptr);
+		RestResponse collateral_repay_result(const Params* params_ptr);
+		RestResponse collateral_cross_interest_history(const Params* params_ptr);
 
 	};
 
@@ -211,41 +362,41 @@ public:
 		explicit SubAccount(const Client<T>& client);
 		~SubAccount();
 
-		simdjson::dom::element create_virtual_subaccount(const Params* params_ptr);
-		simdjson::dom::element query_subaccount_list_sapi(const Params* params_ptr = nullptr);
+		RestResponse create_virtual_subaccount(const Params* params_ptr);
+		RestResponse query_subaccount_list_sapi(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element transfer_spot_subaccount_history(const Params* params_ptr = nullptr);
+		RestResponse transfer_spot_subaccount_history(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element futures_transfer_master_history(const Params* params_ptr);
-		simdjson::dom::element futures_transfer_master_to_subaccount(const Params* params_ptr);
+		RestResponse futures_transfer_master_history(const Params* params_ptr);
+		RestResponse futures_transfer_master_to_subaccount(const Params* params_ptr);
 
-		simdjson::dom::element get_subaccount_balances_summary(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_deposit_address(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_deposit_history(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_future_margin_status(const Params* params_ptr = nullptr);
+		RestResponse get_subaccount_balances_summary(const Params* params_ptr);
+		RestResponse get_subaccount_deposit_address(const Params* params_ptr);
+		RestResponse get_subaccount_deposit_history(const Params* params_ptr);
+		RestResponse get_subaccount_future_margin_status(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element enable_subaccount_margin(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_margin_status(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_margin_summary(const Params* params_ptr = nullptr);
+		RestResponse enable_subaccount_margin(const Params* params_ptr);
+		RestResponse get_subaccount_margin_status(const Params* params_ptr);
+		RestResponse get_subaccount_margin_summary(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element enable_subaccount_futures(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_futures_status(const Params* params_ptr);
-		simdjson::dom::element get_subaccount_futures_summary(const Params* params_ptr = nullptr);
-		simdjson::dom::element get_subaccount_futures_positionrisk(const Params* params_ptr);
+		RestResponse enable_subaccount_futures(const Params* params_ptr);
+		RestResponse get_subaccount_futures_status(const Params* params_ptr);
+		RestResponse get_subaccount_futures_summary(const Params* params_ptr = nullptr);
+		RestResponse get_subaccount_futures_positionrisk(const Params* params_ptr);
 
-		simdjson::dom::element transfer_to_subaccount_futures(const Params* params_ptr);
-		simdjson::dom::element transfer_to_subaccount_margin(const Params* params_ptr);
-		simdjson::dom::element transfer_subaccount_to_subaccount(const Params* params_ptr);
-		simdjson::dom::element transfer_subaccount_to_master(const Params* params_ptr);
-		simdjson::dom::element transfer_subaccount_history(const Params* params_ptr = nullptr);
+		RestResponse transfer_to_subaccount_futures(const Params* params_ptr);
+		RestResponse transfer_to_subaccount_margin(const Params* params_ptr);
+		RestResponse transfer_subaccount_to_subaccount(const Params* params_ptr);
+		RestResponse transfer_subaccount_to_master(const Params* params_ptr);
+		RestResponse transfer_subaccount_history(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element make_universal_transfer(const Params* params_ptr);
-		simdjson::dom::element get_universal_transfer_history(const Params* params_ptr = nullptr);
+		RestResponse make_universal_transfer(const Params* params_ptr);
+		RestResponse get_universal_transfer_history(const Params* params_ptr = nullptr);
 
-		simdjson::dom::element get_details_subaccount_futures(const Params* params_ptr);
-		simdjson::dom::element get_summary_subaccount_futures(const Params* params_ptr);
-		simdjson::dom::element get_positionrisk_subaccount_futures(const Params* params_ptr);
-		simdjson::dom::element enable_leverage_token_subaccount(const Params* params_ptr);
+		RestResponse get_details_subaccount_futures(const Params* params_ptr);
+		RestResponse get_summary_subaccount_futures(const Params* params_ptr);
+		RestResponse get_positionrisk_subaccount_futures(const Params* params_ptr);
+		RestResponse enable_leverage_token_subaccount(const Params* params_ptr);
 
 	};
 
@@ -256,47 +407,47 @@ public:
 		explicit MarginAccount(const Client<T>& client);
 		~MarginAccount();
 
-		simdjson::dom::element margin_transfer(const Params* params_ptr);
-		simdjson::dom::element margin_borrow(const Params* params_ptr);
-		simdjson::dom::element margin_repay(const Params* params_ptr);
-		simdjson::dom::element margin_asset_query(const Params* params_ptr);
-		simdjson::dom::element margin_pair_query(const Params* params_ptr);
-		simdjson::dom::element margin_all_assets_query();
-		simdjson::dom::element margin_all_pairs_query();
-		simdjson::dom::element margin_price_index(const Params* params_ptr);
-		simdjson::dom::element margin_new_order(const Params* params_ptr);
-		simdjson::dom::element margin_cancel_order(const Params* params_ptr);
-		simdjson::dom::element margin_cancel_all_orders(const Params* params_ptr);
-		simdjson::dom::element margin_transfer_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_loan_record(const Params* params_ptr);
-		simdjson::dom::element margin_repay_record(const Params* params_ptr);
-		simdjson::dom::element margin_interest_history(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_liquidations_record(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_account_info(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_account_order(const Params* params_ptr);
-		simdjson::dom::element margin_account_open_orders(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_account_all_orders(const Params* params_ptr);
-		simdjson::dom::element margin_account_trades_list(const Params* params_ptr);
-		simdjson::dom::element margin_max_borrow(const Params* params_ptr);
-		simdjson::dom::element margin_max_transfer(const Params* params_ptr);
-		simdjson::dom::element margin_isolated_margin_transfer(const Params* params_ptr);
-		simdjson::dom::element margin_isolated_margin_transfer_history(const Params* params_ptr);
-		simdjson::dom::element margin_isolated_margin_account_info(const Params* params_ptr = nullptr);
-		simdjson::dom::element margin_isolated_margin_symbol(const Params* params_ptr);
-		simdjson::dom::element margin_isolated_margin_symbol_all(const Params* params_ptr = nullptr);
-		simdjson::dom::element toggle_bnb_burn(const Params* params_ptr = nullptr);
-		simdjson::dom::element get_bnb_burn_status(const Params* params_ptr = nullptr);
-		simdjson::dom::element query_margin_interest_rate_history(const Params* params_ptr);
+		RestResponse margin_transfer(const Params* params_ptr);
+		RestResponse margin_borrow(const Params* params_ptr);
+		RestResponse margin_repay(const Params* params_ptr);
+		RestResponse margin_asset_query(const Params* params_ptr);
+		RestResponse margin_pair_query(const Params* params_ptr);
+		RestResponse margin_all_assets_query();
+		RestResponse margin_all_pairs_query();
+		RestResponse margin_price_index(const Params* params_ptr);
+		RestResponse margin_new_order(const Params* params_ptr);
+		RestResponse margin_cancel_order(const Params* params_ptr);
+		RestResponse margin_cancel_all_orders(const Params* params_ptr);
+		RestResponse margin_transfer_history(const Params* params_ptr = nullptr);
+		RestResponse margin_loan_record(const Params* params_ptr);
+		RestResponse margin_repay_record(const Params* params_ptr);
+		RestResponse margin_interest_history(const Params* params_ptr = nullptr);
+		RestResponse margin_liquidations_record(const Params* params_ptr = nullptr);
+		RestResponse margin_account_info(const Params* params_ptr = nullptr);
+		RestResponse margin_account_order(const Params* params_ptr);
+		RestResponse margin_account_open_orders(const Params* params_ptr = nullptr);
+		RestResponse margin_account_all_orders(const Params* params_ptr);
+		RestResponse margin_account_trades_list(const Params* params_ptr);
+		RestResponse margin_max_borrow(const Params* params_ptr);
+		RestResponse margin_max_transfer(const Params* params_ptr);
+		RestResponse margin_isolated_margin_transfer(const Params* params_ptr);
+		RestResponse margin_isolated_margin_transfer_history(const Params* params_ptr);
+		RestResponse margin_isolated_margin_account_info(const Params* params_ptr = nullptr);
+		RestResponse margin_isolated_margin_symbol(const Params* params_ptr);
+		RestResponse margin_isolated_margin_symbol_all(const Params* params_ptr = nullptr);
+		RestResponse toggle_bnb_burn(const Params* params_ptr = nullptr);
+		RestResponse get_bnb_burn_status(const Params* params_ptr = nullptr);
+		RestResponse query_margin_interest_rate_history(const Params* params_ptr);
 
 		template <typename FT>
 		unsigned int margin_stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key = 0, const bool& isolated_margin_type = 0);
 		std::string margin_get_listen_key();
 		std::string margin_isolated_get_listen_key(const std::string symbol);
-		simdjson::dom::element margin_ping_listen_key(const std::string& listen_key);
-		simdjson::dom::element margin_isolated_ping_listen_key(const std::string& listen_key, const std::string symbol);
+		RestResponse margin_ping_listen_key(const std::string& listen_key);
+		RestResponse margin_isolated_ping_listen_key(const std::string& listen_key, const std::string symbol);
 
-		simdjson::dom::element margin_revoke_listen_key(const std::string& listen_key);
-		simdjson::dom::element margin_isolated_revoke_listen_key(const std::string& listen_key, const std::string symbol);
+		RestResponse margin_revoke_listen_key(const std::string& listen_key);
+		RestResponse margin_isolated_revoke_listen_key(const std::string& listen_key, const std::string symbol);
 
 	};
 
@@ -307,20 +458,20 @@ public:
 		explicit Savings(const Client<T>& client);
 		~Savings();
 
-		simdjson::dom::element get_product_list_flexible(const Params* params_ptr = nullptr);
-		simdjson::dom::element get_product_daily_quota_purchase_flexible(const Params* params_ptr);
-		simdjson::dom::element purchase_product_flexible(const Params* params_ptr);
-		simdjson::dom::element get_product_daily_quota_redemption_flexible(const Params* params_ptr);
-		simdjson::dom::element redeem_product_flexible(const Params* params_ptr);
-		simdjson::dom::element get_product_position_flexible(const Params* params_ptr);
-		simdjson::dom::element get_product_list_fixed(const Params* params_ptr);
-		simdjson::dom::element purchase_product_fixed(const Params* params_ptr);
-		simdjson::dom::element get_product_position_fixed(const Params* params_ptr);
-		simdjson::dom::element lending_account(const Params* params_ptr = nullptr);
-		simdjson::dom::element get_purchase_record(const Params* params_ptr);
-		simdjson::dom::element get_redemption_record(const Params* params_ptr);
-		simdjson::dom::element get_interest_history(const Params* params_ptr);
-		simdjson::dom::element change_fixed_pos_to_daily_pos(const Params* params_ptr);
+		RestResponse get_product_list_flexible(const Params* params_ptr = nullptr);
+		RestResponse get_product_daily_quota_purchase_flexible(const Params* params_ptr);
+		RestResponse purchase_product_flexible(const Params* params_ptr);
+		RestResponse get_product_daily_quota_redemption_flexible(const Params* params_ptr);
+		RestResponse redeem_product_flexible(const Params* params_ptr);
+		RestResponse get_product_position_flexible(const Params* params_ptr);
+		RestResponse get_product_list_fixed(const Params* params_ptr);
+		RestResponse purchase_product_fixed(const Params* params_ptr);
+		RestResponse get_product_position_fixed(const Params* params_ptr);
+		RestResponse lending_account(const Params* params_ptr = nullptr);
+		RestResponse get_purchase_record(const Params* params_ptr);
+		RestResponse get_redemption_record(const Params* params_ptr);
+		RestResponse get_interest_history(const Params* params_ptr);
+		RestResponse change_fixed_pos_to_daily_pos(const Params* params_ptr);
 
 	};
 
@@ -331,18 +482,18 @@ public:
 		explicit Mining(const Client<T>& client);
 		~Mining();
 
-		simdjson::dom::element algo_list();
-		simdjson::dom::element coin_list();
-		simdjson::dom::element get_miner_list_detail(const Params* params_ptr);
-		simdjson::dom::element get_miner_list(const Params* params_ptr);
-		simdjson::dom::element revenue_list(const Params* params_ptr);
-		simdjson::dom::element get_extra_bonus_list(const Params* params_ptr);
-		simdjson::dom::element get_hashrate_resale_list(const Params* params_ptr = nullptr);
-		simdjson::dom::element get_hashrate_resale_detail(const Params* params_ptr);
-		simdjson::dom::element make_hashrate_resale_request(const Params* params_ptr);
-		simdjson::dom::element cancel_hashrate_resale_config(const Params* params_ptr);
-		simdjson::dom::element statistic_list(const Params* params_ptr);
-		simdjson::dom::element account_list(const Params* params_ptr);
+		RestResponse algo_list();
+		RestResponse coin_list();
+		RestResponse get_miner_list_detail(const Params* params_ptr);
+		RestResponse get_miner_list(const Params* params_ptr);
+		RestResponse revenue_list(const Params* params_ptr);
+		RestResponse get_extra_bonus_list(const Params* params_ptr);
+		RestResponse get_hashrate_resale_list(const Params* params_ptr = nullptr);
+		RestResponse get_hashrate_resale_detail(const Params* params_ptr);
+		RestResponse make_hashrate_resale_request(const Params* params_ptr);
+		RestResponse cancel_hashrate_resale_config(const Params* params_ptr);
+		RestResponse statistic_list(const Params* params_ptr);
+		RestResponse account_list(const Params* params_ptr);
 	};
 
 	struct BLVT
@@ -352,12 +503,12 @@ public:
 		explicit BLVT(const Client<T>& client);
 		~BLVT();
 
-		simdjson::dom::element get_blvt_info(const Params* params_ptr = nullptr);
-		simdjson::dom::element subscribe_blvt(const Params* params_ptr);
-		simdjson::dom::element get_subscribe_blvt_history(const Params* params_ptr);
-		simdjson::dom::element redeem_blvt(const Params* params_ptr);
-		simdjson::dom::element get_redeem_blvt_history(const Params* params_ptr);
-		simdjson::dom::element get_blvt_user_limit(const Params* params_ptr);
+		RestResponse get_blvt_info(const Params* params_ptr = nullptr);
+		RestResponse subscribe_blvt(const Params* params_ptr);
+		RestResponse get_subscribe_blvt_history(const Params* params_ptr);
+		RestResponse redeem_blvt(const Params* params_ptr);
+		RestResponse get_redeem_blvt_history(const Params* params_ptr);
+		RestResponse get_blvt_user_limit(const Params* params_ptr);
 	};
 
 	struct BSwap
@@ -367,20 +518,36 @@ public:
 		explicit BSwap(const Client<T>& client);
 		~BSwap();
 
-		simdjson::dom::element get_all_swap_pools();
-		simdjson::dom::element get_liquidity_info_pool(const Params* params_ptr);
-		simdjson::dom::element add_liquidity(const Params* params_ptr);
-		simdjson::dom::element remove_liquidity(const Params* params_ptr);
-		simdjson::dom::element get_liquidity_ops_record(const Params* params_ptr);
-		simdjson::dom::element request_quote(const Params* params_ptr);
-		simdjson::dom::element make_swap(const Params* params_ptr);
-		simdjson::dom::element get_swap_history(const Params* params_ptr);
+		RestResponse get_all_swap_pools();
+		RestResponse get_liquidity_info_pool(const Params* params_ptr);
+		RestResponse add_liquidity(const Params* params_ptr);
+		RestResponse remove_liquidity(const Params* params_ptr);
+		RestResponse get_liquidity_ops_record(const Params* params_ptr);
+		RestResponse request_quote(const Params* params_ptr);
+		RestResponse make_swap(const Params* params_ptr);
+		RestResponse get_swap_history(const Params* params_ptr);
 	};
 
-	simdjson::dom::element custom_get_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
-	simdjson::dom::element custom_post_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
-	simdjson::dom::element custom_put_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
-	simdjson::dom::element custom_delete_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
+	// Requests built but not sent, for 'async_req()'
+
+	RestRequest order_book_request(const Params* params_ptr);
+	RestRequest klines_request(const Params* params_ptr);
+	RestRequest test_new_order_request(const Params* params_ptr);
+	RestRequest new_order_request(const Params* params_ptr);
+	RestRequest cancel_order_request(const Params* params_ptr);
+	RestRequest cancel_all_orders_request(const Params* params_ptr);
+	RestRequest query_order_request(const Params* params_ptr);
+	RestRequest open_orders_request(const Params* params_ptr = nullptr);
+	RestRequest ping_listen_key_request(const std::string& listen_key = ""); // only spot requires key
+	RestRequest custom_request(const RestRequestType request_type, const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
+
+	std::future<RestResponse> async_req(const RestRequest& request);
+	void async_req(const RestRequest& request, std::function<void(RestResponse&)> callback);
+
+	RestResponse custom_get_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
+	RestResponse custom_post_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
+	RestResponse custom_put_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
+	RestResponse custom_delete_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature = 0);
 
 	template <typename FT>
 	unsigned int custom_stream(const std::string stream_name, std::string& buffer, FT& functor, const bool ping_listen_key = 0);
@@ -399,8 +566,9 @@ class FuturesClient : public Client<FuturesClient<CT>>
 private:
 	void v_init_ws_session();
 	std::string v_get_listen_key();
-	simdjson::dom::element v_ping_listen_key(const std::string& listen_key);
-	simdjson::dom::element v_revoke_listen_key(const std::string& listen_key);
+	RestResponse v_ping_listen_key(const std::string& listen_key);
+	RestRequest v_ping_listen_key_request(const std::string& listen_key);
+	RestResponse v_revoke_listen_key(const std::string& listen_key);
 
 
 	// ------------------- crtp for all (spot + coin/usdt)
@@ -409,83 +577,99 @@ private:
 
 	bool v_ping_client();
 	unsigned long long v_exchange_time();
-	simdjson::dom::element v_exchange_info();
-	simdjson::dom::element v_order_book(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_historical(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_agg(const Params* params_ptr);
-	simdjson::dom::element v_klines(const Params* params_ptr);
-	simdjson::dom::element v_daily_ticker_stats(const Params* params_ptr);
-	simdjson::dom::element v_get_ticker(const Params* params_ptr);
-	simdjson::dom::element v_get_order_book_ticker(const Params* params_ptr);
+	RestResponse v_exchange_info();
+	RestResponse v_order_book(const Params* params_ptr);
+	RestRequest v_order_book_request(const Params* params_ptr);
+	RestResponse v_public_trades_recent(const Params* params_ptr);
+	RestResponse v_public_trades_historical(const Params* params_ptr);
+	RestResponse v_public_trades_agg(const Params* params_ptr);
+	RestResponse v_klines(const Params* params_ptr);
+	RestRequest v_klines_request(const Params* params_ptr);
+	RestResponse v_daily_ticker_stats(const Params* params_ptr);
+	RestResponse v_get_ticker(const Params* params_ptr);
+	RestResponse v_get_order_book_ticker(const Params* params_ptr);
 
 	// trading endpoints
 
 	// -- mutual with spot
 
-	simdjson::dom::element v_test_new_order(const Params* params_ptr);
-	simdjson::dom::element v_new_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_query_order(const Params* params_ptr);
-	simdjson::dom::element v_open_orders(const Params* params_ptr);
-	simdjson::dom::element v_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_account_info(const Params* params_ptr);
-	simdjson::dom::element v_account_trades_list(const Params* params_ptr);
+	RestResponse v_test_new_order(const Params* params_ptr);
+	RestRequest v_test_new_order_request(const Params* params_ptr);
+	RestResponse v_new_order(const Params* params_ptr);
+	RestRequest v_new_order_request(const Params* params_ptr);
+	RestResponse v_cancel_order(const Params* params_ptr);
+	RestRequest v_cancel_order_request(const Params* params_ptr);
+	RestResponse v_cancel_all_orders(const Params* params_ptr);
+	RestRequest v_cancel_all_orders_request(const Params* params_ptr);
+	RestResponse v_query_order(const Params* params_ptr);
+	RestRequest v_query_order_request(const Params* params_ptr);
+	RestResponse v_open_orders(const Params* params_ptr);
+	RestRequest v_open_orders_request(const Params* params_ptr);
+	RestResponse v_all_orders(const Params* params_ptr);
+	RestResponse v_account_info(const Params* params_ptr);
+	RestResponse v_account_trades_list(const Params* params_ptr);
 
 	// -- Global that are going deeper to USDT and COIN
 
 	template <typename FT>
 	unsigned int v_stream_Trade(const std::string& symbol, std::string& buffer, FT& functor);
 
+	static void _append_batch_order(std::string& batch_buffer, const Params& order);
+
 public:
 	friend Client<FuturesClient<CT>>;
 	bool _testnet_mode;
 
+	static const size_t MAX_BATCH_ORDERS = 5; // orders per batchOrders request
+
 	FuturesClient(CT& exchange_client);
 	FuturesClient(CT& exchange_client, const std::string key, const std::string secret);
 
 	void set_testnet_mode(const bool status);
 	bool get_testnet_mode();
 
+	OrderTemplate order_template(const Params& static_params, const unsigned int price_precision = 8, const unsigned int quantity_precision = 8);
+
 	// -- unique to future endpoints
 
-	simdjson::dom::element change_position_mode(const Params* params_ptr);
-	simdjson::dom::element get_position_mode(const Params* params_ptr = nullptr);
-	simdjson::dom::element batch_orders(const Params* params_ptr);
-	simdjson::dom::element cancel_batch_orders(const Params* params_ptr);
-	simdjson::dom::element cancel_all_orders_timer(const Params* params_ptr);
-	simdjson::dom::element query_open_order(const Params* params_ptr);
-	simdjson::dom::element account_balances(const Params* params_ptr = nullptr);
-	simdjson::dom::element change_leverage(const Params* params_ptr);
-	simdjson::dom::element change_margin_type(const Params* params_ptr);
-	simdjson::dom::element change_position_margin(const Params* params_ptr);
-	simdjson::dom::element change_position_margin_history(const Params* params_ptr);
-	simdjson::dom::element position_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element get_income_history(const Params* params_ptr);
-	simdjson::dom::element get_leverage_bracket(const Params* params_ptr = nullptr);
-	simdjson::dom::element users_force_orders(const Params* params_ptr = nullptr);
-	simdjson::dom::element pos_adl_quantile_est(const Params* params_ptr = nullptr);
-	simdjson::dom::element get_user_comission_rate(const Params* params_ptr);
-	simdjson::dom::element api_quant_trading_rules(const Params* params_ptr = nullptr);
-	simdjson::dom::element get_blvt_kline_history(const Params* params_ptr);
-	simdjson::dom::element get_composite_index_symbol_info(const Params* params_ptr = nullptr);
+	RestResponse change_position_mode(const Params* params_ptr);
+	RestResponse get_position_mode(const Params* params_ptr = nullptr);
+	RestResponse batch_orders(const Params* params_ptr);
+	RestRequest batch_orders_request(const Params* params_ptr);
+	BatchResponse batch_new_orders(const std::vector<Params>& orders, const Params* batch_params = nullptr);
+	RestResponse cancel_batch_orders(const Params* params_ptr);
+	RestResponse cancel_all_orders_timer(const Params* params_ptr);
+	RestResponse query_open_order(const Params* params_ptr);
+	RestResponse account_balances(const Params* params_ptr = nullptr);
+	RestResponse change_leverage(const Params* params_ptr);
+	RestResponse change_margin_type(const Params* params_ptr);
+	RestResponse change_position_margin(const Params* params_ptr);
+	RestResponse change_position_margin_history(const Params* params_ptr);
+	RestResponse position_info(const Params* params_ptr = nullptr);
+	RestResponse get_income_history(const Params* params_ptr);
+	RestResponse get_leverage_bracket(const Params* params_ptr = nullptr);
+	RestResponse users_force_orders(const Params* params_ptr = nullptr);
+	RestResponse pos_adl_quantile_est(const Params* params_ptr = nullptr);
+	RestResponse get_user_comission_rate(const Params* params_ptr);
+	RestResponse api_quant_trading_rules(const Params* params_ptr = nullptr);
+	RestResponse get_blvt_kline_history(const Params* params_ptr);
+	RestResponse get_composite_index_symbol_info(const Params* params_ptr = nullptr);
 
 	// -------------------  inter-future crtp ONLY
 
 	 // market Data
 
-	simdjson::dom::element mark_price(const Params* params_ptr = nullptr);
-	simdjson::dom::element open_interest(const Params* params_ptr);
-	simdjson::dom::element composite_index_symbol_info(const Params* params_ptr);
-	simdjson::dom::element continues_klines(const Params* params_ptr);
-	simdjson::dom::element index_klines(const Params* params_ptr);
-	simdjson::dom::element mark_klines(const Params* params_ptr);
+	RestResponse mark_price(const Params* params_ptr = nullptr);
+	RestResponse open_interest(const Params* params_ptr);
+	RestResponse composite_index_symbol_info(const Params* params_ptr);
+	RestResponse continues_klines(const Params* params_ptr);
+	RestResponse index_klines(const Params* params_ptr);
+	RestResponse mark_klines(const Params* params_ptr);
 
 	// note that the following three methods are only for USDT margined market data
-	simdjson::dom::element funding_rate_history(const Params* params_ptr);
-	simdjson::dom::element change_multiasset_margin_mode(const Params* params_ptr);
-	simdjson::dom::element check_multiasset_margin_mode(const Params* params_ptr = nullptr);
+	RestResponse funding_rate_history(const Params* params_ptr);
+	RestResponse change_multiasset_margin_mode(const Params* params_ptr);
+	RestResponse check_multiasset_margin_mode(const Params* params_ptr = nullptr);
 
 	// WS Streams
 
@@ -532,10 +716,10 @@ public:
 
 	// endpoints are same for both wallet types below
 
-	simdjson::dom::element open_interest_stats(const Params* params_ptr);
-	simdjson::dom::element top_long_short_ratio(const Params* params_ptr, bool accounts = 0);
-	simdjson::dom::element global_long_short_ratio(const Params* params_ptr);
-	simdjson::dom::element taker_long_short_ratio(const Params* params_ptr);
+	RestResponse open_interest_stats(const Params* params_ptr);
+	RestResponse top_long_short_ratio(const Params* params_ptr, bool accounts = 0);
+	RestResponse global_long_short_ratio(const Params* params_ptr);
+	RestResponse taker_long_short_ratio(const Params* params_ptr);
 
 	~FuturesClient();
 };
@@ -551,65 +735,75 @@ private:
 
 	bool v__ping_client();
 	unsigned long long v__exchange_time();
-	simdjson::dom::element v__exchange_info();
-	simdjson::dom::element v__order_book(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_historical(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_agg(const Params* params_ptr);
-	simdjson::dom::element v__klines(const Params* params_ptr);
-	simdjson::dom::element v__daily_ticker_stats(const Params* params_ptr);
-	simdjson::dom::element v__get_ticker(const Params* params_ptr);
-	simdjson::dom::element v__get_order_book_ticker(const Params* params_ptr);
+	RestResponse v__exchange_info();
+	RestResponse v__order_book(const Params* params_ptr);
+	RestRequest v__order_book_request(const Params* params_ptr);
+	RestResponse v__public_trades_recent(const Params* params_ptr);
+	RestResponse v__public_trades_historical(const Params* params_ptr);
+	RestResponse v__public_trades_agg(const Params* params_ptr);
+	RestResponse v__klines(const Params* params_ptr);
+	RestRequest v__klines_request(const Params* params_ptr);
+	RestResponse v__daily_ticker_stats(const Params* params_ptr);
+	RestResponse v__get_ticker(const Params* params_ptr);
+	RestResponse v__get_order_book_ticker(const Params* params_ptr);
 
 	// market Data
 
-	simdjson::dom::element v_mark_price(const Params* params_ptr);
-	simdjson::dom::element v_open_interest(const Params* params_ptr);
-	simdjson::dom::element v_composite_index_symbol_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_continues_klines(const Params* params_ptr);
-	simdjson::dom::element v_index_klines(const Params* params_ptr);
-	simdjson::dom::element v_mark_klines(const Params* params_ptr);
+	RestResponse v_mark_price(const Params* params_ptr);
+	RestResponse v_open_interest(const Params* params_ptr);
+	RestResponse v_composite_index_symbol_info(const Params* params_ptr = nullptr);
+	RestResponse v_continues_klines(const Params* params_ptr);
+	RestResponse v_index_klines(const Params* params_ptr);
+	RestResponse v_mark_klines(const Params* params_ptr);
 
-	simdjson::dom::element v_funding_rate_history(const Params* params_ptr);
-	simdjson::dom::element v_change_multiasset_margin_mode(const Params* params_ptr);
-	simdjson::dom::element v_check_multiasset_margin_mode(const Params* params_ptr = nullptr);
+	RestResponse v_funding_rate_history(const Params* params_ptr);
+	RestResponse v_change_multiasset_margin_mode(const Params* params_ptr);
+	RestResponse v_check_multiasset_margin_mode(const Params* params_ptr = nullptr);
 
 
 	// trading endpoints
 
 	// -- mutual with spot
 
-	simdjson::dom::element v__new_order(const Params* params_ptr);
-	simdjson::dom::element v__cancel_order(const Params* params_ptr);
-	simdjson::dom::element v__cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element v__query_order(const Params* params_ptr);
-	simdjson::dom::element v__open_orders(const Params* params_ptr);
-	simdjson::dom::element v__all_orders(const Params* params_ptr);
-	simdjson::dom::element v__account_info(const Params* params_ptr);
-	simdjson::dom::element v__account_trades_list(const Params* params_ptr);
+	RestResponse v__new_order(const Params* params_ptr);
+	RestRequest v__new_order_request(const Params* params_ptr);
+	RestResponse v__cancel_order(const Params* params_ptr);
+	RestRequest v__cancel_order_request(const Params* params_ptr);
+	RestResponse v__cancel_all_orders(const Params* params_ptr);
+	RestRequest v__cancel_all_orders_request(const Params* params_ptr);
+	RestResponse v__query_order(const Params* params_ptr);
+	RestRequest v__query_order_request(const Params* params_ptr);
+	RestResponse v__open_orders(const Params* params_ptr);
+	RestRequest v__open_orders_request(const Params* params_ptr);
+	RestResponse v__all_orders(const Params* params_ptr);
+	RestResponse v__account_info(const Params* params_ptr);
+	RestResponse v__account_trades_list(const Params* params_ptr);
 
 	// -- unique to future endpoints
 
-	simdjson::dom::element v_change_position_mode(const Params* params_ptr);
-	simdjson::dom::element v_get_position_mode(const Params* params_ptr);
-	simdjson::dom::element v_batch_orders(const Params* params_ptr);
-	simdjson::dom::element v_cancel_batch_orders(const Params* params_ptr);
-	simdjson::dom::element v_cancel_all_orders_timer(const Params* params_ptr);
-	simdjson::dom::element v_query_open_order(const Params* params_ptr);
-	simdjson::dom::element v_account_balances(const Params* params_ptr);
-	simdjson::dom::element v_change_leverage(const Params* params_ptr);
-	simdjson::dom::element v_change_margin_type(const Params* params_ptr);
-	simdjson::dom::element v_change_position_margin(const Params* params_ptr);
-	simdjson::dom::element v_change_position_margin_history(const Params* params_ptr);
-	simdjson::dom::element v_position_info(const Params* params_ptr);
-	simdjson::dom::element v_get_income_history(const Params* params_ptr);
-	simdjson::dom::element v_get_leverage_bracket(const Params* params_ptr);
-	simdjson::dom::element v_users_force_orders(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_pos_adl_quantile_est(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_get_user_comission_rate(const Params* params_ptr);
-	simdjson::dom::element v_api_quant_trading_rules(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_get_blvt_kline_history(const Params* params_ptr);
-	simdjson::dom::element v_get_composite_index_symbol_info(const Params* params_ptr = nullptr);
+	RestResponse v_change_position_mode(const Params* params_ptr);
+	RestResponse v_get_position_mode(const Params* params_ptr);
+	RestResponse v_batch_orders(const Params* params_ptr);
+	RestRequest v_batch_orders_request(const Params* params_ptr);
+	RestResponse v_cancel_batch_orders(const Params* params_ptr);
+
+	OrderTemplate v__order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision);
+	RestResponse v_cancel_all_orders_timer(const Params* params_ptr);
+	RestResponse v_query_open_order(const Params* params_ptr);
+	RestResponse v_account_balances(const Params* params_ptr);
+	RestResponse v_change_leverage(const Params* params_ptr);
+	RestResponse v_change_margin_type(const Params* params_ptr);
+	RestResponse v_change_position_margin(const Params* params_ptr);
+	RestResponse v_change_position_margin_history(const Params* params_ptr);
+	RestResponse v_position_info(const Params* params_ptr);
+	RestResponse v_get_income_history(const Params* params_ptr);
+	RestResponse v_get_leverage_bracket(const Params* params_ptr);
+	RestResponse v_users_force_orders(const Params* params_ptr = nullptr);
+	RestResponse v_pos_adl_quantile_est(const Params* params_ptr = nullptr);
+	RestResponse v_get_user_comission_rate(const Params* params_ptr);
+	RestResponse v_api_quant_trading_rules(const Params* params_ptr = nullptr);
+	RestResponse v_get_blvt_kline_history(const Params* params_ptr);
+	RestResponse v_get_composite_index_symbol_info(const Params* params_ptr = nullptr);
 
 	// WS Streams
 
@@ -647,8 +841,9 @@ private:
 	unsigned int v__stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key);
 
 	std::string v__get_listen_key();
-	simdjson::dom::element v__ping_listen_key();
-	simdjson::dom::element v__revoke_listen_key();
+	RestResponse v__ping_listen_key();
+	RestRequest v__ping_listen_key_request();
+	RestResponse v__revoke_listen_key();
 
 public:
 	friend FuturesClient;
@@ -671,67 +866,77 @@ private:
 
 	bool v__ping_client();
 	unsigned long long v__exchange_time();
-	simdjson::dom::element v__exchange_info();
-	simdjson::dom::element v__order_book(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_historical(const Params* params_ptr);
-	simdjson::dom::element v__public_trades_agg(const Params* params_ptr);
-	simdjson::dom::element v__klines(const Params* params_ptr);
-	simdjson::dom::element v__daily_ticker_stats(const Params* params_ptr);
-	simdjson::dom::element v__get_ticker(const Params* params_ptr);
-	simdjson::dom::element v__get_order_book_ticker(const Params* params_ptr);
+	RestResponse v__exchange_info();
+	RestResponse v__order_book(const Params* params_ptr);
+	RestRequest v__order_book_request(const Params* params_ptr);
+	RestResponse v__public_trades_recent(const Params* params_ptr);
+	RestResponse v__public_trades_historical(const Params* params_ptr);
+	RestResponse v__public_trades_agg(const Params* params_ptr);
+	RestResponse v__klines(const Params* params_ptr);
+	RestRequest v__klines_request(const Params* params_ptr);
+	RestResponse v__daily_ticker_stats(const Params* params_ptr);
+	RestResponse v__get_ticker(const Params* params_ptr);
+	RestResponse v__get_order_book_ticker(const Params* params_ptr);
 
 	// market Data
 
-	simdjson::dom::element v_mark_price(const Params* params_ptr);
-	simdjson::dom::element v_open_interest(const Params* params_ptr);
-	simdjson::dom::element v_composite_index_symbol_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_continues_klines(const Params* params_ptr);
-	simdjson::dom::element v_index_klines(const Params* params_ptr);
-	simdjson::dom::element v_mark_klines(const Params* params_ptr);
+	RestResponse v_mark_price(const Params* params_ptr);
+	RestResponse v_open_interest(const Params* params_ptr);
+	RestResponse v_composite_index_symbol_info(const Params* params_ptr = nullptr);
+	RestResponse v_continues_klines(const Params* params_ptr);
+	RestResponse v_index_klines(const Params* params_ptr);
+	RestResponse v_mark_klines(const Params* params_ptr);
 	
 	// Missing endpoints for Coin margined 
 
-	simdjson::dom::element v_funding_rate_history(const Params* params_ptr);
-	simdjson::dom::element v_change_multiasset_margin_mode(const Params* params_ptr);
-	simdjson::dom::element v_check_multiasset_margin_mode(const Params* params_ptr = nullptr);
+	RestResponse v_funding_rate_history(const Params* params_ptr);
+	RestResponse v_change_multiasset_margin_mode(const Params* params_ptr);
+	RestResponse v_check_multiasset_margin_mode(const Params* params_ptr = nullptr);
 
 
 	// trading endpoints
 
 	// -- mutual with spot
 
-	simdjson::dom::element v__new_order(const Params* params_ptr);
-	simdjson::dom::element v__cancel_order(const Params* params_ptr);
-	simdjson::dom::element v__cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element v__query_order(const Params* params_ptr);
-	simdjson::dom::element v__open_orders(const Params* params_ptr);
-	simdjson::dom::element v__all_orders(const Params* params_ptr);
-	simdjson::dom::element v__account_info(const Params* params_ptr);
-	simdjson::dom::element v__account_trades_list(const Params* params_ptr);
+	RestResponse v__new_order(const Params* params_ptr);
+	RestRequest v__new_order_request(const Params* params_ptr);
+	RestResponse v__cancel_order(const Params* params_ptr);
+	RestRequest v__cancel_order_request(const Params* params_ptr);
+	RestResponse v__cancel_all_orders(const Params* params_ptr);
+	RestRequest v__cancel_all_orders_request(const Params* params_ptr);
+	RestResponse v__query_order(const Params* params_ptr);
+	RestRequest v__query_order_request(const Params* params_ptr);
+	RestResponse v__open_orders(const Params* params_ptr);
+	RestRequest v__open_orders_request(const Params* params_ptr);
+	RestResponse v__all_orders(const Params* params_ptr);
+	RestResponse v__account_info(const Params* params_ptr);
+	RestResponse v__account_trades_list(const Params* params_ptr);
 
 	// -- unique to future endpoints
 
-	simdjson::dom::element v_change_position_mode(const Params* params_ptr);
-	simdjson::dom::element v_get_position_mode(const Params* params_ptr);
-	simdjson::dom::element v_batch_orders(const Params* params_ptr);
-	simdjson::dom::element v_cancel_batch_orders(const Params* params_ptr);
-	simdjson::dom::element v_cancel_all_orders_timer(const Params* params_ptr);
-	simdjson::dom::element v_query_open_order(const Params* params_ptr);
-	simdjson::dom::element v_account_balances(const Params* params_ptr);
-	simdjson::dom::element v_change_leverage(const Params* params_ptr);
-	simdjson::dom::element v_change_margin_type(const Params* params_ptr);
-	simdjson::dom::element v_change_position_margin(const Params* params_ptr);
-	simdjson::dom::element v_change_position_margin_history(const Params* params_ptr);
-	simdjson::dom::element v_position_info(const Params* params_ptr);
-	simdjson::dom::element v_get_income_history(const Params* params_ptr);
-	simdjson::dom::element v_get_leverage_bracket(const Params* params_ptr);
-	simdjson::dom::element v_users_force_orders(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_pos_adl_quantile_est(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_get_user_comission_rate(const Params* params_ptr);
-	simdjson::dom::element v_api_quant_trading_rules(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_get_blvt_kline_history(const Params* params_ptr);
-	simdjson::dom::element v_get_composite_index_symbol_info(const Params* params_ptr = nullptr);
+	RestResponse v_change_position_mode(const Params* params_ptr);
+	RestResponse v_get_position_mode(const Params* params_ptr);
+	RestResponse v_batch_orders(const Params* params_ptr);
+	RestRequest v_batch_orders_request(const Params* params_ptr);
+	RestResponse v_cancel_batch_orders(const Params* params_ptr);
+
+	OrderTemplate v__order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision);
+	RestResponse v_cancel_all_orders_timer(const Params* params_ptr);
+	RestResponse v_query_open_order(const Params* params_ptr);
+	RestResponse v_account_balances(const Params* params_ptr);
+	RestResponse v_change_leverage(const Params* params_ptr);
+	RestResponse v_change_margin_type(const Params* params_ptr);
+	RestResponse v_change_position_margin(const Params* params_ptr);
+	RestResponse v_change_position_margin_history(const Params* params_ptr);
+	RestResponse v_position_info(const Params* params_ptr);
+	RestResponse v_get_income_history(const Params* params_ptr);
+	RestResponse v_get_leverage_bracket(const Params* params_ptr);
+	RestResponse v_users_force_orders(const Params* params_ptr = nullptr);
+	RestResponse v_pos_adl_quantile_est(const Params* params_ptr = nullptr);
+	RestResponse v_get_user_comission_rate(const Params* params_ptr);
+	RestResponse v_api_quant_trading_rules(const Params* params_ptr = nullptr);
+	RestResponse v_get_blvt_kline_history(const Params* params_ptr);
+	RestResponse v_get_composite_index_symbol_info(const Params* params_ptr = nullptr);
 
 	// WS Streams
 
@@ -769,8 +974,9 @@ private:
 	unsigned int v__stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key);
 
 	std::string v__get_listen_key();
-	simdjson::dom::element v__ping_listen_key();
-	simdjson::dom::element v__revoke_listen_key();
+	RestResponse v__ping_listen_key();
+	RestRequest v__ping_listen_key_request();
+	RestResponse v__revoke_listen_key();
 
 public:
 	friend FuturesClient;
@@ -791,15 +997,17 @@ private:
 
 	bool v_ping_client();
 	unsigned long long v_exchange_time();
-	simdjson::dom::element v_exchange_info();
-	simdjson::dom::element v_order_book(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_historical(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_agg(const Params* params_ptr);
-	simdjson::dom::element v_klines(const Params* params_ptr);
-	simdjson::dom::element v_daily_ticker_stats(const Params* params_ptr);
-	simdjson::dom::element v_get_ticker(const Params* params_ptr);
-	simdjson::dom::element v_get_order_book_ticker(const Params* params_ptr);
+	RestResponse v_exchange_info();
+	RestResponse v_order_book(const Params* params_ptr);
+	RestRequest v_order_book_request(const Params* params_ptr);
+	RestResponse v_public_trades_recent(const Params* params_ptr);
+	RestResponse v_public_trades_historical(const Params* params_ptr);
+	RestResponse v_public_trades_agg(const Params* params_ptr);
+	RestResponse v_klines(const Params* params_ptr);
+	RestRequest v_klines_request(const Params* params_ptr);
+	RestResponse v_daily_ticker_stats(const Params* params_ptr);
+	RestResponse v_get_ticker(const Params* params_ptr);
+	RestResponse v_get_order_book_ticker(const Params* params_ptr);
 
 	// ------------------- crtp global end
 
@@ -807,23 +1015,21 @@ private:
 
 	// ---- CRTP implementations
 
-	simdjson::dom::element v_test_new_order(const Params* params_ptr);
-	simdjson::dom::element v_new_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_query_order(const Params* params_ptr);
-	simdjson::dom::element v_open_orders(const Params* params_ptr);
-	simdjson::dom::element v_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_account_info(const Params* params_ptr);
-	simdjson::dom::element v_account_trades_list(const Params* params_ptr);
-
-	// ---- general methods
-
-	simdjson::dom::element oco_new_order(const Params* params_ptr);
-	simdjson::dom::element oco_cancel_order(const Params* params_ptr);
-	simdjson::dom::element oco_query_order(const Params* params_ptr = nullptr);
-	simdjson::dom::element oco_all_orders(const Params* params_ptr = nullptr);
-	simdjson::dom::element oco_open_orders(const Params* params_ptr = nullptr);
+	RestResponse v_test_new_order(const Params* params_ptr);
+	RestRequest v_test_new_order_request(const Params* params_ptr);
+	RestResponse v_new_order(const Params* params_ptr);
+	RestRequest v_new_order_request(const Params* params_ptr);
+	RestResponse v_cancel_order(const Params* params_ptr);
+	RestRequest v_cancel_order_request(const Params* params_ptr);
+	RestResponse v_cancel_all_orders(const Params* params_ptr);
+	RestRequest v_cancel_all_orders_request(const Params* params_ptr);
+	RestResponse v_query_order(const Params* params_ptr);
+	RestRequest v_query_order_request(const Params* params_ptr);
+	RestResponse v_open_orders(const Params* params_ptr);
+	RestRequest v_open_orders_request(const Params* params_ptr);
+	RestResponse v_all_orders(const Params* params_ptr);
+	RestResponse v_account_info(const Params* params_ptr);
+	RestResponse v_account_trades_list(const Params* params_ptr);
 
 	// WS Streams
 
@@ -838,8 +1044,9 @@ private:
 	template <typename FT>
 	unsigned int v_stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key);
 	std::string v_get_listen_key();
-	simdjson::dom::element v_ping_listen_key(const std::string& listen_key);
-	simdjson::dom::element v_revoke_listen_key(const std::string& listen_key);
+	RestResponse v_ping_listen_key(const std::string& listen_key);
+	RestRequest v_ping_listen_key_request(const std::string& listen_key);
+	RestResponse v_revoke_listen_key(const std::string& listen_key);
 
 
 	// crtp infrastructure end
@@ -852,6 +1059,17 @@ public:
 	SpotClient();
 	SpotClient(const std::string key, const std::string secret);
 
+	// ---- general methods
+
+	RestResponse oco_new_order(const Params* params_ptr);
+	RestRequest oco_new_order_request(const Params* params_ptr);
+	RestResponse oco_cancel_order(const Params* params_ptr);
+	RestResponse oco_query_order(const Params* params_ptr = nullptr);
+	RestResponse oco_all_orders(const Params* params_ptr = nullptr);
+	RestResponse oco_open_orders(const Params* params_ptr = nullptr);
+
+	OrderTemplate order_template(const Params& static_params, const unsigned int price_precision = 8, const unsigned int quantity_precision = 8);
+
 	~SpotClient();
 };
 
@@ -864,13 +1082,15 @@ private:
 
 	bool v_ping_client();
 	unsigned long long v_exchange_time();
-	simdjson::dom::element v_exchange_info();
-	simdjson::dom::element v_get_ticker(const Params* params_ptr = nullptr);
+	RestResponse v_exchange_info();
+	RestResponse v_get_ticker(const Params* params_ptr = nullptr);
 
-	simdjson::dom::element v_order_book(const Params* params_ptr);
-	simdjson::dom::element v_klines(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_recent(const Params* params_ptr);
-	simdjson::dom::element v_public_trades_historical(const Params* params_ptr);
+	RestResponse v_order_book(const Params* params_ptr);
+	RestRequest v_order_book_request(const Params* params_ptr);
+	RestResponse v_klines(const Params* params_ptr);
+	RestRequest v_klines_request(const Params* params_ptr);
+	RestResponse v_public_trades_recent(const Params* params_ptr);
+	RestResponse v_public_trades_historical(const Params* params_ptr);
 
 	// ------------------- crtp global end
 
@@ -878,21 +1098,27 @@ private:
 
 	// ---- CRTP implementations
 
-	simdjson::dom::element v_account_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_test_new_order(const Params* params_ptr);
-	simdjson::dom::element v_new_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_order(const Params* params_ptr);
-	simdjson::dom::element v_cancel_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_query_order(const Params* params_ptr);
-	simdjson::dom::element v_open_orders(const Params* params_ptr);
-	simdjson::dom::element v_all_orders(const Params* params_ptr);
-	simdjson::dom::element v_account_trades_list(const Params* params_ptr = nullptr);
+	RestResponse v_account_info(const Params* params_ptr = nullptr);
+	RestResponse v_test_new_order(const Params* params_ptr);
+	RestRequest v_test_new_order_request(const Params* params_ptr);
+	RestResponse v_new_order(const Params* params_ptr);
+	RestRequest v_new_order_request(const Params* params_ptr);
+	RestResponse v_cancel_order(const Params* params_ptr);
+	RestRequest v_cancel_order_request(const Params* params_ptr);
+	RestResponse v_cancel_all_orders(const Params* params_ptr);
+	RestRequest v_cancel_all_orders_request(const Params* params_ptr);
+	RestResponse v_query_order(const Params* params_ptr);
+	RestRequest v_query_order_request(const Params* params_ptr);
+	RestResponse v_open_orders(const Params* params_ptr);
+	RestRequest v_open_orders_request(const Params* params_ptr);
+	RestResponse v_all_orders(const Params* params_ptr);
+	RestResponse v_account_trades_list(const Params* params_ptr = nullptr);
 
 	// crtp - missing endpoints
 
-	simdjson::dom::element v_public_trades_agg(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_get_order_book_ticker(const Params* params_ptr = nullptr);
-	simdjson::dom::element v_daily_ticker_stats(const Params* params_ptr = nullptr);
+	RestResponse v_public_trades_agg(const Params* params_ptr = nullptr);
+	RestResponse v_get_order_book_ticker(const Params* params_ptr = nullptr);
+	RestResponse v_daily_ticker_stats(const Params* params_ptr = nullptr);
 
 	// WS Streams
 
@@ -904,8 +1130,9 @@ private:
 	unsigned int v_stream_userstream(std::string& buffer, FT& functor, const bool ping_listen_key); // todo: define
 
 	std::string v_get_listen_key();
-	simdjson::dom::element v_ping_listen_key(const std::string& listen_key);
-	simdjson::dom::element v_revoke_listen_key(const std::string& listen_key);
+	RestResponse v_ping_listen_key(const std::string& listen_key);
+	RestRequest v_ping_listen_key_request(const std::string& listen_key);
+	RestResponse v_revoke_listen_key(const std::string& listen_key);
 
 
 	template <typename FT>
@@ -922,17 +1149,17 @@ private:
 public:
 	friend Client;
 
-	simdjson::dom::element get_spot_index_price(const Params* params_ptr);
-	simdjson::dom::element get_mark_price(const Params* params_ptr = nullptr);
+	RestResponse get_spot_index_price(const Params* params_ptr);
+	RestResponse get_mark_price(const Params* params_ptr = nullptr);
 
 
 	// ---- general methods
 
-	simdjson::dom::element funds_transfer(const Params* params_ptr);
-	simdjson::dom::element holding_info(const Params* params_ptr = nullptr);
-	simdjson::dom::element account_funding_flow(const Params* params_ptr);
-	simdjson::dom::element batch_orders(const Params* params_ptr);
-	simdjson::dom::element cancel_batch_orders(const Params* params_ptr);
+	RestResponse funds_transfer(const Params* params_ptr);
+	RestResponse holding_info(const Params* params_ptr = nullptr);
+	RestResponse account_funding_flow(const Params* params_ptr);
+	RestResponse batch_orders(const Params* params_ptr);
+	RestResponse cancel_batch_orders(const Params* params_ptr);
 
 	bool _testnet_mode;
 
@@ -0,0 +1,73 @@
+#ifndef EXCHANGE_CLOCK_H
+#define EXCHANGE_CLOCK_H
+
+
+class ExchangeClock
+	// an estimate of the clock of the exchange: a monotonic local clock (the system clock read once, then advanced by std::chrono::steady_clock)
+	// plus an offset. the offset is taken from the sample of least round trip of the last samples (NTP clock filter) - its error is at most half of its round trip
+{
+private:
+	struct ClockSample
+	{
+		int64_t offset; // microseconds, exchange time - local time at the middle of the request
+		int64_t round_trip; // microseconds, INT64_MAX for an empty slot
+	};
+
+	const int64_t _system_base; // microseconds since epoch, when constructed
+	const std::chrono::steady_clock::time_point _steady_base;
+
+	std::atomic<int64_t> _offset; // microseconds
+	std::atomic<int64_t> _round_trip; // microseconds, of the sample of the offset - -1 before the first sample
+	std::atomic<unsigned int> _sample_count;
+
+	std::mutex _samples_lock;
+	std::vector<ClockSample> _samples; // ring of the last samples
+	size_t _next_sample;
+
+public:
+	explicit ExchangeClock(const size_t window = 16);
+
+	ExchangeClock(const ExchangeClock&) = delete;
+	ExchangeClock& operator=(const ExchangeClock&) = delete;
+
+	int64_t local_time() const;
+	unsigned long long timestamp() const;
+
+	void add_sample(const int64_t request_start, const unsigned long long server_time, const int64_t request_end);
+
+	int64_t offset() const;
+	int64_t round_trip() const;
+	unsigned int sample_count() const;
+};
+
+
+template <typename CT>
+class ClockSync : public ExchangeClock
+	// samples 'exchange_time()' of a client (CT) when constructed, then on a timer by a thread of its own -
+	// set on the client with 'rest_set_clock()' to stamp signed requests with the estimate
+{
+private:
+	CT* _client; // not owned
+	const unsigned int _samples_per_round;
+	std::atomic<unsigned int> _sample_errors;
+
+	unsigned int _sync_interval; // seconds
+	std::thread* _sync_thread;
+	std::mutex _sync_lock; // for the timer
+	std::condition_variable _sync_cv;
+	bool _stopped;
+
+	void _sync_loop();
+
+public:
+	ClockSync(CT& client, const unsigned int sync_interval = 60, const unsigned int samples_per_round = 4, const size_t window = 16);
+	~ClockSync();
+
+	bool sync();
+	void stop();
+
+	unsigned int sample_errors() const;
+};
+
+
+#endif
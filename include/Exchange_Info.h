@@ -0,0 +1,199 @@
+#ifndef EXCHANGE_INFO_H
+#define EXCHANGE_INFO_H
+
+
+struct SymbolFilters
+	// the filters of one symbol - prices at the scale of tickSize, quantities at the scale of stepSize
+{
+	bool trading; // status (or contractStatus) is TRADING - symbols removed from exchangeInfo are not trading
+	unsigned int price_scale; // decimals of tickSize
+	unsigned int quantity_scale; // decimals of stepSize
+	Decimal min_price; // PRICE_FILTER
+	Decimal max_price;
+	Decimal tick_size;
+	Decimal min_quantity; // LOT_SIZE
+	Decimal max_quantity;
+	Decimal step_size;
+	Decimal min_notional; // MIN_NOTIONAL (or NOTIONAL), 0 if the symbol has none
+	Decimal bid_multiplier_up; // PERCENT_PRICE_BY_SIDE (or PERCENT_PRICE) - 0 for no bound
+	Decimal bid_multiplier_down;
+	Decimal ask_multiplier_up;
+	Decimal ask_multiplier_down;
+};
+
+
+class SymbolTable
+	// the symbols of exchangeInfo, interned to ids (0, 1, 2...) in the order they were first seen, and their filters
+	// as a struct of arrays indexed by id. ids are kept when the table is updated, so they may be stored by the user
+{
+private:
+	struct Slot
+	{
+		uint64_t hash; // 0 for an empty slot
+		uint32_t id;
+	};
+
+	std::vector<std::string> _names;
+	std::vector<unsigned char> _trading;
+	std::vector<unsigned char> _price_scales;
+	std::vector<unsigned char> _quantity_scales;
+	std::vector<unsigned char> _notional_scales;
+	std::vector<int64_t> _min_prices; // units at the price scale
+	std::vector<int64_t> _max_prices;
+	std::vector<int64_t> _tick_sizes;
+	std::vector<int64_t> _min_quantities; // units at the quantity scale
+	std::vector<int64_t> _max_quantities;
+	std::vector<int64_t> _step_sizes;
+	std::vector<int64_t> _min_notionals; // units at the notional scale
+	std::vector<int64_t> _bid_multipliers_up; // units at MULTIPLIER_SCALE
+	std::vector<int64_t> _bid_multipliers_down;
+	std::vector<int64_t> _ask_multipliers_up;
+	std::vector<int64_t> _ask_multipliers_down;
+
+	std::vector<Slot> _slots; // open addressing, by name - size is a power of 2
+
+	static uint64_t _hash(std::string_view symbol);
+	size_t _find(std::string_view symbol, const uint64_t hash) const;
+	void _grow();
+	uint32_t _intern(std::string_view symbol);
+	void _set(const uint32_t id, const SymbolFilters& filters);
+	bool _equals(const uint32_t id, const SymbolFilters& filters) const;
+
+	static std::string_view _read_value(simdjson::dom::object filter, std::string_view key, Decimal& value);
+
+public:
+	static const uint32_t NOT_FOUND = UINT32_MAX;
+	static const unsigned int MULTIPLIER_SCALE = 8;
+
+	using SymbolRows = std::vector<std::pair<std::string_view, SymbolFilters>>; // views into the response
+
+	SymbolTable();
+
+	static bool read_symbols(const RestResponse& exchange_info, SymbolRows& rows);
+	bool differs(const SymbolRows& rows) const;
+	void assign(const SymbolRows& rows);
+
+	size_t size() const;
+	uint32_t id(std::string_view symbol) const;
+	const std::string& name(const uint32_t id) const;
+
+	bool trading(const uint32_t id) const;
+	unsigned int price_scale(const uint32_t id) const;
+	unsigned int quantity_scale(const uint32_t id) const;
+	Decimal tick_size(const uint32_t id) const;
+	Decimal step_size(const uint32_t id) const;
+	SymbolFilters filters(const uint32_t id) const;
+};
+
+
+class SymbolIndex
+	// holds the current 'SymbolTable' - tables are immutable, replaced as a whole (copy-on-write) and read without a lock
+{
+private:
+	std::shared_ptr<const SymbolTable> _table; // read and replaced with std::atomic_load / std::atomic_store
+	std::atomic<unsigned int> _table_version;
+
+protected:
+	void _publish(std::shared_ptr<const SymbolTable> table);
+
+public:
+	SymbolIndex();
+
+	SymbolIndex(const SymbolIndex&) = delete;
+	SymbolIndex& operator=(const SymbolIndex&) = delete;
+
+	std::shared_ptr<const SymbolTable> table() const;
+	uint32_t id(std::string_view symbol) const;
+	bool filters(std::string_view symbol, SymbolFilters& filters) const;
+
+	unsigned int version() const;
+};
+
+
+template <typename CT>
+class ExchangeInfoIndex : public SymbolIndex
+	// the 'SymbolTable' of 'exchange_info()' of a client (CT) - loaded when constructed, then refreshed on a timer by a thread of its own.
+	// a refresh publishes a new table only if a symbol changed
+{
+private:
+	CT* _client; // not owned
+	std::atomic<unsigned int> _refresh_errors;
+
+	unsigned int _refresh_interval; // seconds
+	std::thread* _refresh_thread;
+	std::mutex _refresh_lock; // for the timer
+	std::condition_variable _refresh_cv;
+	bool _stopped;
+	std::mutex _update_lock; // one refresh at a time
+
+	void _refresh_loop();
+
+public:
+	ExchangeInfoIndex(CT& client, const unsigned int refresh_interval = 3600);
+	~ExchangeInfoIndex();
+
+	bool refresh();
+	void stop();
+
+	unsigned int refresh_errors() const;
+};
+
+
+enum class OrderValidationPolicy
+{
+	reject, // an order failing a filter throws 'OrderRejected', and is not sent
+	normalize // prices are rounded to the tick size (down for buys, up for sells) and quantities down to the step size, then checked
+};
+
+
+class OrderValidator
+	// checks orders against the filters of a 'SymbolIndex' before they are sent - set on a client with 'rest_set_order_validator()'.
+	// PERCENT_PRICE is checked only for symbols with a reference price ('set_reference_price()', i.e: the average price or mark price)
+{
+private:
+	struct OrderFields
+	{
+		std::string_view symbol;
+		bool buy;
+		Decimal price; // 0 if not set
+		Decimal stop_price;
+		Decimal stop_limit_price; // OCO orders
+		Decimal quantity;
+	};
+
+	const SymbolIndex* _index; // not owned
+	const OrderValidationPolicy _policy;
+	std::atomic<int64_t>* _reference_prices; // by symbol id, units at REFERENCE_SCALE - 0 if not set
+	const size_t _max_symbols;
+
+	const char* _check_order(const SymbolTable& table, OrderFields& order) const;
+	const char* _check_price(const SymbolFilters& filters, const bool buy, Decimal& price) const;
+	const char* _check_quantity(const SymbolFilters& filters, Decimal& quantity) const;
+	const char* _check_percent_price(const uint32_t symbol_id, const SymbolFilters& filters, const bool buy, const Decimal& price) const;
+
+	static bool _read_order(const Params* params_ptr, OrderFields& order);
+	static bool _read_order(simdjson::dom::object order_object, OrderFields& order);
+	static Decimal _round(const Decimal& value, const unsigned int scale, const bool up);
+	static bool _below_notional(const Decimal& price, const Decimal& quantity, const Decimal& min_notional);
+#ifdef __SIZEOF_INT128__
+	static int _compare_scaled(__int128 left, unsigned int left_scale, __int128 right, unsigned int right_scale);
+#endif
+
+public:
+	static const unsigned int REFERENCE_SCALE = 8; // decimals kept of reference prices
+
+	OrderValidator(const SymbolIndex& index, const OrderValidationPolicy policy = OrderValidationPolicy::reject, const size_t max_symbols = 8192);
+	~OrderValidator();
+
+	OrderValidator(const OrderValidator&) = delete;
+	OrderValidator& operator=(const OrderValidator&) = delete;
+
+	void set_reference_price(const uint32_t symbol_id, const Decimal& price);
+	bool set_reference_price(std::string_view symbol, const Decimal& price);
+
+	const Params* validate_order(const Params* params_ptr) const;
+	const Params* validate_batch_orders(const Params* params_ptr) const;
+};
+
+
+#endif
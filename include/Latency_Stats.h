@@ -0,0 +1,76 @@
+#ifndef LATENCY_STATS_H
+#define LATENCY_STATS_H
+
+
+struct LatencySnapshot
+	// the summary of a histogram at one point
+{
+	uint64_t count;
+	uint64_t min;
+	double mean;
+	uint64_t p50;
+	uint64_t p90;
+	uint64_t p99;
+	uint64_t p999;
+	uint64_t max;
+};
+
+class LatencyHistogram
+	// a log-linear (HDR-style) histogram of microseconds - recorded without locks, from any thread
+	// values are exact up to 32, then kept within ~3% (32 sub-buckets per power of 2), up to ~12.7 days
+{
+public:
+	static const unsigned int SUB_BUCKET_BITS = 5;
+	static const unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static const unsigned int MAX_VALUE_BITS = 40;
+	static const unsigned int BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+private:
+	std::atomic<uint64_t> _counts[BUCKET_COUNT];
+	std::atomic<uint64_t> _total;
+	std::atomic<uint64_t> _sum;
+	std::atomic<uint64_t> _min;
+	std::atomic<uint64_t> _max;
+
+	static unsigned int _bucket_of(const uint64_t value);
+	static uint64_t _highest_value_of(const unsigned int bucket);
+
+public:
+	LatencyHistogram();
+
+	LatencyHistogram(const LatencyHistogram&) = delete;
+	LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+	void record(const uint64_t value);
+	void reset();
+
+	uint64_t count() const;
+	uint64_t min() const;
+	uint64_t max() const;
+	double mean() const;
+	uint64_t percentile(const double percentile) const;
+
+	LatencySnapshot snapshot() const;
+	std::string summary() const;
+};
+
+
+struct StreamLatency
+	// latency of the messages of a stream, in microseconds
+{
+	LatencyHistogram exchange_to_receive; // event time of the exchange ("E") to the socket read - includes the offset between the clocks
+	LatencyHistogram receive_to_callback; // the socket read to the call of the functor
+	LatencyHistogram callback; // duration of the functor (including the decoding of typed events)
+
+	void record_receive(std::string_view message);
+	void record_callback(const std::chrono::steady_clock::time_point received, const std::chrono::steady_clock::time_point callback_start,
+		const std::chrono::steady_clock::time_point callback_end);
+	void reset();
+
+	std::string report() const;
+
+	static uint64_t event_time(std::string_view message);
+};
+
+
+#endif
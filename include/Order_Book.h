@@ -0,0 +1,128 @@
+#ifndef ORDER_BOOK_H
+#define ORDER_BOOK_H
+
+
+struct BestBidAsk
+{
+	Decimal bid_price; // 0 if the side is empty
+	Decimal bid_quantity;
+	Decimal ask_price; // 0 if the side is empty
+	Decimal ask_quantity;
+	uint64_t update_id; // final update id of the last applied event (or of the snapshot)
+};
+
+
+enum class BookUpdateResult
+{
+	applied,
+	stale, // older than the book - skipped
+	gap // updates were missed - the book must be synced again
+};
+
+
+class BookSide
+	// the levels of one side in a sorted contiguous array, with the best level at the back -
+	// most updates are near the top of the book, so few levels are moved by an insert or erase
+{
+private:
+	std::vector<PriceLevel> _levels;
+	const bool _bids; // ascending prices (best bid at the back), else descending (best ask at the back)
+
+public:
+	explicit BookSide(const bool bids);
+
+	void update(const Decimal& price, const Decimal& quantity);
+	void assign(std::vector<PriceLevel>& levels);
+	void clear();
+	size_t size() const;
+
+	PriceLevel best() const;
+	void top(const size_t depth, std::vector<PriceLevel>& levels) const;
+};
+
+
+class L2Book
+	// a price level book of one symbol, synced with diff depth events by their update ids -
+	// spot: U / u, futures: U / u / pu. written by one thread (the stream), read from any thread:
+	// the best bid / ask are published with a seqlock and read without a lock, deeper levels are read under a lock
+{
+private:
+	BookSide _bids;
+	BookSide _asks;
+	const bool _futures;
+	uint64_t _last_update_id; // u of the last applied event, or 'lastUpdateId' of the snapshot
+	bool _first_update; // no event was applied since the snapshot
+	mutable std::mutex _book_lock; // guards the sides - not taken by 'best_bid_ask()'
+
+	alignas(64) std::atomic<uint64_t> _sequence; // odd while the best bid / ask are written
+	std::atomic<int64_t> _best_units[4]; // bid price, bid quantity, ask price, ask quantity
+	std::atomic<unsigned int> _best_scales[4];
+	std::atomic<uint64_t> _update_id;
+
+	void _publish();
+	static bool _load_levels(simdjson::dom::element levels, BookSide& side);
+
+public:
+	explicit L2Book(const bool futures);
+
+	L2Book(const L2Book&) = delete;
+	L2Book& operator=(const L2Book&) = delete;
+
+	bool load_snapshot(const RestResponse& snapshot);
+	BookUpdateResult apply(const DepthUpdateEvent& depth_update);
+	void clear();
+
+	BestBidAsk best_bid_ask() const;
+	void bids(const size_t depth, std::vector<PriceLevel>& levels) const;
+	void asks(const size_t depth, std::vector<PriceLevel>& levels) const;
+	uint64_t last_update_id() const;
+};
+
+
+template <typename CT>
+class OrderBook
+	// the functor of 'stream_depth_diff()' for one symbol, of a spot, USDT futures or COIN futures client (CT) -
+	// events are buffered while a snapshot is fetched asynchronously ('order_book()'), then applied in sequence.
+	// the book is synced again (new snapshot) when a gap in the update ids is found
+{
+private:
+	CT* _client; // not owned
+	const std::string _symbol;
+	const unsigned int _snapshot_limit;
+	L2Book _book;
+
+	std::atomic<bool> _synced;
+	std::atomic<unsigned int> _resync_count;
+	std::future<RestResponse> _snapshot; // valid while a snapshot is fetched
+	std::vector<DepthUpdateEvent> _buffered_updates; // until the snapshot is loaded
+
+	unsigned int _failed_snapshots; // since the book was last synced - the interval between snapshots doubles with each
+	std::chrono::steady_clock::time_point _last_snapshot_request;
+
+	void _request_snapshot();
+	void _sync();
+	void _resync();
+
+public:
+	static const unsigned int SNAPSHOT_MIN_INTERVAL_MS = 250; // between two snapshot requests
+	static const unsigned int SNAPSHOT_MAX_INTERVAL_MS = 30000; // backoff cap after failed snapshots
+
+	OrderBook(CT& client, const std::string& symbol, const unsigned int snapshot_limit = 1000);
+
+	OrderBook(const OrderBook&) = delete;
+	OrderBook& operator=(const OrderBook&) = delete;
+
+	void operator()(const DepthUpdateEvent& depth_update);
+
+	bool synced() const;
+	unsigned int resync_count() const;
+	const std::string& symbol() const;
+
+	BestBidAsk best_bid_ask() const;
+	void bids(const size_t depth, std::vector<PriceLevel>& levels) const;
+	void asks(const size_t depth, std::vector<PriceLevel>& levels) const;
+	const L2Book& book() const;
+};
+
+
+#endif
@@ -1,6 +1,278 @@
 #ifndef REST_CLIENT_H
 #define REST_CLIENT_H
 
+class CurlHandlePool
+	// easy handles duplicated from a template handle, handed out one request at a time
+{
+private:
+	CURL* _template_handle; // not owned - options are duplicated from it
+	CURLSH* _share_handle; // not owned - not inherited by duplicated handles
+	std::vector<CURL*> _handles; // all handles owned by the pool
+	std::vector<CURL*> _idle_handles; // handles ready for checkout
+	std::unordered_map<CURL*, unsigned int> _handle_versions; // options version of each handle
+	unsigned int _options_version; // incremented by 'set_option()'
+	std::mutex _pool_lock;
+	std::condition_variable _handle_returned;
+	unsigned int _max_size; // max number of handles, 0 for unlimited
+
+	CURL* _duplicate_template();
+	CURL* _refresh_handle(CURL* handle);
+
+public:
+	CurlHandlePool(CURL* template_handle, CURLSH* share_handle, const unsigned int max_size = 0);
+
+	CURL* checkout();
+	void checkin(CURL* handle);
+	unsigned int size();
+
+	void set_max_size(const unsigned int max_size);
+	unsigned int max_size() const;
+
+	template <typename OT>
+	void set_option(const CURLoption option, OT value);
+
+	void cleanup();
+
+	~CurlHandlePool();
+};
+
+
+class ParserPool
+	// parsers are reused between responses instead of allocated per request
+{
+private:
+	std::vector<simdjson::dom::parser*> _idle_parsers;
+	mutable std::mutex _pool_lock;
+	unsigned int _capacity; // max number of idle parsers kept
+	unsigned int _leased;
+	unsigned int _high_water_mark; // max number of parsers leased at the same time
+
+public:
+	explicit ParserPool(const unsigned int capacity = 16);
+
+	simdjson::dom::parser* acquire();
+	void release(simdjson::dom::parser* parser);
+
+	void set_capacity(const unsigned int capacity);
+	unsigned int capacity() const;
+	unsigned int leased() const;
+	unsigned int high_water_mark() const;
+
+	~ParserPool();
+};
+
+
+class RestResponse
+	// a parsed REST response - holds the parser of the document until destroyed
+{
+private:
+	simdjson::dom::parser* _parser;
+	ParserPool* _pool;
+	simdjson::dom::element _json;
+
+	void _release();
+
+public:
+	RestResponse();
+	RestResponse(ParserPool* pool, const std::string& raw_response);
+	RestResponse(RestResponse&& response_obj) noexcept;
+	RestResponse& operator=(RestResponse&& response_obj) noexcept;
+
+	RestResponse(const RestResponse&) = delete;
+	RestResponse& operator=(const RestResponse&) = delete;
+
+	simdjson::simdjson_result<simdjson::dom::element> operator[](std::string_view key) const;
+	simdjson::simdjson_result<simdjson::dom::element> at(const size_t index) const;
+	simdjson::simdjson_result<simdjson::dom::element> at_pointer(std::string_view json_pointer) const;
+
+	simdjson::dom::element get() const&; // valid only while this object lives
+	simdjson::dom::element get() const&& = delete;
+
+	bool empty() const;
+	bool is_null() const;
+
+	friend std::ostream& operator<<(std::ostream& out, const RestResponse& response);
+
+	~RestResponse();
+};
+
+
+enum class RestRequestType
+{
+	get_request,
+	post_request,
+	put_request,
+	delete_request
+};
+
+
+class RestSession;
+
+struct RestRequest
+	// a request built (and signed) but not sent - i.e: 'Client::new_order_request()', sent with 'Client::async_req()'
+{
+	std::string full_path; // copied out of the query buffer of the thread, so it stays valid after other requests are built
+	RestRequestType request_type;
+	RestSession* session; // the session of the client that built it
+};
+
+
+enum class RateLimitPolicy
+{
+	none, // no client-side limiting - used weight is still tracked from response headers
+	block, // wait until the request fits the limits
+	priority_queue, // wait until the request fits the limits, cancels first, then orders, then the rest
+	reject // throw RateLimitExceeded if the request does not fit the limits
+};
+
+
+class TokenBucket
+	// tokens refill continuously up to the capacity, over the interval of the limit
+{
+private:
+	double _capacity;
+	double _tokens;
+	double _refill_per_ms;
+	std::chrono::steady_clock::time_point _last_refill;
+
+public:
+	TokenBucket(const unsigned int capacity, const unsigned int interval_ms);
+
+	void set_limit(const unsigned int capacity, const unsigned int interval_ms);
+	void refill(const std::chrono::steady_clock::time_point now);
+	bool available(double amount) const;
+	void consume(double amount);
+	void reconcile(const unsigned int used); // sync with the usage reported by the exchange
+	std::chrono::milliseconds wait_time(double amount) const;
+};
+
+
+class RateLimiter
+	// admission of REST requests by the weight of their endpoint, synced with the X-MBX-* headers of responses
+{
+private:
+	struct EndpointWeight
+	{
+		unsigned int weight;
+		unsigned int weight_no_symbol; // weight when sent without a symbol (all symbols)
+		bool is_order; // counts towards the order limits
+	};
+	static const std::unordered_map<std::string, EndpointWeight> _ENDPOINT_WEIGHTS;
+
+	std::atomic<RateLimitPolicy> _policy; // read without the lock on the fast path (none)
+	TokenBucket _weight_bucket; // request weight per minute
+	TokenBucket _order_bucket; // orders per 10 seconds
+	std::chrono::steady_clock::time_point _banned_until; // set by 'Retry-After' (429 / 418 responses)
+	unsigned int _waiting[3]; // number of waiting requests per priority
+
+	std::unordered_map<std::string, unsigned int> _used_weight; // as reported, by interval (i.e: "1m")
+	std::unordered_map<std::string, unsigned int> _order_count; // as reported, by interval (i.e: "10s")
+
+	std::mutex _limiter_lock;
+	std::condition_variable _limiter_cv;
+
+	static unsigned int _priority_of(const RestRequestType request_type);
+	bool _fits(const unsigned int weight, const bool is_order, const unsigned int priority, const std::chrono::steady_clock::time_point now);
+	std::chrono::milliseconds _wait_time(const unsigned int weight, const bool is_order, const std::chrono::steady_clock::time_point now) const;
+
+public:
+	RateLimiter();
+
+	void set_policy(const RateLimitPolicy policy);
+	RateLimitPolicy policy() const;
+	void set_limits(const unsigned int weight_per_minute, const unsigned int orders_per_10s);
+
+	void acquire(std::string_view full_path, const RestRequestType request_type);
+	bool try_acquire(std::string_view full_path, const RestRequestType request_type, const std::chrono::steady_clock::time_point deadline, bool& waiting, std::chrono::milliseconds& wait_time);
+	void cancel_wait(const RestRequestType request_type);
+	void update_from_header(std::string_view header);
+
+	unsigned int used_weight(const std::string& interval = "1m");
+	unsigned int order_count(const std::string& interval = "10s");
+
+	static unsigned int endpoint_weight(std::string_view full_path, const RestRequestType request_type, bool& is_order);
+	static std::chrono::steady_clock::time_point deadline_of(std::string_view full_path, const std::chrono::steady_clock::time_point now);
+};
+
+
+struct EndpointStats
+	// timings of the requests of one endpoint in microseconds, and their outcome - recorded without locks, except for errors
+{
+	const RestRequestType request_type;
+	const std::string path; // without the host and the query
+
+	LatencyHistogram dns; // new connections only
+	LatencyHistogram connect; // new connections only
+	LatencyHistogram tls; // new connections only
+	LatencyHistogram first_byte; // from the start of the request
+	LatencyHistogram total;
+
+	std::atomic<uint64_t> requests;
+	std::atomic<uint64_t> new_connections;
+	std::atomic<uint64_t> transport_errors; // no response (curl error) - not timed
+	std::atomic<uint64_t> http_errors; // HTTP status >= 400
+
+	std::mutex errors_lock;
+	std::unordered_map<long, uint64_t> error_statuses; // by HTTP status
+	std::unordered_map<int, uint64_t> error_codes; // by the "code" of the error response
+
+	EndpointStats(const RestRequestType request_type, std::string_view path);
+	void reset();
+};
+
+
+struct EndpointSnapshot
+	// the stats of one endpoint at one point
+{
+	std::string endpoint; // method and path, i.e: "POST /api/v3/order"
+	uint64_t requests;
+	uint64_t new_connections;
+	uint64_t transport_errors;
+	uint64_t http_errors;
+	std::unordered_map<long, uint64_t> error_statuses;
+	std::unordered_map<int, uint64_t> error_codes;
+
+	LatencySnapshot dns;
+	LatencySnapshot connect;
+	LatencySnapshot tls;
+	LatencySnapshot first_byte;
+	LatencySnapshot total;
+};
+
+
+class RestStats
+	// timings and outcomes of REST requests by endpoint - recorded from the handle after each transfer
+{
+private:
+	static const size_t _ENDPOINT_SLOTS = 512; // a power of 2 - endpoints past half of it are found under the lock
+
+	std::unordered_map<std::string, EndpointStats*> _endpoints; // owned, by method and path - kept until destroyed
+	mutable std::mutex _stats_lock; // guards the map only
+
+	std::atomic<EndpointStats*> _endpoint_slots[_ENDPOINT_SLOTS]; // open addressing by method and path, so requests find their endpoint without locks
+	size_t _used_slots; // guarded by the lock
+
+	EndpointStats* _endpoint_of(std::string_view full_path, const RestRequestType request_type);
+	EndpointStats* _add_endpoint(std::string_view path, const RestRequestType request_type, const size_t path_hash);
+	static size_t _slot_of(std::string_view path, const RestRequestType request_type);
+	static int _error_code(std::string_view response);
+
+public:
+	RestStats();
+
+	RestStats(const RestStats&) = delete;
+	RestStats& operator=(const RestStats&) = delete;
+
+	void record(CURL* handle, const RestRequestType request_type, const CURLcode result, std::string_view response);
+
+	std::vector<EndpointSnapshot> snapshot() const;
+	std::string report() const;
+	void reset();
+
+	~RestStats();
+};
+
+
 class RestSession
 {
 private:
@@ -9,43 +281,96 @@ private:
 	{
 		RequestHandler();
 		std::string req_raw;
-		simdjson::dom::element req_json;
 		CURLcode req_status;
-		std::unique_lock<std::mutex>* locker;
 		RestSession* session;
 	};
 
+	struct AsyncRequest // a request in flight on the event loop
+	{
+		RequestHandler request;
+		CURL* handle;
+		CurlHandlePool* pool; // the pool the handle is returned to
+		RestRequestType request_type;
+		std::promise<RestResponse> response_promise;
+		std::function<void(RestResponse&)> callback; // used instead of the promise if set
+		bool admitted; // by the rate limiter - admitted on the event loop if not set
+		bool waiting; // counted as waiting by the rate limiter
+		std::chrono::steady_clock::time_point deadline; // to be admitted by - the recvWindow of signed requests
+		std::string full_path; // set only if not admitted yet
+	};
+
+	CURLSH* _share_handle{}; // DNS and TLS session caches shared by all handles - each handle keeps its own connection
+	std::mutex _share_locks[CURL_LOCK_DATA_LAST];
+
+	CURLM* _multi_handle{};
+	std::thread* _event_loop_thread{};
+	std::atomic<std::thread::id> _event_loop_id; // sync requests from it are refused
+	std::atomic<bool> _event_loop_running;
+	std::mutex _async_lock;
+	std::vector<AsyncRequest*> _async_queue; // submitted, not yet added to the multi handle
+	bool _closing{}; // set by 'close()' under '_async_lock' - no request is submitted after it
+
+	RestResponse _perform(const std::string& full_path, const RestRequestType request_type);
+	std::future<RestResponse> _submit_future(const std::string& full_path, const RestRequestType request_type);
+
+	std::atomic<bool> _http2_mode; // all requests are multiplexed on the event loop
+	bool _http2_multi_options; // mode applied to the multi handle - owned by the event loop thread
+
+	CurlHandlePool* _pool_of(const RestRequestType request_type);
+	AsyncRequest* _new_async_request(const std::string& full_path, const RestRequestType request_type);
+	AsyncRequest* _new_admitted_request(const std::string& full_path, const RestRequestType request_type);
+	void _submit_async_request(AsyncRequest* async_request);
+	void _complete_async_request(AsyncRequest* async_request, const CURLcode result);
+	void _event_loop();
+	void _set_multi_options();
+	void _stop_event_loop();
+
 
 public:
 	RestSession();
 
 	bool status; // bool for whether session is active or not
 
-	CURL* _get_handle{};
+	CURL* _get_handle{}; // templates of the pools, one per request type
 	CURL* _post_handle{};
 	CURL* _put_handle{};
 	CURL* _delete_handle{};
 
-	simdjson::dom::element _getreq(std::string full_path);
+	CurlHandlePool* _get_pool{};
+	CurlHandlePool* _post_pool{};
+	CurlHandlePool* _put_pool{};
+	CurlHandlePool* _delete_pool{};
+	ParserPool _parser_pool;
+	RateLimiter _rate_limiter;
+	RestStats _stats;
+
+	RestResponse _getreq(const std::string& full_path);
 	void get_timeout(unsigned long interval);
-	std::mutex _get_lock;
 
-	simdjson::dom::element _postreq(std::string full_path);
+	RestResponse _postreq(const std::string& full_path);
 	void post_timeout(unsigned long interval);
-	std::mutex _post_lock;
 
-	simdjson::dom::element _putreq(std::string full_path);
+	RestResponse _putreq(const std::string& full_path);
 	void put_timeout(unsigned long interval);
-	std::mutex _put_lock;
 
-	simdjson::dom::element _deletereq(std::string full_path);
+	RestResponse _deletereq(const std::string& full_path);
 	void delete_timeout(unsigned long interval);
-	std::mutex _delete_lock;
+
+	std::future<RestResponse> _asyncreq(const std::string& full_path, const RestRequestType request_type);
+	void _asyncreq(const std::string& full_path, const RestRequestType request_type, std::function<void(RestResponse&)> callback);
+
+	void set_headers(struct curl_slist* headers);
+	void set_max_connections(const unsigned int max_connections);
+	bool set_http2(const bool state);
+	bool http2_mode() const;
 
 	bool close();
 	void set_verbose(const long int state);
 
 	friend unsigned int _REQ_CALLBACK(void* contents, unsigned int size, unsigned int nmemb, RestSession::RequestHandler* req);
+	friend size_t _HEADER_CALLBACK(char* buffer, size_t size, size_t nitems, RestSession::RequestHandler* req);
+	friend void _SHARE_LOCK_CALLBACK(CURL* handle, curl_lock_data data, curl_lock_access access, void* session);
+	friend void _SHARE_UNLOCK_CALLBACK(CURL* handle, curl_lock_data data, void* session);
 
 	~RestSession();
 };
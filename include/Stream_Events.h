@@ -0,0 +1,149 @@
+#ifndef STREAM_EVENTS_H
+#define STREAM_EVENTS_H
+
+// typed events of market streams - a functor accepting one of them is passed the decoded event instead of the message
+// std::string_view members point into the parser, and are valid only during the call
+// prices and quantities are Decimals at the scale of the message (i.e: "27100.10" -> 2710010 units of 0.01)
+
+
+struct PriceLevel
+{
+	Decimal price;
+	Decimal quantity;
+};
+
+
+struct AggTradeEvent
+	// <symbol>@aggTrade
+{
+	uint64_t event_time;
+	std::string_view symbol;
+	uint64_t aggregate_trade_id;
+	Decimal price;
+	Decimal quantity;
+	uint64_t first_trade_id;
+	uint64_t last_trade_id;
+	uint64_t trade_time;
+	bool buyer_is_maker;
+};
+
+
+struct TradeEvent
+	// <symbol>@trade
+{
+	uint64_t event_time;
+	std::string_view symbol;
+	uint64_t trade_id;
+	Decimal price;
+	Decimal quantity;
+	uint64_t trade_time;
+	bool buyer_is_maker;
+};
+
+
+struct KlineEvent
+	// <symbol>@kline_<interval>
+{
+	uint64_t event_time;
+	std::string_view symbol;
+	std::string_view interval;
+	uint64_t start_time;
+	uint64_t close_time;
+	int64_t first_trade_id; // -1 if no trades
+	int64_t last_trade_id; // -1 if no trades
+	Decimal open;
+	Decimal close;
+	Decimal high;
+	Decimal low;
+	Decimal volume;
+	Decimal quote_volume;
+	Decimal taker_buy_volume;
+	Decimal taker_buy_quote_volume;
+	uint64_t trades;
+	bool closed;
+};
+
+
+struct BookTickerEvent
+	// <symbol>@bookTicker, !bookTicker
+{
+	uint64_t update_id;
+	std::string_view symbol;
+	Decimal bid_price;
+	Decimal bid_quantity;
+	Decimal ask_price;
+	Decimal ask_quantity;
+	uint64_t event_time; // 0 for spot
+	uint64_t transaction_time; // 0 for spot
+};
+
+
+struct DepthUpdateEvent
+	// <symbol>@depth, <symbol>@depth<levels> - the levels keep their capacity between messages
+{
+	uint64_t event_time; // 0 for spot partial depth
+	uint64_t transaction_time; // futures only
+	std::string_view symbol; // empty for spot partial depth
+	uint64_t first_update_id;
+	uint64_t final_update_id; // 'lastUpdateId' of spot partial depth
+	uint64_t previous_final_update_id; // futures only
+	std::vector<PriceLevel> bids;
+	std::vector<PriceLevel> asks;
+};
+
+
+struct MarkPriceEvent
+	// <symbol>@markPrice, !markPrice@arr (each element)
+{
+	uint64_t event_time;
+	std::string_view symbol;
+	Decimal mark_price;
+	Decimal index_price;
+	Decimal estimated_settle_price;
+	Decimal funding_rate;
+	uint64_t next_funding_time;
+};
+
+
+struct ForceOrderEvent
+	// <symbol>@forceOrder, !forceOrder@arr
+{
+	uint64_t event_time;
+	std::string_view symbol;
+	std::string_view side;
+	std::string_view order_type;
+	std::string_view time_in_force;
+	Decimal quantity;
+	Decimal price;
+	Decimal average_price;
+	std::string_view status;
+	Decimal last_filled_quantity;
+	Decimal filled_quantity;
+	uint64_t trade_time;
+};
+
+
+class EventDecoder
+	// decodes stream messages into typed events with the simdjson ondemand api - one parser per thread, no allocations
+	// once the parser (and the levels of depth events) are warm
+{
+private:
+	static thread_local simdjson::ondemand::parser _parser;
+
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, AggTradeEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, TradeEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, KlineEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, BookTickerEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, DepthUpdateEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, MarkPriceEvent& event);
+	static simdjson::error_code _decode(simdjson::ondemand::object& object, ForceOrderEvent& event);
+	static simdjson::error_code _decode_decimal(simdjson::simdjson_result<simdjson::ondemand::raw_json_string> raw_result, Decimal& decimal);
+	static simdjson::error_code _decode_levels(simdjson::ondemand::value& value, std::vector<PriceLevel>& levels);
+
+public:
+	template <typename ET, typename FT>
+	static size_t dispatch(std::string& message, FT& functor);
+};
+
+
+#endif
@@ -2,6 +2,331 @@
 #define WS_CLIENT_H
 
 
+class WebsocketContextPool
+	// io_contexts shared by async websocket streams - each context is run by its own thread
+	// must outlive the clients using it
+{
+private:
+	std::vector<net::io_context*> _contexts;
+	std::vector<net::executor_work_guard<net::io_context::executor_type>*> _work_guards; // keep the contexts running while idle
+	std::vector<std::thread*> _threads;
+	std::atomic<unsigned int> _next_context; // round robin
+	ssl::context _ssl_context; // shared by all streams of the pool
+
+public:
+	explicit WebsocketContextPool(const unsigned int threads = 1);
+
+	WebsocketContextPool(const WebsocketContextPool&) = delete;
+	WebsocketContextPool& operator=(const WebsocketContextPool&) = delete;
+
+	net::io_context& next_context();
+	ssl::context& ssl_context();
+	unsigned int size() const;
+
+	void stop();
+
+	~WebsocketContextPool();
+};
+
+
+struct ReceiveBufferPolicy
+	// the capacity a receive buffer keeps between messages - messages are read into the reserved capacity,
+	// followed by at least SIMDJSON_PADDING bytes, so a view of the message can be parsed without a copy
+{
+	size_t reserve; // reserved before the first message, and after shrinking
+	size_t max_capacity; // a buffer grown beyond it by a large message is shrunk back to 'reserve'
+
+	ReceiveBufferPolicy(const size_t reserve = 4096, const size_t max_capacity = 65536);
+
+	void prepare(std::string& buffer) const;
+	void pad(std::string& buffer) const;
+	void recycle(std::string& buffer) const;
+};
+
+template <typename FT>
+void invoke_stream_callback(FT& functor, std::string& message);
+
+
+class AsyncStream : public std::enable_shared_from_this<AsyncStream>
+	// a websocket stream driven by the completion handlers of one context of the pool
+	// all members except '_running' are accessed only from the thread of the context
+{
+private:
+	net::io_context& _ioc;
+	ssl::context& _ssl_context;
+	tcp::resolver _resolver;
+	net::steady_timer _reconnect_timer;
+	websocket::stream<beast::ssl_stream<tcp::socket>>* _ws; // recreated on reconnect
+
+	std::string _host;
+	std::string _port;
+	std::string _path;
+	std::string& _buffer;
+	net::dynamic_string_buffer<char, std::char_traits<char>, std::allocator<char>> _read_buffer; // over '_buffer', consumed after each message
+	ReceiveBufferPolicy _receive_buffer;
+	std::shared_ptr<StreamLatency> _latency; // null if not measured
+
+	std::function<void(std::string&)> _on_message;
+	std::function<void(AsyncStream*)> _on_close; // called once, when the stream is done
+	std::function<void()> _on_open; // called after each handshake, before reading (optional)
+
+	std::deque<std::string> _write_queue; // messages to the server, written one at a time
+	bool _connected; // the handshake of the current connection is done
+
+	bool _gzip_conversion;
+	bool _awaiting_conversion; // until the reply to the BINARY request is read
+	bool _reconnect_on_error;
+	unsigned int _max_reconnect_count;
+	unsigned int _reconnect_attempts;
+
+	std::atomic<bool> _running;
+	bool _closing;
+	bool _finished;
+	bool _open_reported;
+	std::promise<bool> _opened;
+
+	void _connect();
+	void _on_resolve(beast::error_code ec, tcp::resolver::results_type results);
+	void _on_connect(beast::error_code ec, tcp::resolver::results_type::endpoint_type endpoint);
+	void _on_ssl_handshake(beast::error_code ec);
+	void _on_handshake(beast::error_code ec);
+	void _read();
+	void _on_read(beast::error_code ec, size_t bytes_transferred);
+	void _write();
+	void _close(const websocket::close_code code);
+	void _fail();
+	void _finish();
+
+public:
+	AsyncStream(WebsocketContextPool* context_pool, const std::string& host, const std::string& port, const std::string& path, std::string& buffer,
+		std::function<void(std::string&)> on_message, std::function<void(AsyncStream*)> on_close,
+		const bool gzip_conversion, const bool reconnect_on_error, const unsigned int max_reconnect_count);
+
+	AsyncStream(const AsyncStream&) = delete;
+	AsyncStream& operator=(const AsyncStream&) = delete;
+
+	void set_on_open(std::function<void()> on_open);
+	void set_receive_buffer(const ReceiveBufferPolicy& receive_buffer);
+	void set_latency(std::shared_ptr<StreamLatency> latency);
+	std::future<bool> start();
+	void send(std::string message);
+	void queue_message(std::string message);
+	void close();
+	bool is_running() const;
+
+	~AsyncStream();
+};
+
+
+class StreamConnection
+	// one connection to the combined stream endpoint - streams are added and removed with SUBSCRIBE / UNSUBSCRIBE,
+	// and messages are dispatched to the handler of their stream. runs on a context pool
+{
+private:
+	std::shared_ptr<AsyncStream> _async_stream;
+	std::string _buffer;
+
+	std::unordered_map<std::string, std::shared_ptr<std::function<void(std::string&)>>> _handlers; // by stream name
+	std::unordered_map<unsigned int, std::vector<std::promise<bool>>> _pending_requests; // by request id, until acknowledged
+	unsigned int _next_request_id;
+	bool _closed; // until opened, and once the connection is done
+	std::mutex _connection_lock;
+	std::condition_variable _connection_closed;
+
+	const std::function<void(std::string&)>* _dispatching; // the handler being called, if any - guarded by the lock
+	std::thread::id _dispatch_thread; // of the handler being called
+	unsigned int _dispatch_waiters; // unsubscribes waiting for the handler to return
+	std::condition_variable _dispatch_done;
+
+	std::string _stream_name; // of the current message - accessed only from the thread of the context
+	simdjson::dom::parser _reply_parser; // accessed only from the thread of the context
+
+	std::future<bool> _subscribe(const std::vector<std::string>& stream_names, std::function<void(std::string&)> handler);
+	unsigned int _new_request(const char* method, const std::vector<std::string>& stream_names, std::string& request);
+	void _on_open();
+	void _on_message(std::string& message);
+	void _end_dispatch();
+	void _on_reply(std::string& message);
+	void _on_close();
+
+public:
+	StreamConnection(WebsocketContextPool* context_pool, const std::string& host, const std::string& port,
+		const bool gzip_conversion, const bool reconnect_on_error, const unsigned int max_reconnect_count);
+
+	StreamConnection(const StreamConnection&) = delete;
+	StreamConnection& operator=(const StreamConnection&) = delete;
+
+	void open();
+	void close();
+	bool is_open() const;
+
+	template <typename FT>
+	std::future<bool> subscribe(const std::string& stream_name, FT& functor);
+	template <typename FT>
+	std::future<bool> subscribe(const std::vector<std::string>& stream_names, FT& functor);
+	std::future<bool> unsubscribe(const std::string& stream_name);
+	std::future<bool> unsubscribe(const std::vector<std::string>& stream_names);
+
+	std::vector<std::string> streams();
+
+	~StreamConnection();
+};
+
+
+class StreamMultiplexer
+	// the functor of a combined stream ({"stream":"<name>","data":<payload>}) - routes a view of the payload to the handler of its stream
+	// handlers are kept in a flat open-addressing table, looked up by a view of the name - no copies, no parsing
+	// not thread safe - handlers should be set before the stream is opened
+{
+private:
+	struct Slot
+	{
+		uint64_t hash; // 0 for an empty slot
+		std::string stream_name;
+		std::function<void(std::string_view)> handler;
+	};
+
+	std::vector<Slot> _slots; // size is a power of 2
+	size_t _size;
+	size_t _unrouted; // messages without a handler, or not of a combined stream
+
+	static uint64_t _hash(std::string_view stream_name);
+	Slot* _find(std::string_view stream_name, const uint64_t hash);
+	void _grow();
+
+public:
+	explicit StreamMultiplexer(const size_t capacity = 16);
+
+	void set_handler(const std::string& stream_name, std::function<void(std::string_view)> handler);
+	bool remove_handler(const std::string& stream_name);
+	size_t size() const;
+	size_t unrouted() const;
+
+	bool dispatch(std::string_view message);
+	void operator()(std::string& message);
+
+	static bool split(std::string_view message, std::string_view& stream_name, std::string_view& data);
+};
+
+
+enum class QueueOverflowPolicy
+{
+	drop_oldest, // the oldest queued message is dropped - the default
+	block, // the stream waits until the consumer makes room - on a context pool, this stalls all streams of the context
+	conflate // only the latest message of each key (stream name, or symbol) is kept until the consumer catches up
+};
+
+
+class StreamQueue
+	// a bounded single producer / single consumer ring of messages - the functor of one stream (producer),
+	// consumed by another thread with 'poll()' (busy-poll) or 'wait()'. messages are decoded by the consumer.
+	// the default policy drops the oldest message when full - 'block' makes the stream wait for the consumer,
+	// which stalls the reads of all streams of the same io_context when the stream runs on a 'WebsocketContextPool'
+{
+private:
+	struct Slot
+	{
+		std::atomic<size_t> sequence; // == position: empty, == position + 1: holds the message of the position
+		std::string message;
+	};
+
+	Slot* _slots;
+	size_t _capacity; // a power of 2
+	const QueueOverflowPolicy _policy;
+
+	alignas(64) std::atomic<size_t> _head; // next position to read - advanced by the consumer (and by the producer when dropping)
+	alignas(64) std::atomic<size_t> _tail; // next position to write - written by the producer only
+	std::atomic<size_t> _dropped;
+	std::atomic<size_t> _conflated;
+
+	alignas(64) std::string _consumer_buffer; // a copy of the message being consumed - consumer only
+	std::vector<std::string> _pending; // conflated messages taken by the consumer - consumer only
+	size_t _pending_index;
+
+	std::mutex _overflow_lock; // guards the conflated messages - not taken while the ring has room
+	std::unordered_map<std::string, size_t> _conflated_keys; // index in '_conflated_messages'
+	std::vector<std::string> _conflated_messages;
+	std::atomic<bool> _conflating; // the producer writes to '_conflated_messages' until the consumer takes them
+
+	std::mutex _wait_lock;
+	std::condition_variable _consumer_cv;
+	std::condition_variable _producer_cv;
+	std::atomic<bool> _consumer_waiting;
+	std::atomic<bool> _producer_waiting;
+	std::atomic<bool> _closed;
+
+	bool _try_push(std::string_view message);
+	bool _drop_oldest();
+	void _conflate(std::string_view message);
+	bool _try_pop();
+	bool _take_conflated();
+	bool _ready() const;
+	void _notify(std::condition_variable& cv, std::atomic<bool>& waiting);
+
+	static std::string_view _key(std::string_view message);
+
+public:
+	explicit StreamQueue(const size_t capacity = 1024, const QueueOverflowPolicy policy = QueueOverflowPolicy::drop_oldest);
+
+	StreamQueue(const StreamQueue&) = delete;
+	StreamQueue& operator=(const StreamQueue&) = delete;
+
+	bool push(std::string_view message);
+	void operator()(std::string& message);
+
+	template <typename FT>
+	bool poll(FT& functor);
+	template <typename FT>
+	bool wait(FT& functor, const std::chrono::milliseconds timeout = std::chrono::milliseconds{ 1000 });
+
+	void close();
+	bool closed() const;
+	size_t size() const;
+	size_t capacity() const;
+	size_t dropped() const;
+	size_t conflated() const;
+
+	~StreamQueue();
+};
+
+
+struct StreamHandle
+	// the state of one stream - the stream holds its handle and checks its flags without a lookup
+{
+	explicit StreamHandle(const std::string& stream_name);
+
+	const std::string name;
+	std::atomic<bool> running; // cleared to close the stream
+	std::atomic<bool> open; // the connection is established
+	std::shared_ptr<AsyncStream> async_stream; // null for blocking streams - set before the handle is added
+	std::shared_ptr<StreamLatency> latency; // null if not measured - set before the handle is added
+};
+
+
+class StreamRegistry
+	// the streams of a websocket client by name - locked only when streams are added, removed, closed or listed
+{
+private:
+	std::unordered_map<std::string, std::shared_ptr<StreamHandle>> _handles;
+	std::vector<std::shared_ptr<StreamHandle>> _replaced_handles; // async streams replaced and closing, kept until done
+	mutable std::mutex _registry_lock;
+	std::condition_variable _handle_removed;
+
+	static void _stop(StreamHandle& handle);
+
+public:
+	void add(std::shared_ptr<StreamHandle> handle);
+	void remove(const std::string& stream_name, const StreamHandle* handle);
+
+	bool stop(const std::string& stream_name);
+	void stop_all();
+	void wait_async_streams();
+
+	bool is_open(const std::string& stream_name) const;
+	std::vector<std::string> open_streams() const;
+};
+
+
 template <typename T>
 class WebsocketClient
 {
@@ -11,9 +336,22 @@ private:
 	unsigned int _gzip_conversion;
 	T* exchange_client; // user client obj
 
+	WebsocketContextPool* _context_pool; // not owned - null for blocking streams (one thread per stream)
+	StreamRegistry _streams;
+	ReceiveBufferPolicy _receive_buffer;
+
+	bool _measure_latency;
+	std::unordered_map<std::string, std::shared_ptr<StreamLatency>> _latency_stats; // by stream name - kept when streams close
+	mutable std::mutex _latency_lock;
+
+	std::vector<StreamConnection*> _connections; // owned
+	std::mutex _connections_lock;
+
+	void _start_async_stream(const std::string& stream_map_name, const std::string& stream_path, std::string& buf, std::function<void(std::string&)> on_message);
+	std::shared_ptr<StreamLatency> _stream_latency(const std::string& stream_map_name);
 
 	template <typename FT>
-	void _connect_to_endpoint(const std::string stream_map_name, const std::string stream_path, std::string& buf, FT& functor, const bool ping_listen_key);
+	void _connect_to_endpoint(StreamHandle& stream_handle, const std::string stream_path, std::string& buf, FT& functor, const bool ping_listen_key);
 
 public:
 	unsigned int _max_reconnect_count;
@@ -21,8 +359,6 @@ public:
 
 	WebsocketClient(T* exchange_client, const std::string host, const unsigned int port);
 
-	std::unordered_map<std::string, bool> running_streams; // will be a map, containing pairs of: <bool(status), ws_stream> 
-
 	void close_stream(const std::string& full_stream_name);
 	std::vector<std::string> open_streams();
 	bool is_open(const std::string& stream_name) const;
@@ -34,6 +370,14 @@ public:
 
 	void set_host_port(const std::string new_host, const unsigned int new_port);
 	void set_gzip_conversion(const unsigned int state);
+	void set_context_pool(WebsocketContextPool* context_pool);
+	void set_receive_buffer(const size_t reserve, const size_t max_capacity);
+	StreamConnection* open_connection();
+
+	void set_latency_stats(const bool state);
+	std::shared_ptr<const StreamLatency> latency_stats(const std::string& stream_name) const;
+	std::string latency_report() const;
+	void reset_latency_stats();
 
 	~WebsocketClient();
 
@@ -43,6 +43,80 @@ inline void Client<T>::ws_auto_reconnect(const bool reconnect)
 	this->_ws_client->_set_reconnect(reconnect);
 }
 
+/**
+	Sets a pool of io_contexts for new streams - streams run on its threads instead of blocking the caller
+	a pool may be shared by several clients, and must outlive them
+	@param context_pool - a pointer to the pool, nullptr for blocking streams
+*/
+template<typename T>
+inline void Client<T>::ws_set_context_pool(WebsocketContextPool* context_pool)
+{
+	this->_ws_client->set_context_pool(context_pool);
+}
+
+/**
+	Sets the capacity kept by the receive buffers of new streams, between messages
+	@param reserve - bytes reserved before the first message (4096 by default)
+	@param max_capacity - a buffer grown beyond it by a large message is shrunk back (65536 by default)
+*/
+template<typename T>
+inline void Client<T>::ws_set_receive_buffer(const size_t reserve, const size_t max_capacity)
+{
+	this->_ws_client->set_receive_buffer(reserve, max_capacity);
+}
+
+/**
+	Opens a connection for subscribing to streams (SUBSCRIBE / UNSUBSCRIBE) - requires a context pool
+	the connection is owned by the client
+	@return a pointer to the open connection
+*/
+template<typename T>
+inline StreamConnection* Client<T>::ws_open_connection()
+{
+	return this->_ws_client->open_connection();
+}
+
+/**
+	Sets whether the latency of new streams is measured (off by default):
+	event time to receive, receive to callback, and callback duration
+	@param state - the state
+*/
+template<typename T>
+inline void Client<T>::ws_set_latency_stats(const bool state)
+{
+	this->_ws_client->set_latency_stats(state);
+}
+
+/**
+	Gets the latency histograms of a stream, in microseconds
+	@param stream_name - the name of the stream
+	@return a pointer to the histograms, null if the stream was not measured
+*/
+template<typename T>
+inline std::shared_ptr<const StreamLatency> Client<T>::ws_latency_stats(const std::string& stream_name) const
+{
+	return this->_ws_client->latency_stats(stream_name);
+}
+
+/**
+	Percentiles (50, 90, 99, 99.9) of the latency of all measured streams, in microseconds
+	@return the report, as text
+*/
+template<typename T>
+inline std::string Client<T>::ws_latency_report() const
+{
+	return this->_ws_client->latency_report();
+}
+
+/**
+	Clears the latency histograms of all streams
+*/
+template<typename T>
+inline void Client<T>::ws_reset_latency_stats()
+{
+	this->_ws_client->reset_latency_stats();
+}
+
 /**
 	Sets the refresh ListenKey interval duration
 	@param val - the interval duration
@@ -111,7 +185,140 @@ inline void ClientException::append_to_traceback(std::string&& loc)
 */
 inline bool Params::empty() const
 {
-	return this->param_map.empty();
+	return !this->_size;
+}
+
+/**
+	Get the number of params set
+	@return the number of params
+*/
+inline size_t Params::size() const
+{
+	return this->_size;
+}
+
+/**
+	Iterate over the params set, in insertion order
+	@return pointer to the first param
+*/
+inline const Params::Param* Params::begin() const
+{
+	return this->_params.data();
+}
+
+/**
+	Iterate over the params set, in insertion order
+	@return pointer past the last param
+*/
+inline const Params::Param* Params::end() const
+{
+	return this->_params.data() + this->_size;
+}
+
+/**
+	Encode a value to its query format
+	integers and floating point numbers are written without loss of precision (no exponent, no trailing zeros),
+	decimals with all decimals of their scale
+	@typename PT - Type of value
+	@param encoded_value - the string to write to (its buffer is reused)
+	@param value - the value
+*/
+template <typename PT>
+inline void Params::_encode(std::string& encoded_value, const PT& value)
+{
+	using VT = std::decay_t<PT>;
+
+	if constexpr (std::is_same_v<VT, bool>)
+	{
+		encoded_value.assign(value ? "true" : "false");
+	}
+	else if constexpr (std::is_integral_v<VT>)
+	{
+		char number_buffer[24];
+		std::to_chars_result result = std::to_chars(number_buffer, number_buffer + sizeof(number_buffer), value);
+		encoded_value.assign(number_buffer, result.ptr - number_buffer);
+	}
+	else if constexpr (std::is_same_v<VT, Decimal>)
+	{
+		char number_buffer[Decimal::MAX_FORMAT_SIZE];
+		encoded_value.assign(number_buffer, value.format(number_buffer));
+	}
+	else if constexpr (std::is_floating_point_v<VT>)
+	{
+		char number_buffer[64];
+		std::to_chars_result result = std::to_chars(number_buffer, number_buffer + sizeof(number_buffer), value, std::chars_format::fixed);
+		if (result.ec != std::errc{}) result = std::to_chars(number_buffer, number_buffer + sizeof(number_buffer), value); // out of the fixed range
+		encoded_value.assign(number_buffer, result.ptr - number_buffer);
+	}
+	else
+	{
+		encoded_value.assign(value); // strings and string literals
+	}
+}
+
+/**
+	Set a new parameter
+	@typename PT - Type of value (strings, string literals, integers, floating point numbers, decimals, bool)
+	@param key - name of parameter
+	@param value - value of parameter to set
+*/
+template <typename PT>
+inline void Params::set_param(const std::string& key, const PT& value)
+{
+	Params::_encode(this->_value_slot(key), value);
+}
+
+/**
+	Set a new parameter
+	@typename PT - Type of value (strings, string literals, integers, floating point numbers, decimals, bool)
+	@param key - name of parameter
+	@param value - value of parameter to set (Move)
+*/
+template <typename PT>
+inline void Params::set_param(const std::string& key, PT&& value)
+{
+	if constexpr (std::is_same_v<std::decay_t<PT>, std::string> && !std::is_lvalue_reference_v<PT>)
+	{
+		std::string& encoded_value = this->_value_slot(key);
+		if (encoded_value.capacity() < value.size()) encoded_value = std::move(value); // no buffer to reuse
+		else encoded_value.assign(value);
+	}
+	else
+	{
+		Params::_encode(this->_value_slot(key), value);
+	}
+}
+
+// QueryBuilder inline methods
+
+/**
+	Get the query of the path
+	@return the query, starting with '?' - empty if no params were appended
+*/
+inline std::string_view QueryBuilder::query() const
+{
+	if (this->_query_start == std::string::npos) return std::string_view{};
+	return std::string_view{ this->_buffer }.substr(this->_query_start);
+}
+
+/**
+	Get the full path
+	@return the full path - valid until the next 'reset()'
+*/
+inline const std::string& QueryBuilder::str() const
+{
+	return this->_buffer;
+}
+
+// OrderTemplate inline methods
+
+/**
+	Get the static query of the template
+	@return the static params, serialized (without the '?')
+*/
+inline std::string_view OrderTemplate::static_query() const
+{
+	return std::string_view{ this->_path_prefix }.substr(this->_query_start);
 }
 
 // Auth utils inline methods
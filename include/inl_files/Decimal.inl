@@ -0,0 +1,94 @@
+#include "../Binance_Client.h"
+
+// Decimal inline methods
+
+/**
+	Default constructor - zero
+*/
+inline Decimal::Decimal()
+	: _units{ 0 }, _scale{ 0 }
+{}
+
+/**
+	Constructor
+	@param units - the value in units of 10^-scale (i.e: 2710010 and 2 for 27100.10)
+	@param scale - number of decimals, up to MAX_SCALE - a larger scale is clamped to MAX_SCALE (the units are kept)
+*/
+inline Decimal::Decimal(const int64_t units, const unsigned int scale)
+	: _units{ units }, _scale{ static_cast<unsigned char>(scale > MAX_SCALE ? MAX_SCALE : scale) }
+{}
+
+/**
+	@return the value in units of 10^-scale
+*/
+inline int64_t Decimal::units() const
+{
+	return this->_units;
+}
+
+/**
+	@return the number of decimals
+*/
+inline unsigned int Decimal::scale() const
+{
+	return this->_scale;
+}
+
+/**
+	@return a bool for whether the value is 0
+*/
+inline bool Decimal::is_zero() const
+{
+	return !this->_units;
+}
+
+/**
+	Compare two values - the units are compared directly if the scales are the same,
+	else the integer parts, then the fractions at the larger scale (both below 10^18)
+	@param first - the first value
+	@param second - the second value
+	@return -1, 0 or 1
+*/
+inline int Decimal::_compare(const Decimal& first, const Decimal& second)
+{
+	if (first._scale == second._scale) return (first._units > second._units) - (first._units < second._units);
+
+	const int64_t first_integer = first._units / Decimal::_POWERS_OF_10[first._scale];
+	const int64_t second_integer = second._units / Decimal::_POWERS_OF_10[second._scale];
+	if (first_integer != second_integer) return first_integer < second_integer ? -1 : 1;
+
+	const unsigned int scale = std::max(first._scale, second._scale);
+	const int64_t first_fraction = (first._units % Decimal::_POWERS_OF_10[first._scale]) * Decimal::_POWERS_OF_10[scale - first._scale];
+	const int64_t second_fraction = (second._units % Decimal::_POWERS_OF_10[second._scale]) * Decimal::_POWERS_OF_10[scale - second._scale];
+	return (first_fraction > second_fraction) - (first_fraction < second_fraction);
+}
+
+inline bool operator==(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) == 0;
+}
+
+inline bool operator!=(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) != 0;
+}
+
+inline bool operator<(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) < 0;
+}
+
+inline bool operator>(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) > 0;
+}
+
+inline bool operator<=(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) <= 0;
+}
+
+inline bool operator>=(const Decimal& first, const Decimal& second)
+{
+	return Decimal::_compare(first, second) >= 0;
+}
@@ -0,0 +1,108 @@
+#include "../Binance_Client.h"
+
+// ClockSync templates
+
+/**
+	Constructor
+	samples the exchange time before returning - check 'sample_count()', or 'sample_errors()' if the requests failed
+	@param client - the client sending the requests - must outlive the clock
+	@param sync_interval - seconds between rounds of samples, 0 for no timer ('sync()' may still be called)
+	@param samples_per_round - number of requests of each round
+	@param window - number of last samples the offset is chosen from
+*/
+template <typename CT>
+ClockSync<CT>::ClockSync(CT& client, const unsigned int sync_interval, const unsigned int samples_per_round, const size_t window)
+	: ExchangeClock{ window }, _client{ &client }, _samples_per_round{ samples_per_round }, _sample_errors{ 0 },
+	_sync_interval{ sync_interval }, _sync_thread{ nullptr }, _stopped{ 0 }
+{
+	this->sync();
+	if (this->_sync_interval) this->_sync_thread = new std::thread(&ClockSync<CT>::_sync_loop, this);
+}
+
+/**
+	Destructor
+	stops the timer
+*/
+template <typename CT>
+ClockSync<CT>::~ClockSync()
+{
+	this->stop();
+}
+
+/**
+	Sample the exchange time ('exchange_time()') - one round of requests, sent one after the other
+	@return a bool for whether a sample was added - failed requests are counted in 'sample_errors()'
+*/
+template <typename CT>
+bool ClockSync<CT>::sync()
+{
+	bool sampled{ 0 };
+	for (unsigned int sample_index = 0; sample_index < this->_samples_per_round; sample_index++)
+	{
+		try
+		{
+			const int64_t request_start = this->local_time();
+			const unsigned long long server_time = this->_client->exchange_time();
+			const int64_t request_end = this->local_time();
+
+			if (!server_time)
+			{
+				this->_sample_errors++;
+				continue;
+			}
+			this->add_sample(request_start, server_time, request_end);
+			sampled = 1;
+		}
+		catch (ClientException&)
+		{
+			this->_sample_errors++;
+		}
+	}
+	return sampled;
+}
+
+/**
+	Sample the exchange time every sync interval, until stopped
+*/
+template <typename CT>
+void ClockSync<CT>::_sync_loop()
+{
+	std::unique_lock<std::mutex> sync_lock{ this->_sync_lock };
+	while (!this->_sync_cv.wait_for(sync_lock, std::chrono::seconds(this->_sync_interval), [this]() { return this->_stopped; }))
+	{
+		sync_lock.unlock();
+		this->sync();
+		sync_lock.lock();
+	}
+}
+
+/**
+	Stop the timer, and wait for a running round to finish - the current offset is kept
+*/
+template <typename CT>
+void ClockSync<CT>::stop()
+{
+	std::thread* sync_thread{ nullptr };
+	{
+		std::lock_guard<std::mutex> sync_guard(this->_sync_lock);
+		this->_stopped = 1;
+		sync_thread = this->_sync_thread;
+		this->_sync_thread = nullptr;
+	}
+	this->_sync_cv.notify_all();
+
+	if (sync_thread)
+	{
+		sync_thread->join();
+		delete sync_thread;
+	}
+}
+
+/**
+	@return the number of requests that failed
+*/
+template <typename CT>
+unsigned int ClockSync<CT>::sample_errors() const
+{
+	return this->_sample_errors;
+}
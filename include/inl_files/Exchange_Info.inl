@@ -0,0 +1,109 @@
+#include "../Binance_Client.h"
+
+// ExchangeInfoIndex templates
+
+/**
+	Constructor
+	loads the table ('exchange_info()') before returning - check 'table()->size()', or 'refresh_errors()' if the request failed
+	@param client - the client sending the requests - must outlive the index
+	@param refresh_interval - seconds between refreshes, 0 for no timer ('refresh()' may still be called)
+*/
+template <typename CT>
+ExchangeInfoIndex<CT>::ExchangeInfoIndex(CT& client, const unsigned int refresh_interval)
+	: _client{ &client }, _refresh_errors{ 0 }, _refresh_interval{ refresh_interval }, _refresh_thread{ nullptr }, _stopped{ 0 }
+{
+	this->refresh();
+	if (this->_refresh_interval) this->_refresh_thread = new std::thread(&ExchangeInfoIndex<CT>::_refresh_loop, this);
+}
+
+/**
+	Destructor
+	stops the timer
+*/
+template <typename CT>
+ExchangeInfoIndex<CT>::~ExchangeInfoIndex()
+{
+	this->stop();
+}
+
+/**
+	Request exchangeInfo, and publish a new table if a symbol was added, removed or changed
+	the current table is copied and updated (copy-on-write) - tables held by readers do not change
+	@return a bool for whether the response was read - false if the request failed (see 'refresh_errors()')
+*/
+template <typename CT>
+bool ExchangeInfoIndex<CT>::refresh()
+{
+	std::lock_guard<std::mutex> update_guard(this->_update_lock);
+
+	try
+	{
+		RestResponse exchange_info = this->_client->exchange_info();
+
+		SymbolTable::SymbolRows rows{};
+		if (!SymbolTable::read_symbols(exchange_info, rows))
+		{
+			this->_refresh_errors++;
+			return 0;
+		}
+
+		std::shared_ptr<const SymbolTable> current_table = this->table();
+		if (!current_table->differs(rows)) return 1;
+
+		std::shared_ptr<SymbolTable> new_table = std::make_shared<SymbolTable>(*current_table);
+		new_table->assign(rows);
+		this->_publish(std::move(new_table));
+		return 1;
+	}
+	catch (ClientException&)
+	{
+		this->_refresh_errors++;
+		return 0;
+	}
+}
+
+/**
+	Refresh the table every refresh interval, until stopped
+*/
+template <typename CT>
+void ExchangeInfoIndex<CT>::_refresh_loop()
+{
+	std::unique_lock<std::mutex> refresh_lock{ this->_refresh_lock };
+	while (!this->_refresh_cv.wait_for(refresh_lock, std::chrono::seconds(this->_refresh_interval), [this]() { return this->_stopped; }))
+	{
+		refresh_lock.unlock();
+		this->refresh();
+		refresh_lock.lock();
+	}
+}
+
+/**
+	Stop the timer, and wait for a running refresh to finish - the current table is kept
+*/
+template <typename CT>
+void ExchangeInfoIndex<CT>::stop()
+{
+	std::thread* refresh_thread{ nullptr };
+	{
+		std::lock_guard<std::mutex> refresh_guard(this->_refresh_lock);
+		this->_stopped = 1;
+		refresh_thread = this->_refresh_thread;
+		this->_refresh_thread = nullptr;
+	}
+	this->_refresh_cv.notify_all();
+
+	if (refresh_thread)
+	{
+		refresh_thread->join();
+		delete refresh_thread;
+	}
+}
+
+/**
+	@return the number of refreshes that failed
+*/
+template <typename CT>
+unsigned int ExchangeInfoIndex<CT>::refresh_errors() const
+{
+	return this->_refresh_errors;
+}
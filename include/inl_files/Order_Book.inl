@@ -0,0 +1,183 @@
+#include "../Binance_Client.h"
+
+// OrderBook templates
+
+/**
+	Constructor
+	the book is synced with the first event - pass the object as the functor of 'stream_depth_diff()' of the same client
+	@param client - the client sending the snapshot requests - must outlive the book
+	@param symbol - the symbol of the stream (lower case)
+	@param snapshot_limit - number of levels of the snapshot (i.e: 1000)
+*/
+template <typename CT>
+OrderBook<CT>::OrderBook(CT& client, const std::string& symbol, const unsigned int snapshot_limit)
+	: _client{ &client }, _symbol{ symbol }, _snapshot_limit{ snapshot_limit }, _book{ !std::is_same_v<CT, SpotClient> }, _synced{ 0 }, _resync_count{ 0 },
+	_failed_snapshots{ 0 }, _last_snapshot_request{}
+{}
+
+/**
+	Apply a diff depth event - buffered until the book is synced
+	@param depth_update - the event
+*/
+template <typename CT>
+void OrderBook<CT>::operator()(const DepthUpdateEvent& depth_update)
+{
+	if (this->_synced)
+	{
+		if (this->_book.apply(depth_update) != BookUpdateResult::gap) return;
+		this->_resync();
+	}
+
+	this->_buffered_updates.push_back(depth_update);
+	this->_buffered_updates.back().symbol = std::string_view{}; // points into the parser
+
+	if (!this->_snapshot.valid()) this->_request_snapshot();
+	else if (this->_snapshot.wait_for(std::chrono::seconds(0)) == std::future_status::ready) this->_sync();
+}
+
+/**
+	Request a snapshot asynchronously - checked with each event, so the stream is not blocked
+	requests are at least SNAPSHOT_MIN_INTERVAL_MS apart, and the interval doubles with each failed snapshot (up to SNAPSHOT_MAX_INTERVAL_MS) -
+	until then, events are buffered and the snapshot is requested with a later event
+*/
+template <typename CT>
+void OrderBook<CT>::_request_snapshot()
+{
+	const unsigned long long backoff_ms = std::min(static_cast<unsigned long long>(SNAPSHOT_MIN_INTERVAL_MS) << std::min(this->_failed_snapshots, 8u),
+		static_cast<unsigned long long>(SNAPSHOT_MAX_INTERVAL_MS));
+	const std::chrono::steady_clock::time_point current_time = std::chrono::steady_clock::now();
+	if (current_time - this->_last_snapshot_request < std::chrono::milliseconds(backoff_ms)) return;
+	this->_last_snapshot_request = current_time;
+
+	std::string snapshot_symbol{ this->_symbol };
+	std::transform(snapshot_symbol.begin(), snapshot_symbol.end(), snapshot_symbol.begin(), [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+
+	Params snapshot_params{};
+	snapshot_params.set_param<std::string>("symbol", snapshot_symbol);
+	snapshot_params.set_param<int>("limit", this->_snapshot_limit);
+
+	try
+	{
+		this->_snapshot = this->_client->async_req(this->_client->order_book_request(&snapshot_params));
+	}
+	catch (ClientException&) {} // the future stays invalid
+}
+
+/**
+	Load the snapshot, and apply the buffered events that follow it
+	if the snapshot is older than the buffered events, or events were missed, another snapshot is requested
+*/
+template <typename CT>
+void OrderBook<CT>::_sync()
+{
+	RestResponse snapshot{};
+	try
+	{
+		snapshot = this->_snapshot.get();
+	}
+	catch (...)
+	{
+		this->_failed_snapshots++;
+		return; // requested again with a later event
+	}
+	if (!this->_book.load_snapshot(snapshot)) // i.e: an error response
+	{
+		this->_failed_snapshots++;
+		return;
+	}
+
+	for (size_t update_index = 0; update_index < this->_buffered_updates.size(); update_index++)
+	{
+		if (this->_book.apply(this->_buffered_updates[update_index]) != BookUpdateResult::gap) continue;
+
+		this->_book.clear();
+		this->_buffered_updates.erase(this->_buffered_updates.begin(), this->_buffered_updates.begin() + update_index); // keeps the events from the gap
+		this->_failed_snapshots++;
+		this->_request_snapshot();
+		return;
+	}
+
+	this->_buffered_updates.clear();
+	this->_failed_snapshots = 0;
+	this->_synced = 1;
+}
+
+/**
+	Drop the book after a gap - synced again from a new snapshot
+*/
+template <typename CT>
+void OrderBook<CT>::_resync()
+{
+	this->_synced = 0;
+	this->_resync_count++;
+	this->_book.clear();
+	this->_buffered_updates.clear();
+}
+
+/**
+	@return a bool for whether the book is synced with the stream
+*/
+template <typename CT>
+bool OrderBook<CT>::synced() const
+{
+	return this->_synced;
+}
+
+/**
+	@return the number of times the book was synced again after a gap
+*/
+template <typename CT>
+unsigned int OrderBook<CT>::resync_count() const
+{
+	return this->_resync_count;
+}
+
+/**
+	@return the symbol of the book
+*/
+template <typename CT>
+const std::string& OrderBook<CT>::symbol() const
+{
+	return this->_symbol;
+}
+
+/**
+	Get the best bid and ask without a lock - from any thread
+	@return the best bid and ask of the same update (zeros until synced)
+*/
+template <typename CT>
+BestBidAsk OrderBook<CT>::best_bid_ask() const
+{
+	return this->_book.best_bid_ask();
+}
+
+/**
+	Copy the best bids - from any thread (locks the book)
+	@param depth - max number of levels
+	@param levels - the vector to fill, best bid first
+*/
+template <typename CT>
+void OrderBook<CT>::bids(const size_t depth, std::vector<PriceLevel>& levels) const
+{
+	this->_book.bids(depth, levels);
+}
+
+/**
+	Copy the best asks - from any thread (locks the book)
+	@param depth - max number of levels
+	@param levels - the vector to fill, best ask first
+*/
+template <typename CT>
+void OrderBook<CT>::asks(const size_t depth, std::vector<PriceLevel>& levels) const
+{
+	this->_book.asks(depth, levels);
+}
+
+/**
+	@return the book
+*/
+template <typename CT>
+const L2Book& OrderBook<CT>::book() const
+{
+	return this->_book;
+}
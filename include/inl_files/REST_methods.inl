@@ -1,5 +1,36 @@
 #include "../Binance_Client.h"
 
+// CurlHandlePool inline methods
+
+/**
+	Sets an option on the template handle and on the idle handles of the pool
+	handles checked out are in use by other threads and are not touched - they are duplicated again from the template when checked in
+	@param option - the CURL option
+	@param value - the value of the option
+*/
+template <typename OT>
+inline void CurlHandlePool::set_option(const CURLoption option, OT value)
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+
+	curl_easy_setopt(this->_template_handle, option, value);
+	this->_options_version++;
+	for (CURL* handle : this->_idle_handles)
+	{
+		curl_easy_setopt(handle, option, value);
+		this->_handle_versions[handle] = this->_options_version;
+	}
+}
+
+/**
+	Get the max number of handles of the pool
+	@return the max size, 0 if unlimited
+*/
+inline unsigned int CurlHandlePool::max_size() const
+{
+	return this->_max_size;
+}
+
 // RestSession inline methods
 
 /**
@@ -8,7 +39,7 @@
 */
 inline void RestSession::get_timeout(unsigned long interval)
 {
-	curl_easy_setopt(this->_get_handle, CURLOPT_TIMEOUT, interval);
+	this->_get_pool->set_option(CURLOPT_TIMEOUT, interval);
 };
 
 /**
@@ -17,7 +48,7 @@ inline void RestSession::get_timeout(unsigned long interval)
 */
 inline void RestSession::post_timeout(unsigned long interval)
 {
-	curl_easy_setopt(this->_post_handle, CURLOPT_TIMEOUT, interval); 
+	this->_post_pool->set_option(CURLOPT_TIMEOUT, interval); 
 };
 
 /**
@@ -26,7 +57,7 @@ inline void RestSession::post_timeout(unsigned long interval)
 */
 inline void RestSession::put_timeout(unsigned long interval)
 {
-	curl_easy_setopt(this->_put_handle, CURLOPT_TIMEOUT, interval);
+	this->_put_pool->set_option(CURLOPT_TIMEOUT, interval);
 };
 
 /**
@@ -35,5 +66,119 @@ inline void RestSession::put_timeout(unsigned long interval)
 */
 inline void RestSession::delete_timeout(unsigned long interval)
 {
-	curl_easy_setopt(this->_delete_handle, CURLOPT_TIMEOUT, interval); 
-};
\ No newline at end of file
+	this->_delete_pool->set_option(CURLOPT_TIMEOUT, interval); 
+};
+
+/**
+	Checks whether requests are multiplexed over HTTP/2
+	@return 1 if HTTP/2 mode is set, 0 if not
+*/
+inline bool RestSession::http2_mode() const
+{
+	return this->_http2_mode;
+}
+
+// RateLimiter inline methods
+
+/**
+	Get the policy for requests that do not fit the limits
+	@return the policy
+*/
+inline RateLimitPolicy RateLimiter::policy() const
+{
+	return this->_policy;
+}
+
+// ParserPool inline methods
+
+/**
+	Get the max number of idle parsers kept by the pool
+	@return the capacity
+*/
+inline unsigned int ParserPool::capacity() const
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+	return this->_capacity;
+}
+
+/**
+	Get the number of parsers currently held by responses
+	@return the number of leased parsers
+*/
+inline unsigned int ParserPool::leased() const
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+	return this->_leased;
+}
+
+/**
+	Get the max number of parsers held by responses at the same time
+	@return the high-water mark
+*/
+inline unsigned int ParserPool::high_water_mark() const
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+	return this->_high_water_mark;
+}
+
+// RestResponse inline methods
+
+/**
+	Access a key of the response
+	@param key - the key
+	@return the element of the key
+*/
+inline simdjson::simdjson_result<simdjson::dom::element> RestResponse::operator[](std::string_view key) const
+{
+	if (!this->_parser) return simdjson::UNINITIALIZED;
+	return this->_json[key];
+}
+
+/**
+	Access an index of the response (array responses)
+	@param index - the index
+	@return the element at the index
+*/
+inline simdjson::simdjson_result<simdjson::dom::element> RestResponse::at(const size_t index) const
+{
+	if (!this->_parser) return simdjson::UNINITIALIZED;
+	return this->_json.at(index);
+}
+
+/**
+	Access an element by a JSON pointer (i.e: "/balances/0/asset")
+	@param json_pointer - the JSON pointer
+	@return the element
+*/
+inline simdjson::simdjson_result<simdjson::dom::element> RestResponse::at_pointer(std::string_view json_pointer) const
+{
+	if (!this->_parser) return simdjson::UNINITIALIZED;
+	return this->_json.at_pointer(json_pointer);
+}
+
+/**
+	Get the root element of the response
+	@return the root element - valid only while this response lives
+*/
+inline simdjson::dom::element RestResponse::get() const&
+{
+	return this->_json;
+}
+
+/**
+	Checks whether the response holds a document
+	@return 1 if empty, 0 if not
+*/
+inline bool RestResponse::empty() const
+{
+	return !this->_parser;
+}
+
+/**
+	Checks whether the response is null (empty responses are null)
+	@return 1 if null, 0 if not
+*/
+inline bool RestResponse::is_null() const
+{
+	return this->empty() || this->_json.is_null();
+}
\ No newline at end of file
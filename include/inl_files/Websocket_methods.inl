@@ -18,17 +18,17 @@ unsigned int Client<T>::MarginAccount::margin_stream_userstream(std::string& buf
 	{
 		std::string stream_name = this->margin_get_listen_key(isolated_margin_type);
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor, ping_listen_key);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 
 }
@@ -45,12 +45,12 @@ unsigned int SpotClient::v_stream_userstream(std::string& buffer, FT& functor, c
 {
 	std::string stream_name = this->get_listen_key();
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor, ping_listen_key);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 
 }
 
@@ -66,12 +66,12 @@ unsigned int SpotClient::v_stream_Trade(const std::string& symbol, std::string&
 {
 	std::string stream_name = symbol + '@' + "trade";
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -90,17 +90,17 @@ unsigned int FuturesClient<CT>::stream_markprice(const std::string& symbol, std:
 	{
 		std::string stream_name = symbol + '@' + "markPrice" + std::to_string(interval) + "ms";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -137,10 +137,10 @@ unsigned int FuturesClient<CT>::stream_markprice_all(const std::string& pair, st
 	{
 		return static_cast<CT*>(this)->v_stream_markprice_all(pair, buffer, functor);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only USDT
 
@@ -160,10 +160,10 @@ unsigned int FuturesClient<CT>::stream_indexprice(const std::string& pair, std::
 	{
 		return static_cast<CT*>(this)->v_stream_indexprice(pair, buffer, functor, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only Coin
 
@@ -185,10 +185,10 @@ unsigned int FuturesClient<CT>::stream_markprice_by_pair(const std::string& pair
 	{
 		return static_cast<CT*>(this)->v_stream_markprice_by_pair(pair, buffer, functor, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only coin
 
@@ -209,10 +209,10 @@ unsigned int FuturesClient<CT>::stream_kline_contract(const std::string& pair_an
 	{
 		return static_cast<CT*>(this)->v_stream_kline_contract(pair_and_type, buffer, functor, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only coin
 
@@ -232,10 +232,10 @@ unsigned int FuturesClient<CT>::stream_kline_index(const std::string& pair, std:
 	{
 		return static_cast<CT*>(this)->v_stream_kline_index(pair, buffer, functor, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only coin
 
@@ -255,10 +255,10 @@ unsigned int FuturesClient<CT>::stream_kline_markprice(const std::string& symbol
 	{
 		return static_cast<CT*>(this)->v_stream_kline_markprice(symbol, buffer, functor, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 } // only coin
 
@@ -277,17 +277,17 @@ unsigned int FuturesClient<CT>::stream_liquidation_orders(const std::string& sym
 	{
 		std::string stream_name = symbol + "@" + "forceOrder";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -305,17 +305,17 @@ unsigned int FuturesClient<CT>::stream_liquidation_orders_all(std::string& buffe
 	{
 		std::string stream_name = "!forceOrder@arr";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -334,10 +334,10 @@ unsigned int FuturesClient<CT>::stream_blvt_info(std::string& buffer, FT& functo
 	{
 		return static_cast<CT*>(this)->v_stream_blvt_info(buffer, functor, token_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -357,10 +357,10 @@ unsigned int FuturesClient<CT>::stream_blvt_klines(std::string& buffer, FT& func
 	{
 		return static_cast<CT*>(this)->v_stream_blvt_klines(buffer, functor, token_name, interval);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -379,10 +379,10 @@ unsigned int FuturesClient<CT>::stream_composite_index_symbol(std::string& buffe
 	{
 		return static_cast<CT*>(this)->v_stream_composite_index_symbol(buffer, functor, token_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -401,12 +401,12 @@ unsigned int FuturesClientUSDT::v_stream_markprice_all(const std::string& symbol
 {
 	std::string stream_name = symbol + '@' + "miniTicker";
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -472,12 +472,12 @@ unsigned int FuturesClientUSDT::v__stream_userstream(std::string& buffer, FT& fu
 {
 	std::string stream_name = this->get_listen_key();
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -488,12 +488,12 @@ unsigned int FuturesClientCoin::v_stream_indexprice(const std::string& pair, std
 {
 	std::string stream_name = pair + "@" + "indexPrice" + "@" + std::to_string(interval) + "ms";
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -504,12 +504,12 @@ unsigned int FuturesClientCoin::v_stream_markprice_by_pair(const std::string& pa
 {
 	std::string stream_name = pair + "@" + "markPrice" + "@" + std::to_string(interval) + "ms";
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -553,12 +553,12 @@ unsigned int FuturesClientCoin::v_stream_kline_contract(const std::string& pair_
 {
 	std::string stream_name = pair_and_type + "@" + "continuousKline_" + (interval);
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -569,12 +569,12 @@ unsigned int FuturesClientCoin::v_stream_kline_index(const std::string& pair, st
 {
 	std::string stream_name = pair + "@" + "indexPriceKline_" + (interval);
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -585,12 +585,12 @@ unsigned int FuturesClientCoin::v_stream_kline_markprice(const std::string& symb
 {
 	std::string stream_name = symbol + "@" + "markPriceKline_" + (interval);
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 
@@ -604,17 +604,17 @@ unsigned int FuturesClientUSDT::v_stream_blvt_info(std::string& buffer, FT& func
 	{
 		std::string stream_name = token_name + "@nav_Kline_";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -628,17 +628,17 @@ unsigned int FuturesClientUSDT::v_stream_blvt_klines(std::string& buffer, FT& fu
 	{
 		std::string stream_name = token_name + "@nav_Kline_" + interval;
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -652,17 +652,17 @@ unsigned int FuturesClientUSDT::v_stream_composite_index_symbol(std::string& buf
 	{
 		std::string stream_name = token_name + "@compositeIndex";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -674,12 +674,12 @@ unsigned int FuturesClientCoin::v__stream_userstream(std::string& buffer, FT& fu
 {
 	std::string stream_name = this->get_listen_key();
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor, ping_listen_key);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -697,17 +697,17 @@ unsigned int  Client<T>::stream_aggTrade(const std::string& symbol, std::string&
 	{
 		std::string stream_name = symbol + '@' + "aggTrade";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -727,17 +727,17 @@ unsigned int Client<T>::stream_kline(const std::string& symbol, std::string& buf
 	{
 		std::string stream_name = symbol + '@' + "kline_" + interval;
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -756,17 +756,17 @@ unsigned int Client<T>::stream_ticker_ind_mini(const std::string& symbol, std::s
 	{
 		std::string stream_name = symbol + '@' + "miniTicker";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -784,17 +784,17 @@ unsigned int Client<T>::stream_ticker_all_mini(std::string& buffer, FT& functor)
 	{
 		std::string stream_name = "!miniTicker@arr";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -813,17 +813,17 @@ unsigned int Client<T>::stream_ticker_ind(const std::string& symbol, std::string
 	{
 		std::string stream_name = symbol + "@" + "ticker";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -841,17 +841,17 @@ unsigned int Client<T>::stream_ticker_all(std::string& buffer, FT& functor)
 	{
 		std::string stream_name = "!ticker@arr";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -870,17 +870,17 @@ unsigned int Client<T>::stream_ticker_ind_book(const std::string& symbol, std::s
 	{
 		std::string stream_name = symbol + "@" + "bookTicker";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -898,17 +898,17 @@ unsigned int Client<T>::stream_ticker_all_book(std::string& buffer, FT& functor)
 	{
 		std::string stream_name = "!bookTicker";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -930,17 +930,17 @@ unsigned int Client<T>::stream_depth_partial(const std::string& symbol, std::str
 		std::string stream_name = symbol + "@" + "depth" + std::to_string(levels);
 		if (interval) stream_name += "@" + std::to_string(interval) + "ms";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -960,17 +960,17 @@ unsigned int Client<T>::stream_depth_diff(const std::string& symbol, std::string
 	{
 		std::string stream_name = symbol + '@' + "depth" + "@" + std::to_string(interval) + "ms";
 		std::string stream_query = "/ws/" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -989,10 +989,10 @@ unsigned int Client<T>::stream_userstream(std::string& buffer, FT& functor, cons
 	{
 		return static_cast<T*>(this)->v_stream_userstream(buffer, functor, ping_listen_key);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1011,18 +1011,18 @@ unsigned int Client<T>::custom_stream(const std::string stream_name, std::string
 	try
 	{
 		std::string stream_query = "/stream?streams=" + stream_name;
-		if (this->_ws_client->is_open(stream_query))
+		if (this->_ws_client->is_open(stream_name))
 		{
-			this->_ws_client->close_stream(stream_query);
+			this->_ws_client->close_stream(stream_name);
 		}
 		this->_ws_client->template _stream_manager<FT>(stream_name, stream_query, buffer, functor, ping_listen_key);
-		return this->_ws_client->running_streams[stream_query];
+		return this->_ws_client->is_open(stream_name);
 
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1041,10 +1041,10 @@ unsigned int Client<T>::stream_Trade(const std::string& symbol, std::string& buf
 	{
 		return static_cast<T*>(this)->v_stream_Trade(symbol, buffer, functor);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1060,12 +1060,12 @@ unsigned int OpsClient::v_stream_userstream(std::string& buffer, FT& functor, co
 {
 	std::string stream_name = this->get_listen_key();
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor, ping_listen_key);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -1080,12 +1080,12 @@ unsigned int OpsClient::v_stream_Trade(const std::string& symbol, std::string& b
 {
 	std::string stream_name = symbol + '@' + "trade";
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 /**
@@ -1101,21 +1101,153 @@ unsigned int OpsClient::v_stream_kline(const std::string& symbol, std::string& b
 {
 	std::string stream_name = symbol + "@" + "kline_" + (interval);
 	std::string stream_query = "/ws/" + stream_name;
-	if (this->_ws_client->is_open(stream_query))
+	if (this->_ws_client->is_open(stream_name))
 	{
-		this->_ws_client->close_stream(stream_query);
+		this->_ws_client->close_stream(stream_name);
 	}
 	this->_ws_client->_stream_manager<FT>(stream_name, stream_query, buffer, functor);
-	return this->_ws_client->running_streams[stream_query];
+	return this->_ws_client->is_open(stream_name);
 }
 
 
 // Websocket methods templates
 
 
+/**
+	Call the functor of a stream with a message
+	functors accepting a std::string_view get a view of the message - followed by SIMDJSON_PADDING bytes of capacity,
+	so it can be parsed in place (i.e: parser.parse(message.data(), message.size(), false)).
+	functors accepting a typed event (see Stream_Events.h) get the decoded event - others get the buffer
+	@param functor - the functor
+	@param message - the buffer holding the message
+*/
+template <typename FT>
+void invoke_stream_callback(FT& functor, std::string& message)
+{
+	if constexpr (std::is_invocable_v<FT&, std::string_view>) functor(std::string_view{ message });
+	else if constexpr (std::is_invocable_v<FT&, std::string&>) functor(message);
+	else if constexpr (std::is_invocable_v<FT&, const AggTradeEvent&>) EventDecoder::dispatch<AggTradeEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const TradeEvent&>) EventDecoder::dispatch<TradeEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const KlineEvent&>) EventDecoder::dispatch<KlineEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const BookTickerEvent&>) EventDecoder::dispatch<BookTickerEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const DepthUpdateEvent&>) EventDecoder::dispatch<DepthUpdateEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const MarkPriceEvent&>) EventDecoder::dispatch<MarkPriceEvent>(message, functor);
+	else if constexpr (std::is_invocable_v<FT&, const ForceOrderEvent&>) EventDecoder::dispatch<ForceOrderEvent>(message, functor);
+	else static_assert(std::is_invocable_v<FT&, std::string&>, "the functor of a stream must accept a std::string&, a std::string_view or a stream event");
+}
+
+/**
+	Decode a message into events, and call the functor with each of them
+	the message may be an event, an array of events (i.e: !markPrice@arr), or a message of a combined stream.
+	messages that are not events of the type (i.e: replies to requests) are skipped
+	@param message - the buffer holding the message
+	@param functor - the functor
+	@return the number of events passed to the functor
+*/
+template <typename ET, typename FT>
+size_t EventDecoder::dispatch(std::string& message, FT& functor)
+{
+	thread_local ET event{}; // depth levels keep their capacity between messages
+	size_t dispatched_events{ 0 };
+
+	if (message.capacity() < message.size() + simdjson::SIMDJSON_PADDING) message.reserve(message.size() + simdjson::SIMDJSON_PADDING); // buffers of streams are already padded
+
+	std::string_view stream_name;
+	std::string_view json{ message };
+	StreamMultiplexer::split(message, stream_name, json); // the payload, for a combined stream
+
+	simdjson::ondemand::document document;
+	simdjson::ondemand::json_type json_type;
+	const size_t padded_size = message.capacity() - static_cast<size_t>(json.data() - message.data());
+	if (EventDecoder::_parser.iterate(json.data(), json.size(), padded_size).get(document) || document.type().get(json_type)) return 0;
+
+	simdjson::ondemand::object object;
+	if (json_type == simdjson::ondemand::json_type::object)
+	{
+		if (document.get_object().get(object) || EventDecoder::_decode(object, event)) return 0;
+		functor(static_cast<const ET&>(event));
+		return 1;
+	}
+
+	simdjson::ondemand::array events;
+	if (json_type != simdjson::ondemand::json_type::array || document.get_array().get(events)) return 0;
+	for (simdjson::simdjson_result<simdjson::ondemand::value> element : events)
+	{
+		if (element.get_object().get(object) || EventDecoder::_decode(object, event)) break;
+		functor(static_cast<const ET&>(event));
+		dispatched_events++;
+	}
+
+	return dispatched_events;
+}
+
+
+/**
+	Subscribe to a stream on an open connection
+	@param stream_name - name of the stream (i.e: btcusdt@aggTrade)
+	@param functor - a reference to the functor object to be called with each message ({"stream":..,"data":..}) - must outlive the subscription
+	@return a future of whether the server accepted the request
+*/
+template <typename FT>
+std::future<bool> StreamConnection::subscribe(const std::string& stream_name, FT& functor)
+{
+	return this->_subscribe(std::vector<std::string>{ stream_name }, [&functor](std::string& message) { invoke_stream_callback(functor, message); });
+}
+
+/**
+	Subscribe to streams on an open connection, in one request
+	@param stream_names - names of the streams
+	@param functor - a reference to the functor object to be called with each message of the streams - must outlive the subscriptions
+	@return a future of whether the server accepted the request
+*/
+template <typename FT>
+std::future<bool> StreamConnection::subscribe(const std::vector<std::string>& stream_names, FT& functor)
+{
+	return this->_subscribe(stream_names, [&functor](std::string& message) { invoke_stream_callback(functor, message); });
+}
+
+
+/**
+	Consume the next message, without waiting (busy-poll)
+	@param functor - called with the message, as a functor of a stream (std::string&, std::string_view or a typed event)
+	@return a bool for whether there was a message
+*/
+template <typename FT>
+bool StreamQueue::poll(FT& functor)
+{
+	if (!this->_try_pop()) return 0;
+
+	invoke_stream_callback(functor, this->_consumer_buffer);
+	return 1;
+}
+
+/**
+	Consume the next message, waiting until there is one
+	@param functor - called with the message, as a functor of a stream (std::string&, std::string_view or a typed event)
+	@param timeout - max time to wait
+	@return a bool for whether there was a message (false on timeout, or once closed and empty)
+*/
+template <typename FT>
+bool StreamQueue::wait(FT& functor, const std::chrono::milliseconds timeout)
+{
+	if (this->poll(functor)) return 1;
+
+	std::unique_lock<std::mutex> wait_lock{ this->_wait_lock };
+	this->_consumer_waiting = 1;
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	this->_consumer_cv.wait_for(wait_lock, timeout, [this]() { return this->_ready() || this->_closed; });
+	this->_consumer_waiting = 0;
+	wait_lock.unlock();
+
+	return this->poll(functor);
+}
+
+
 /**
 	Manage an active stream
 	This manager is responsible for reconnecting as well
+	If a context pool is set, the stream runs on the pool and this method returns once it is open -
+	'buf' and 'functor' must then outlive the stream
 
 	@param stream_map_name - The name of the stream
 	@param stream_path - The path of the string (query)
@@ -1128,38 +1260,75 @@ template <typename T>
 template <class FT>
 void WebsocketClient<T>::_stream_manager(std::string stream_map_name, const std::string stream_path, std::string& buf, FT& functor, const bool ping_listen_key)
 {
+	if (this->_context_pool)
+	{
+		try
+		{
+			long long unsigned int last_keepalive{ 0 };
+			this->_start_async_stream(stream_map_name, stream_path, buf,
+				[this, &functor, ping_listen_key, last_keepalive](std::string& buffer) mutable
+				{
+					if (ping_listen_key) // sent as an async request, so the threads of the pool are not blocked by the REST call
+					{
+						long long unsigned int current_timestamp = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+						if (current_timestamp - last_keepalive > this->exchange_client->refresh_listenkey_interval)
+						{
+							try
+							{
+								this->exchange_client->async_req(this->exchange_client->ping_listen_key_request(), [](RestResponse&) {});
+								last_keepalive = current_timestamp;
+							}
+							catch (ClientException&) {} // not submitted (client closing) - retried on the next message
+						}
+					}
+					invoke_stream_callback(functor, buffer);
+				});
+			return;
+		}
+		catch (ClientException& e)
+		{
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw;
+		}
+	}
+
+	std::shared_ptr<StreamHandle> stream_handle = std::make_shared<StreamHandle>(stream_map_name);
+	stream_handle->latency = this->_stream_latency(stream_map_name);
+	this->_streams.add(stream_handle); // replaces (and closes) a stream of the same name
+
 	unsigned int reconnect_attempts = 0;
-	this->running_streams[stream_map_name] = 0; // init
 	do
 	{
 		try
 		{
-			this->_connect_to_endpoint<FT>(stream_map_name, stream_path, buf, functor, ping_listen_key); // will not proceed unless connection is broken
+			this->_connect_to_endpoint<FT>(*stream_handle, stream_path, buf, functor, ping_listen_key); // will not proceed unless connection is broken
 		}
 
-		catch (ClientException e)
+		catch (ClientException& e)
 		{
-			if (this->running_streams[stream_map_name] && this->_reconnect_on_error) // if reconnect
+			if (stream_handle->running && this->_reconnect_on_error) // if reconnect
 			{
 				reconnect_attempts++;
 			}
 			else // if not reconnect, throw exception
 			{
+				this->_streams.remove(stream_map_name, stream_handle.get());
 				e.append_to_traceback(std::string(__FUNCTION__));
-				throw(e);
+				throw;
 			}
 		}
-	} while (this->running_streams[stream_map_name] && this->_reconnect_on_error && (reconnect_attempts < this->_max_reconnect_count)); // will repeat only of stream is up (no user shutdown) and reconnect is true, and reconnections not above max
+	} while (stream_handle->running && this->_reconnect_on_error && (reconnect_attempts < this->_max_reconnect_count)); // will repeat only of stream is up (no user shutdown) and reconnect is true, and reconnections not above max
+
+	this->_streams.remove(stream_map_name, stream_handle.get());
 }
 
 /**
 	Starts a new stream
 	This method starts the stream and maintains a 'while' loop that loads the websocket messages into 'buf' and
 	invoke 'functor' as the callback.
-	The member 'running_streams' contains names of active streams. In order to close
-	a stream, the name should be removed from there.
+	The loop runs while the 'running' flag of the handle is set - 'close_stream()' clears it.
 
-	@param stream_map_name - The name of the stream
+	@param stream_handle - The handle of the stream, in the registry
 	@param stream_path - The path of the string (query)
 	@param buf - a reference of the string buffer to load responses to
 	@param functor - a reference to the functor object to be called as callback
@@ -1168,14 +1337,14 @@ void WebsocketClient<T>::_stream_manager(std::string stream_map_name, const std:
 */
 template <typename T>
 template <class FT>
-void WebsocketClient<T>::_connect_to_endpoint(const std::string stream_map_name, const std::string stream_path, std::string& buf, FT& functor, const bool ping_listen_key)
+void WebsocketClient<T>::_connect_to_endpoint(StreamHandle& stream_handle, const std::string stream_path, std::string& buf, FT& functor, const bool ping_listen_key)
 {
 	long long unsigned int last_keepalive{ 0 };
 
 	net::io_context ioc;
 	ssl::context ctx{ ssl::context::tlsv12_client };
 	tcp::resolver resolver{ ioc };
-	websocket::stream<beast::ssl_stream<tcp::socket>> ws{ ioc, ctx }; // todo: init here in map pair for subscribe/unsubscribe
+	websocket::stream<beast::ssl_stream<tcp::socket>> ws{ ioc, ctx }; // for subscribe / unsubscribe, see StreamConnection
 	const boost::asio::ip::basic_resolver_results<boost::asio::ip::tcp> ex_client = resolver.resolve(this->_host, this->_port);
 	auto ep = net::connect(get_lowest_layer(ws), ex_client);
 	std::string full_host = this->_host + ':' + std::to_string(ep.port());
@@ -1183,20 +1352,22 @@ void WebsocketClient<T>::_connect_to_endpoint(const std::string stream_map_name,
 	ws.handshake(full_host, stream_path);
 
 	beast::error_code ec; // error code
+	StreamLatency* latency = stream_handle.latency.get(); // null if not measured
+	this->_receive_buffer.prepare(buf);
+	net::dynamic_string_buffer<char, std::char_traits<char>, std::allocator<char>> read_buffer = net::dynamic_buffer(buf); // consumed after each message
 
 	if (ws.is_open()) // change back to is open
 	{
-		this->running_streams[stream_map_name] = 1;
+		stream_handle.open = 1;
 		if (this->_gzip_conversion)
 		{
 			bool conversion_successful{ 0 };
 			ws.write(net::buffer(std::string("{\"method\":\"BINARY\", \"params\":[\"false\"], \"id\":1}")));
 			while (!conversion_successful)
 			{
-				auto beast_buffer = boost::asio::dynamic_buffer(buf);
-				ws.read(beast_buffer, ec);
+				ws.read(read_buffer, ec);
 				conversion_successful = (buf == "{\"id\":1}");
-				buf.clear();
+				read_buffer.consume(read_buffer.size());
 			}
 		}
 	}
@@ -1208,7 +1379,7 @@ void WebsocketClient<T>::_connect_to_endpoint(const std::string stream_map_name,
 	}
 
 
-	while (this->running_streams[stream_map_name])
+	while (stream_handle.running)
 	{
 		try
 		{
@@ -1221,22 +1392,37 @@ void WebsocketClient<T>::_connect_to_endpoint(const std::string stream_map_name,
 					last_keepalive = current_timestamp;
 				}
 			}
-			auto beast_buffer = boost::asio::dynamic_buffer(buf); // impossible to declare just once...
-			ws.read(beast_buffer, ec);
+			ws.read(read_buffer, ec);
 			if (ec)
 			{
-				if (!this->_reconnect_on_error) this->running_streams[stream_map_name] = 0; // to exit loop if not retry
+				if (!this->_reconnect_on_error) stream_handle.running = 0; // to exit loop if not retry
 				break;
 			}
 
-			functor(buf);
-			buf.clear();
+			if (latency)
+			{
+				const std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+				latency->record_receive(buf);
+				this->_receive_buffer.pad(buf);
+
+				const std::chrono::steady_clock::time_point callback_start = std::chrono::steady_clock::now();
+				invoke_stream_callback(functor, buf);
+				latency->record_callback(received, callback_start, std::chrono::steady_clock::now());
+			}
+			else
+			{
+				this->_receive_buffer.pad(buf);
+				invoke_stream_callback(functor, buf);
+			}
+			read_buffer.consume(read_buffer.size());
+			this->_receive_buffer.recycle(buf);
 		}
 		catch (...)
 		{
 			if (!this->_reconnect_on_error)
 			{
-				this->running_streams[stream_map_name] = 0; // to exit outer loop if not retry
+				stream_handle.open = 0;
+				stream_handle.running = 0; // to exit outer loop if not retry
 				try
 				{
 					ws.close(beast::websocket::close_code::bad_payload, ec);
@@ -1254,6 +1440,7 @@ void WebsocketClient<T>::_connect_to_endpoint(const std::string stream_map_name,
 			throw(e);
 		}
 	}
+	stream_handle.open = 0;
 	try
 	{
 		ws.close(beast::websocket::close_code::normal, ec);
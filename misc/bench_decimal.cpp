@@ -0,0 +1,62 @@
+#include "../include/Binance_Client.h"
+
+#include <chrono>
+#include <iostream>
+
+// Cost of converting a price from and to its string form:
+// 'std::stod' / 'std::to_string' (what the decoders and params did) vs 'Decimal::parse' / 'Decimal::format'.
+// usage: bench_decimal [iterations]
+
+int main(int argc, char* argv[])
+{
+    unsigned int iterations = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    std::vector<std::string> prices;
+    for (unsigned int i = 0; i < 64; i++)
+    {
+        prices.push_back("271" + std::to_string(10 + i) + "." + std::to_string(10 + i) + "000000");
+    }
+
+    double double_checksum{ 0 }; // keeps the results alive
+    size_t size_checksum{ 0 };
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        double_checksum += std::stod(prices[i & 63]);
+    }
+    std::chrono::duration<double, std::nano> stod_time = std::chrono::steady_clock::now() - start;
+
+    int64_t units_checksum{ 0 };
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        Decimal price;
+        Decimal::parse(prices[i & 63], price);
+        units_checksum += price.units();
+    }
+    std::chrono::duration<double, std::nano> parse_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        size_checksum += std::to_string(27110.10 + (i & 63)).size();
+    }
+    std::chrono::duration<double, std::nano> to_string_time = std::chrono::steady_clock::now() - start;
+
+    char buffer[Decimal::MAX_FORMAT_SIZE];
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        size_checksum += Decimal{ 2711010000000 + (i & 63), 8 }.format(buffer);
+    }
+    std::chrono::duration<double, std::nano> format_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "std::stod:          " << stod_time.count() / iterations << " ns/price\n";
+    std::cout << "Decimal::parse:     " << parse_time.count() / iterations << " ns/price\n";
+    std::cout << "std::to_string:     " << to_string_time.count() / iterations << " ns/price\n";
+    std::cout << "Decimal::format:    " << format_time.count() / iterations << " ns/price\n";
+    std::cout << "(checksum " << double_checksum + units_checksum + size_checksum << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "../include/Binance_Client.h"
+
+#include <chrono>
+#include <iostream>
+
+// Cost of getting the fields of a depth update out of the message:
+// a DOM parse with the values converted by the functor (what functors had to do) vs 'EventDecoder' (a functor accepting 'DepthUpdateEvent').
+// usage: bench_events [iterations]
+
+struct DoubleLevel // what functors converted the levels to
+{
+    double price;
+    double quantity;
+};
+
+struct DepthFunctor
+{
+    double* checksum;
+
+    void operator()(const DepthUpdateEvent& depth_update)
+    {
+        *checksum += depth_update.bids[0].price.units() + depth_update.asks.size();
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    unsigned int iterations = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    std::string message = "{\"e\":\"depthUpdate\",\"E\":1700000000000,\"T\":1700000000000,\"s\":\"BTCUSDT\",\"U\":3000000001,\"u\":3000000010,\"pu\":3000000000,\"b\":[";
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        message += std::string(i ? "," : "") + "[\"2712" + std::to_string(i) + ".10\",\"0.0" + std::to_string(i + 1) + "5\"]";
+    }
+    message += "],\"a\":[";
+    for (unsigned int i = 0; i < 10; i++)
+    {
+        message += std::string(i ? "," : "") + "[\"2713" + std::to_string(i) + ".20\",\"1.0" + std::to_string(i + 1) + "0\"]";
+    }
+    message += "]}";
+    message.reserve(message.size() + simdjson::SIMDJSON_PADDING);
+
+    double checksum{ 0 }; // keeps the results alive
+
+    simdjson::dom::parser parser;
+    std::vector<DoubleLevel> bids;
+    std::vector<DoubleLevel> asks;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        simdjson::dom::element depth_update = parser.parse(message);
+        std::string symbol{ std::string_view(depth_update["s"]) };
+        uint64_t final_update_id = depth_update["u"];
+        bids.clear();
+        asks.clear();
+        for (simdjson::dom::element level : depth_update["b"].get_array())
+        {
+            bids.push_back(DoubleLevel{ std::stod(std::string(std::string_view(level.at(0)))), std::stod(std::string(std::string_view(level.at(1)))) });
+        }
+        for (simdjson::dom::element level : depth_update["a"].get_array())
+        {
+            asks.push_back(DoubleLevel{ std::stod(std::string(std::string_view(level.at(0)))), std::stod(std::string(std::string_view(level.at(1)))) });
+        }
+        checksum += bids[0].price + asks.size() + symbol.size() + (final_update_id & 1);
+    }
+    std::chrono::duration<double, std::nano> dom_time = std::chrono::steady_clock::now() - start;
+
+    DepthFunctor functor{ &checksum };
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        invoke_stream_callback(functor, message);
+    }
+    std::chrono::duration<double, std::nano> decoder_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "DOM + conversions:  " << dom_time.count() / iterations << " ns/message\n";
+    std::cout << "EventDecoder:       " << decoder_time.count() / iterations << " ns/message\n";
+    std::cout << "(checksum " << checksum << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include "../include/Binance_Client.h"
+
+#include <chrono>
+#include <iostream>
+
+// Cost of routing a combined stream message to the handler of its stream:
+// parsing the message and copying the payload (what a functor of 'custom_stream()' had to do) vs 'StreamMultiplexer'.
+// usage: bench_multiplexer [iterations]
+
+const unsigned int stream_count = 200;
+
+int main(int argc, char* argv[])
+{
+    unsigned int iterations = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    std::vector<std::string> messages;
+    messages.reserve(stream_count);
+    for (unsigned int i = 0; i < stream_count; i++)
+    {
+        messages.push_back("{\"stream\":\"sym" + std::to_string(i) + "usdt@aggTrade\",\"data\":{\"e\":\"aggTrade\",\"E\":1700000000000,\"s\":\"SYM"
+            + std::to_string(i) + "USDT\",\"a\":26129,\"p\":\"0.01633102\",\"q\":\"4.70443515\",\"f\":27781,\"l\":27781,\"T\":1700000000000,\"m\":true,\"M\":true}}");
+    }
+
+    size_t checksum{ 0 }; // keeps the results alive
+
+    std::unordered_map<std::string, std::function<void(const std::string&)>> parsed_handlers;
+    StreamMultiplexer multiplexer{ stream_count };
+    for (unsigned int i = 0; i < stream_count; i++)
+    {
+        std::string stream_name = "sym" + std::to_string(i) + "usdt@aggTrade";
+        parsed_handlers[stream_name] = [&checksum](const std::string& data) { checksum += data.size(); };
+        multiplexer.set_handler(stream_name, [&checksum](std::string_view data) { checksum += data.size(); });
+    }
+
+    simdjson::dom::parser parser;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        simdjson::dom::element message = parser.parse(messages[i % stream_count]);
+        std::string stream_name{ std::string_view(message["stream"]) };
+        std::string data = simdjson::minify(message["data"]);
+        parsed_handlers[stream_name](data);
+    }
+    std::chrono::duration<double, std::nano> parsed_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        multiplexer.dispatch(messages[i % stream_count]);
+    }
+    std::chrono::duration<double, std::nano> multiplexer_time = std::chrono::steady_clock::now() - start;
+
+    std::cout << "parse + copy:       " << parsed_time.count() / iterations << " ns/message\n";
+    std::cout << "StreamMultiplexer:  " << multiplexer_time.count() / iterations << " ns/message\n";
+    std::cout << "(checksum " << checksum << ", unrouted " << multiplexer.unrouted() << ")\n";
+
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "../include/Binance_Client.h"
+
+#include <thread>
+#include <chrono>
+#include <iostream>
+
+// Orders/sec of concurrent 'test_new_order' requests, at 1, 4 and 16 threads.
+// "serialized" sends one request of each type at a time (max 1 connection, as with the old per-verb lock),
+// "pooled" lets each thread use its own handle, which keeps its own connection (connections are not shared between handles).
+// warm_rest_session() warms GET handles only - each order handle opens its connection with its first order, resuming the TLS session.
+// usage: bench_order_concurrency <api_key> <api_secret> [orders_per_thread]
+
+const unsigned int thread_counts[] = { 1, 4, 16 };
+
+struct BenchResult
+{
+    unsigned int orders;
+    unsigned int failed;
+    double seconds;
+};
+
+BenchResult run_bench(SpotClient& client, const unsigned int threads, const unsigned int orders_per_thread)
+{
+    std::atomic<unsigned int> failed{ 0 };
+    std::vector<std::thread> order_threads;
+    order_threads.reserve(threads);
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (unsigned int i = 0; i < threads; i++)
+    {
+        order_threads.emplace_back([&]()
+            {
+                Params order_params{};
+                order_params.set_param<std::string>("symbol", "BTCUSDT");
+                order_params.set_param<std::string>("side", "BUY");
+                order_params.set_param<std::string>("type", "LIMIT");
+                order_params.set_param<std::string>("timeInForce", "GTC");
+                order_params.set_param<std::string>("quantity", "0.001");
+                order_params.set_param<std::string>("price", "10000");
+
+                for (unsigned int n = 0; n < orders_per_thread; n++)
+                {
+                    try
+                    {
+                        RestResponse response = client.test_new_order(&order_params);
+                        if (!response["code"].error()) failed++; // error responses hold a code
+                    }
+                    catch (ClientException& e)
+                    {
+                        failed++;
+                    }
+                }
+            });
+    }
+    for (std::thread& order_thread : order_threads)
+    {
+        order_thread.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return BenchResult{ threads * orders_per_thread, failed.load(), elapsed.count() };
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        std::cout << "usage: " << argv[0] << " <api_key> <api_secret> [orders_per_thread]\n";
+        return 1;
+    }
+    unsigned int orders_per_thread = argc > 3 ? std::stoul(argv[3]) : 50;
+
+    try
+    {
+        SpotClient my_client{ argv[1], argv[2] };
+        my_client.warm_rest_session(16);
+
+        for (unsigned int max_connections : { 1, 0 })
+        {
+            my_client.rest_set_max_connections(max_connections);
+            std::cout << "\n" << (max_connections ? "serialized" : "pooled") << ":\n";
+
+            for (unsigned int threads : thread_counts)
+            {
+                BenchResult result = run_bench(my_client, threads, orders_per_thread);
+
+                std::cout << "  threads: " << threads
+                    << "  orders: " << result.orders
+                    << "  failed: " << result.failed
+                    << "  orders/sec: " << result.orders / result.seconds << "\n";
+            }
+        }
+    }
+    catch (ClientException& e)
+    {
+        std::cout << "\nan exception has occurred: " << e.what();
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "../include/Binance_Client.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Cost of generating the full path of a signed 8-parameter order:
+// the previous string concatenation (+ one-shot HMAC) vs 'QueryBuilder' (+ 'HMACSigner'), which 'Client::_generate_path()' uses.
+// Heap allocations are counted by replacing the global operator new.
+// usage: bench_query [iterations]
+
+static size_t allocation_count{ 0 };
+
+void* operator new(std::size_t size)
+{
+    allocation_count++;
+    if (void* ptr = std::malloc(size)) return ptr;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+const std::string bench_secret = "NhqPtmdSJYdKjVHjA7PZj4Mge3R5YNiP1e3UZjInClVN65XAbvqqM6A7H5fATj0j";
+const std::string bench_base = "https://api.binance.com";
+const unsigned long long bench_timestamp = 1700000000000;
+
+// the query generation before QueryBuilder, for comparison
+std::string legacy_full_path(const std::string& endpoint, const Params* params_ptr)
+{
+    std::string query{};
+    for (const Params::Param& param : *params_ptr)
+    {
+        if (!query.empty()) query += "&";
+        query += (param.key + "=" + param.value);
+    }
+    query = query + "&timestamp=";
+    query += std::to_string(bench_timestamp);
+    std::string signature = HMACsha256(query, bench_secret);
+    query += "&signature=" + signature;
+    query = "?" + query;
+
+    std::string full_path = bench_base + endpoint;
+    return full_path + query;
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int iterations = argc > 1 ? std::stoul(argv[1]) : 1000000;
+
+    Params order_params{};
+    order_params.set_param<std::string>("symbol", "BTCUSDT");
+    order_params.set_param<std::string>("side", "BUY");
+    order_params.set_param<std::string>("type", "LIMIT");
+    order_params.set_param<std::string>("timeInForce", "GTC");
+    order_params.set_param<std::string>("quantity", "0.00100000");
+    order_params.set_param<std::string>("price", "27123.45000000");
+    order_params.set_param<std::string>("newClientOrderId", "bench_order_01");
+    order_params.set_param<std::string>("recvWindow", "5000");
+
+    HMACSigner signer{ bench_secret };
+    QueryBuilder query_builder{};
+
+    query_builder.reset(bench_base, "/api/v3/order");
+    query_builder.append_params(&order_params);
+    query_builder.append_timestamp(bench_timestamp);
+    query_builder.sign(signer);
+    if (query_builder.str() != legacy_full_path("/api/v3/order", &order_params))
+    {
+        std::cout << "paths do not match\n";
+        return 1;
+    }
+
+    size_t checksum{ 0 }; // keeps the results alive
+
+    size_t allocations_before = allocation_count;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        checksum += legacy_full_path("/api/v3/order", &order_params).size();
+    }
+    std::chrono::duration<double, std::nano> legacy_time = std::chrono::steady_clock::now() - start;
+    size_t legacy_allocations = allocation_count - allocations_before;
+
+    allocations_before = allocation_count;
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < iterations; i++)
+    {
+        query_builder.reset(bench_base, "/api/v3/order");
+        query_builder.append_params(&order_params);
+        query_builder.append_timestamp(bench_timestamp);
+        query_builder.sign(signer);
+        checksum += query_builder.str().size();
+    }
+    std::chrono::duration<double, std::nano> builder_time = std::chrono::steady_clock::now() - start;
+    size_t builder_allocations = allocation_count - allocations_before;
+
+    std::cout << "string concatenation: " << legacy_time.count() / iterations << " ns/order, "
+        << static_cast<double>(legacy_allocations) / iterations << " allocations/order\n";
+    std::cout << "QueryBuilder:         " << builder_time.count() / iterations << " ns/order, "
+        << static_cast<double>(builder_allocations) / iterations << " allocations/order\n";
+    std::cout << "(checksum " << checksum << ")\n";
+
+    return 0;
+}
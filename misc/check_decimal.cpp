@@ -0,0 +1,95 @@
+#undef NDEBUG // the checks are asserts - kept in release builds
+#include "../include/Binance_Client.h"
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+
+// Checks of 'Decimal': strings round-trip through 'parse' / 'format', comparisons are exact between scales,
+// and rescaling rounds half away from zero and refuses values that do not fit 18 digits.
+// usage: check_decimal (aborts on the first failed check)
+
+Decimal parsed(std::string_view text)
+{
+    Decimal value;
+    assert(Decimal::parse(text, value));
+    return value;
+}
+
+void check_round_trip()
+{
+    const char* texts[] = { "27100.10", "0.00000100", "-0.5", "100", "0", "0.000000000000000001", "999999999999999999", "-123456789.123456789" };
+    for (const char* text : texts)
+    {
+        assert(parsed(text).to_string() == text);
+    }
+
+    assert(parsed("27100.10").units() == 2710010 && parsed("27100.10").scale() == 2); // the scale of the string is kept
+    assert(parsed("007.50").to_string() == "7.50"); // leading zeros are not
+    assert(parsed("1.12345678901234567000").to_string() == "1.12345678901234567"); // trailing zeros past 18 digits are dropped without loss
+
+    Decimal value;
+    const char* invalid_texts[] = { "", "-", ".", "abc", "1.2.3", "1e5", " 1", "1,5", "1234567890123456789" };
+    for (const char* text : invalid_texts)
+    {
+        assert(!Decimal::parse(text, value));
+    }
+
+    assert(Decimal::parse("27100.125", 2, value) && value.to_string() == "27100.13");
+    assert(!Decimal::parse("1", 19, value));
+}
+
+void check_comparison()
+{
+    assert(parsed("27100.1") == parsed("27100.10000000"));
+    assert(parsed("27100.10000001") > parsed("27100.1"));
+    assert(parsed("0.1") > parsed("0.09999999"));
+    assert(parsed("0.09999999") < parsed("0.1"));
+    assert(parsed("1") != parsed("1.00000001"));
+    assert(parsed("-1.5") < parsed("-1.49"));
+    assert(parsed("-0.5") < parsed("0.5"));
+    assert(parsed("-0.00") == parsed("0"));
+    assert(parsed("2") >= parsed("2.0") && parsed("2") <= parsed("2.0"));
+
+    // the scales differ by more digits than the units can be scaled up by
+    assert(Decimal(900000000000000000, 0) > Decimal(1, 18));
+    assert(Decimal(1, 18) < Decimal(900000000000000000, 0));
+    assert(Decimal(1, 0) == Decimal(1000000000000000000, 18));
+}
+
+void check_rescale()
+{
+    assert(Decimal(27100125, 3).rescale(2) == parsed("27100.13")); // half away from zero
+    assert(Decimal(-27100125, 3).rescale(2) == parsed("-27100.13"));
+    assert(Decimal(27100124, 3).rescale(2) == parsed("27100.12"));
+    assert(Decimal(5, 1).rescale(0) == parsed("1"));
+    assert(Decimal(-5, 1).rescale(0) == parsed("-1"));
+    assert(parsed("27100.1").rescale(8).to_string() == "27100.10000000");
+
+    Decimal value;
+    assert(!Decimal(1000000000, 0).rescale(18, value)); // does not fit 18 digits
+    assert(!Decimal(1, 0).rescale(Decimal::MAX_SCALE + 1, value));
+    assert(Decimal(1000000000, 0).rescale(18).units() == INT64_MAX); // saturated
+    assert(Decimal(1, 0).rescale(Decimal::MAX_SCALE + 1).scale() == Decimal::MAX_SCALE); // clamped
+
+    assert(Decimal::scale_of("0.01000000") == 2);
+    assert(Decimal::scale_of("1.00000000") == 0);
+    assert(Decimal::scale_of("10") == 0);
+    assert(Decimal::scale_of("0.00000001") == 8);
+
+    assert(Decimal::from_double(27100.1, 2) == parsed("27100.10"));
+    assert(Decimal::from_double(0.1 + 0.2, 8) == parsed("0.3"));
+    assert(!Decimal::from_double(1e300, 2, value));
+    assert(!Decimal::from_double(std::nan(""), 2, value));
+    assert(!Decimal::from_double(1, Decimal::MAX_SCALE + 1, value));
+}
+
+int main()
+{
+    check_round_trip();
+    check_comparison();
+    check_rescale();
+
+    std::cout << "check_decimal: all checks passed\n";
+    return 0;
+}
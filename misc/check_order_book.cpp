@@ -0,0 +1,115 @@
+#undef NDEBUG // the checks are asserts - kept in release builds
+#include "../include/Binance_Client.h"
+
+#include <cassert>
+#include <iostream>
+
+// Checks of the sequencing of 'L2Book' on a fabricated snapshot and diff depth events:
+// stale events are skipped, gaps are reported without touching the book, and levels are applied by exact price -
+// spot events follow U / u, futures events follow U / u on the first event after the snapshot, then pu.
+// usage: check_order_book (aborts on the first failed check)
+
+const std::string SNAPSHOT = "{\"lastUpdateId\":100,\"bids\":[[\"27100.00\",\"2.000\"],[\"27100.10\",\"1.500\"]],\"asks\":[[\"27100.30\",\"1.000\"],[\"27100.20\",\"0.500\"]]}";
+
+Decimal parsed(std::string_view text)
+{
+    Decimal value;
+    assert(Decimal::parse(text, value));
+    return value;
+}
+
+DepthUpdateEvent depth_update(const uint64_t first_update_id, const uint64_t final_update_id, const uint64_t previous_final_update_id)
+{
+    DepthUpdateEvent event{};
+    event.first_update_id = first_update_id;
+    event.final_update_id = final_update_id;
+    event.previous_final_update_id = previous_final_update_id;
+    return event;
+}
+
+void load(L2Book& book, ParserPool& pool)
+{
+    RestResponse snapshot{ &pool, SNAPSHOT };
+    assert(book.load_snapshot(snapshot));
+    assert(book.last_update_id() == 100);
+
+    BestBidAsk best = book.best_bid_ask();
+    assert(best.bid_price == parsed("27100.1") && best.bid_quantity == parsed("1.5")); // snapshot levels are sorted
+    assert(best.ask_price == parsed("27100.2") && best.ask_quantity == parsed("0.5"));
+}
+
+void check_spot(ParserPool& pool)
+{
+    L2Book book{ false };
+    load(book, pool);
+
+    assert(book.apply(depth_update(90, 100, 0)) == BookUpdateResult::stale); // u <= lastUpdateId
+
+    DepthUpdateEvent event = depth_update(95, 105, 0); // U <= lastUpdateId + 1 <= u
+    event.bids.push_back(PriceLevel{ parsed("27100.1"), parsed("0") }); // removes "27100.10" - prices compare across scales
+    event.asks.push_back(PriceLevel{ parsed("27100.15"), parsed("0.25") });
+    assert(book.apply(event) == BookUpdateResult::applied);
+
+    BestBidAsk best = book.best_bid_ask();
+    assert(best.update_id == 105);
+    assert(best.bid_price == parsed("27100.00") && best.bid_quantity == parsed("2"));
+    assert(best.ask_price == parsed("27100.15") && best.ask_quantity == parsed("0.25"));
+
+    assert(book.apply(depth_update(100, 105, 0)) == BookUpdateResult::stale); // already applied
+    assert(book.apply(depth_update(106, 110, 0)) == BookUpdateResult::applied); // U == the book id + 1
+    assert(book.apply(depth_update(112, 115, 0)) == BookUpdateResult::gap); // 111 was missed
+
+    event = depth_update(112, 115, 0);
+    event.bids.push_back(PriceLevel{ parsed("27200"), parsed("1") });
+    assert(book.apply(event) == BookUpdateResult::gap);
+    assert(book.last_update_id() == 110 && book.best_bid_ask().bid_price == parsed("27100")); // not applied
+
+    std::vector<PriceLevel> levels;
+    book.asks(10, levels);
+    assert(levels.size() == 3 && levels[0].price == parsed("27100.15") && levels[2].price == parsed("27100.30")); // best first
+}
+
+void check_futures(ParserPool& pool)
+{
+    L2Book book{ true };
+    load(book, pool);
+
+    assert(book.apply(depth_update(90, 99, 80)) == BookUpdateResult::stale); // first event: u < lastUpdateId
+    assert(book.apply(depth_update(101, 110, 100)) == BookUpdateResult::gap); // first event: U > lastUpdateId
+    assert(book.apply(depth_update(95, 105, 90)) == BookUpdateResult::applied); // U <= lastUpdateId <= u - pu is not checked
+    assert(book.apply(depth_update(100, 105, 95)) == BookUpdateResult::stale); // u <= the book id
+    assert(book.apply(depth_update(106, 110, 104)) == BookUpdateResult::gap); // pu != u of the previous event
+    assert(book.last_update_id() == 105);
+    assert(book.apply(depth_update(106, 110, 105)) == BookUpdateResult::applied);
+    assert(book.apply(depth_update(108, 112, 110)) == BookUpdateResult::applied); // U may overlap - only pu is followed
+    assert(book.last_update_id() == 112);
+
+    L2Book first_event_book{ true }; // the first event may also end exactly at lastUpdateId
+    load(first_event_book, pool);
+    assert(first_event_book.apply(depth_update(95, 100, 90)) == BookUpdateResult::applied);
+    assert(first_event_book.apply(depth_update(101, 105, 99)) == BookUpdateResult::gap);
+}
+
+void check_snapshot_error(ParserPool& pool)
+{
+    L2Book book{ false };
+    load(book, pool);
+
+    RestResponse error_response{ &pool, "{\"code\":-1121,\"msg\":\"Invalid symbol.\"}" };
+    assert(!book.load_snapshot(error_response));
+
+    BestBidAsk best = book.best_bid_ask();
+    assert(best.bid_price.is_zero() && best.ask_price.is_zero() && best.update_id == 0); // the book is emptied
+}
+
+int main()
+{
+    ParserPool pool{};
+
+    check_spot(pool);
+    check_futures(pool);
+    check_snapshot_error(pool);
+
+    std::cout << "check_order_book: all checks passed\n";
+    return 0;
+}
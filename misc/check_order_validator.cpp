@@ -0,0 +1,134 @@
+#undef NDEBUG // the checks are asserts - kept in release builds
+#include "../include/Binance_Client.h"
+
+#include <cassert>
+#include <iostream>
+
+// Checks of 'OrderValidator' on the filters of a fabricated exchangeInfo, at the tick and step boundaries:
+// the reject policy passes prices and quantities on the grid and rejects those off it or out of bounds,
+// the normalize policy rounds prices to the tick (down for buys, up for sells) and quantities down to the step.
+// usage: check_order_validator (aborts on the first failed check)
+
+const std::string EXCHANGE_INFO = "{\"symbols\":["
+    "{\"symbol\":\"BTCUSDT\",\"status\":\"TRADING\",\"filters\":["
+        "{\"filterType\":\"PRICE_FILTER\",\"minPrice\":\"0.01000000\",\"maxPrice\":\"1000000.00000000\",\"tickSize\":\"0.01000000\"},"
+        "{\"filterType\":\"LOT_SIZE\",\"minQty\":\"0.00001000\",\"maxQty\":\"9000.00000000\",\"stepSize\":\"0.00001000\"},"
+        "{\"filterType\":\"NOTIONAL\",\"minNotional\":\"5.00000000\"}]},"
+    "{\"symbol\":\"ETHUSDT\",\"status\":\"TRADING\",\"filters\":[" // the grid of prices starts at minPrice, not at 0
+        "{\"filterType\":\"PRICE_FILTER\",\"minPrice\":\"0.02\",\"maxPrice\":\"0\",\"tickSize\":\"0.05\"},"
+        "{\"filterType\":\"LOT_SIZE\",\"minQty\":\"0.001\",\"maxQty\":\"0\",\"stepSize\":\"0.001\"}]},"
+    "{\"symbol\":\"LUNAUSDT\",\"status\":\"BREAK\",\"filters\":[]}]}";
+
+class FixedIndex : public SymbolIndex
+    // an index of a fixed exchangeInfo, without a client
+{
+public:
+    FixedIndex(ParserPool& pool, const std::string& exchange_info)
+    {
+        RestResponse response{ &pool, exchange_info };
+        SymbolTable::SymbolRows rows;
+        assert(SymbolTable::read_symbols(response, rows) && rows.size() == 3);
+
+        std::shared_ptr<SymbolTable> table = std::make_shared<SymbolTable>();
+        table->assign(rows);
+        this->_publish(table);
+    }
+};
+
+const Params& order(Params& params, const std::string& symbol, const std::string& side, const std::string& price, const std::string& quantity)
+{
+    params.flush_params();
+    params.set_param<std::string>("symbol", symbol);
+    params.set_param<std::string>("side", side);
+    params.set_param<std::string>("type", price.empty() ? "MARKET" : "LIMIT");
+    if (!price.empty()) params.set_param<std::string>("price", price);
+    params.set_param<std::string>("quantity", quantity);
+    return params;
+}
+
+std::string rejection(const OrderValidator& validator, const Params& params)
+{
+    try
+    {
+        validator.validate_order(&params);
+        return "";
+    }
+    catch (const OrderRejected& e)
+    {
+        return e.reason;
+    }
+}
+
+void check_reject(const SymbolIndex& index)
+{
+    OrderValidator validator{ index, OrderValidationPolicy::reject };
+    Params params{};
+
+    order(params, "BTCUSDT", "BUY", "27100.01", "0.001");
+    assert(validator.validate_order(&params) == &params); // sent as it is
+
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "27100.010000", "0.00100")) == ""); // on the grid, at a larger scale
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "27100.015", "0.001")) == "price_filter"); // between two ticks
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "0.01", "9000")) == ""); // minPrice, maxQty
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "0.009", "9000")) == "price_filter");
+    assert(rejection(validator, order(params, "BTCUSDT", "SELL", "1000000.00", "0.00001")) == ""); // maxPrice, minQty
+    assert(rejection(validator, order(params, "BTCUSDT", "SELL", "1000000.01", "0.00001")) == "price_filter");
+
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "27100.01", "0.000015")) == "lot_size"); // between two steps
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "1000000", "0.000009")) == "lot_size");
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "0.01", "9000.00001")) == "lot_size");
+
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "100.00", "0.05")) == ""); // exactly minNotional
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "100.00", "0.04999")) == "min_notional");
+
+    assert(rejection(validator, order(params, "ETHUSDT", "BUY", "100.07", "0.001")) == ""); // minPrice + n * tickSize
+    assert(rejection(validator, order(params, "ETHUSDT", "BUY", "100.05", "0.001")) == "price_filter"); // a multiple of tickSize only
+    assert(rejection(validator, order(params, "ETHUSDT", "BUY", "0.01", "0.001")) == "price_filter"); // below minPrice (maxPrice "0" is no bound)
+
+    assert(rejection(validator, order(params, "XYZUSDT", "BUY", "1", "1")) == "unknown_symbol");
+    assert(rejection(validator, order(params, "LUNAUSDT", "BUY", "1", "1")) == "symbol_not_trading");
+}
+
+void check_normalize(const SymbolIndex& index)
+{
+    OrderValidator validator{ index, OrderValidationPolicy::normalize };
+    Params params{};
+
+    order(params, "BTCUSDT", "BUY", "27100.017", "0.0019999");
+    const Params* normalized = validator.validate_order(&params);
+    assert(normalized != &params && *params.get_param("price") == "27100.017"); // a copy - the order is unchanged
+    assert(*normalized->get_param("price") == "27100.01"); // down for buys
+    assert(*normalized->get_param("quantity") == "0.00199"); // always down
+
+    order(params, "BTCUSDT", "SELL", "27100.011", "0.00100");
+    normalized = validator.validate_order(&params);
+    assert(*normalized->get_param("price") == "27100.02"); // up for sells
+    assert(*normalized->get_param("quantity") == "0.00100");
+
+    order(params, "BTCUSDT", "SELL", "27100.01", "0.001");
+    assert(*validator.validate_order(&params)->get_param("price") == "27100.01");
+
+    order(params, "ETHUSDT", "BUY", "100.05", "0.0015");
+    normalized = validator.validate_order(&params);
+    assert(*normalized->get_param("price") == "100.02" && *normalized->get_param("quantity") == "0.001"); // onto the grid of minPrice
+
+    order(params, "ETHUSDT", "SELL", "100.05", "0.001");
+    assert(*validator.validate_order(&params)->get_param("price") == "100.07");
+
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "1000", "0.000009")) == "lot_size"); // rounded down to 0
+    assert(rejection(validator, order(params, "BTCUSDT", "SELL", "1000000.001", "0.001")) == "price_filter"); // rounded up past maxPrice
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "100.00", "0.0499999")) == "min_notional"); // checked after rounding
+    assert(rejection(validator, order(params, "BTCUSDT", "BUY", "100.009", "0.0500099")) == ""); // 100.00 * 0.05
+}
+
+int main()
+{
+    ParserPool pool{};
+    FixedIndex index{ pool, EXCHANGE_INFO };
+
+    check_reject(index);
+    check_normalize(index);
+
+    std::cout << "check_order_validator: all checks passed\n";
+    return 0;
+}
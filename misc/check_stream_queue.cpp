@@ -0,0 +1,136 @@
+#undef NDEBUG // the checks are asserts - kept in release builds
+#include "../include/Binance_Client.h"
+
+#include <cassert>
+#include <iostream>
+
+// Checks of 'StreamQueue' when the consumer falls behind, under each overflow policy:
+// 'drop_oldest' keeps the newest messages, 'block' holds the producer until there is room (or the queue is closed),
+// 'conflate' keeps the latest message of each key after the ring is full, and hands them over after the ring.
+// usage: check_stream_queue (aborts on the first failed check)
+
+struct Collector
+{
+    std::vector<std::string> messages;
+
+    void operator()(std::string& message)
+    {
+        messages.push_back(message);
+    }
+};
+
+std::string trade(const std::string& symbol, const unsigned int trade_id)
+{
+    return "{\"e\":\"trade\",\"s\":\"" + symbol + "\",\"t\":" + std::to_string(trade_id) + "}";
+}
+
+std::vector<std::string> drain(StreamQueue& queue)
+{
+    Collector collector{};
+    while (queue.poll(collector));
+    return collector.messages;
+}
+
+void check_drop_oldest()
+{
+    StreamQueue queue{ 3, QueueOverflowPolicy::drop_oldest };
+    assert(queue.capacity() == 4); // rounded up to a power of 2
+
+    for (unsigned int trade_id = 0; trade_id < 6; trade_id++)
+    {
+        assert(queue.push(trade("BTCUSDT", trade_id))); // never waits
+    }
+    assert(queue.size() == 4 && queue.dropped() == 2);
+
+    std::vector<std::string> messages = drain(queue);
+    assert(messages.size() == 4 && messages.front() == trade("BTCUSDT", 2) && messages.back() == trade("BTCUSDT", 5)); // the newest, in order
+    assert(queue.size() == 0 && queue.conflated() == 0);
+
+    assert(queue.push(trade("BTCUSDT", 6)) && drain(queue).size() == 1); // the ring is reused
+}
+
+void check_block()
+{
+    StreamQueue queue{ 2, QueueOverflowPolicy::block };
+    std::atomic<unsigned int> pushed{ 0 };
+
+    std::thread producer([&queue, &pushed]()
+        {
+            for (unsigned int trade_id = 0; trade_id < 4; trade_id++)
+            {
+                assert(queue.push(trade("BTCUSDT", trade_id)));
+                pushed++;
+            }
+        });
+
+    while (pushed < 2) std::this_thread::yield();
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    assert(pushed == 2 && queue.size() == 2); // waits for room
+
+    Collector collector{};
+    assert(queue.wait(collector));
+    while (pushed < 3) std::this_thread::yield(); // a slot was released
+    while (collector.messages.size() < 4) queue.wait(collector);
+    producer.join();
+
+    assert(collector.messages.front() == trade("BTCUSDT", 0) && collector.messages.back() == trade("BTCUSDT", 3)); // none lost
+    assert(queue.dropped() == 0);
+
+    assert(queue.push(trade("BTCUSDT", 4)) && queue.push(trade("BTCUSDT", 5))); // full again
+    std::thread blocked_producer([&queue]()
+        {
+            assert(!queue.push(trade("BTCUSDT", 6))); // woken up by close, not queued
+        });
+    std::this_thread::sleep_for(std::chrono::milliseconds{ 50 });
+    queue.close();
+    blocked_producer.join();
+    assert(queue.closed() && !queue.push(trade("BTCUSDT", 7)));
+    assert(drain(queue).size() == 2); // queued messages are still consumed after close
+}
+
+void check_conflate()
+{
+    StreamQueue queue{ 2, QueueOverflowPolicy::conflate };
+
+    assert(queue.push(trade("BTCUSDT", 0)) && queue.push(trade("ETHUSDT", 0))); // fills the ring
+    assert(queue.push(trade("BTCUSDT", 1)));
+    assert(queue.push(trade("ETHUSDT", 1)));
+    assert(queue.push(trade("BTCUSDT", 2))); // replaces BTCUSDT 1
+    assert(queue.conflated() == 1 && queue.dropped() == 0);
+
+    Collector collector{};
+    assert(queue.poll(collector) && collector.messages.back() == trade("BTCUSDT", 0)); // the ring first
+    assert(queue.push(trade("ETHUSDT", 2))); // still conflated while older messages are kept, though the ring has room
+    assert(queue.conflated() == 2);
+
+    std::vector<std::string> messages = drain(queue);
+    assert(messages.size() == 3);
+    assert(messages[0] == trade("ETHUSDT", 0)); // the rest of the ring
+    assert(messages[1] == trade("BTCUSDT", 2) && messages[2] == trade("ETHUSDT", 2)); // the latest of each key, in the order the keys were first seen
+
+    assert(queue.push(trade("BTCUSDT", 3)) && queue.size() == 1); // back to the ring once the conflated messages were taken
+
+    StreamQueue combined_queue{ 2, QueueOverflowPolicy::conflate }; // messages of combined streams are keyed by stream name
+    const std::string ticker_0 = "{\"stream\":\"btcusdt@bookTicker\",\"data\":{\"u\":0,\"s\":\"BTCUSDT\"}}";
+    const std::string ticker_1 = "{\"stream\":\"btcusdt@bookTicker\",\"data\":{\"u\":1,\"s\":\"BTCUSDT\"}}";
+    const std::string trade_0 = "{\"stream\":\"btcusdt@trade\",\"data\":{\"t\":0,\"s\":\"BTCUSDT\"}}";
+    const std::string trade_1 = "{\"stream\":\"btcusdt@trade\",\"data\":{\"t\":1,\"s\":\"BTCUSDT\"}}";
+    for (const std::string* message : { &ticker_0, &trade_0, &ticker_0, &trade_0, &ticker_1, &trade_1 })
+    {
+        assert(combined_queue.push(*message));
+    }
+    assert(combined_queue.conflated() == 2);
+
+    messages = drain(combined_queue);
+    assert(messages.size() == 4 && messages[2] == ticker_1 && messages[3] == trade_1);
+}
+
+int main()
+{
+    check_drop_oldest();
+    check_block();
+    check_conflate();
+
+    std::cout << "check_stream_queue: all checks passed\n";
+    return 0;
+}
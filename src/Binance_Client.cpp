@@ -33,10 +33,10 @@ Client<T>::Client(T& exchange_client) : _public_client{ 1 }, refresh_listenkey_i
 		this->_ws_client = new WebsocketClient<T>{ &exchange_client, "", 0 };
 		this->init_ws_session();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -51,23 +51,29 @@ Client<T>::Client(T& exchange_client, const std::string key, const std::string s
 {
 	try
 	{
+		this->_signer = new HMACSigner{ this->_api_secret };
 		this->init_rest_session();
 		this->_ws_client = new WebsocketClient<T>{ &exchange_client, "", 0 }; 
 		this->init_ws_session();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
+		delete this->_signer; // the destructor is not called for a constructor that throws
+		this->_signer = nullptr;
+
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
 /**
-	The destructor - no dynamic memory is used
+	The destructor
 */
 template <typename T>
 Client<T>::~Client()
-{};
+{
+	delete this->_signer;
+};
 
 
 //  ------------------------------ End | Client General methods - Infrastructure
@@ -84,10 +90,10 @@ void Client<T>::init_ws_session()
 	{
 		static_cast<T*>(this)->v_init_ws_session();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -102,10 +108,10 @@ std::string Client<T>::get_listen_key()
 	{
 		return static_cast<T*>(this)->v_get_listen_key();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 	
@@ -115,16 +121,16 @@ std::string Client<T>::get_listen_key()
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::ping_listen_key(const std::string& listen_key) 
+RestResponse Client<T>::ping_listen_key(const std::string& listen_key) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_ping_listen_key(listen_key);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -134,16 +140,16 @@ simdjson::dom::element Client<T>::ping_listen_key(const std::string& listen_key)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::revoke_listen_key(const std::string& listen_key)
+RestResponse Client<T>::revoke_listen_key(const std::string& listen_key)
 {
 	try
 	{
 		return static_cast<T*>(this)->v_revoke_listen_key(listen_key);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -163,10 +169,10 @@ unsigned long long Client<T>::exchange_time()
 	{
 		return static_cast<T*>(this)->v_exchange_time();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -181,10 +187,10 @@ bool Client<T>::ping_client()
 	{
 		return static_cast<T*>(this)->v_ping_client();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -193,16 +199,16 @@ bool Client<T>::ping_client()
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::exchange_info()
+RestResponse Client<T>::exchange_info()
 {
 	try
 	{
 		return static_cast<T*>(this)->v_exchange_info();
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -212,16 +218,16 @@ simdjson::dom::element Client<T>::exchange_info()
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::order_book(const Params* params_ptr) 
+RestResponse Client<T>::order_book(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_order_book(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -231,16 +237,16 @@ simdjson::dom::element Client<T>::order_book(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::public_trades_recent(const Params* params_ptr)
+RestResponse Client<T>::public_trades_recent(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<T*>(this)->v_public_trades_recent(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -250,16 +256,16 @@ simdjson::dom::element Client<T>::public_trades_recent(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::public_trades_historical(const Params* params_ptr) 
+RestResponse Client<T>::public_trades_historical(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_public_trades_historical(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -269,16 +275,16 @@ simdjson::dom::element Client<T>::public_trades_historical(const Params* params_
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::public_trades_agg(const Params* params_ptr) 
+RestResponse Client<T>::public_trades_agg(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_public_trades_agg(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -288,16 +294,16 @@ simdjson::dom::element Client<T>::public_trades_agg(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::klines(const Params* params_ptr)
+RestResponse Client<T>::klines(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<T*>(this)->v_klines(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -307,16 +313,16 @@ simdjson::dom::element Client<T>::klines(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::daily_ticker_stats(const Params* params_ptr)
+RestResponse Client<T>::daily_ticker_stats(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<T*>(this)->v_daily_ticker_stats(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -326,16 +332,16 @@ simdjson::dom::element Client<T>::daily_ticker_stats(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::get_ticker(const Params* params_ptr)
+RestResponse Client<T>::get_ticker(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<T*>(this)->v_get_ticker(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -345,16 +351,16 @@ simdjson::dom::element Client<T>::get_ticker(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::get_order_book_ticker(const Params* params_ptr) 
+RestResponse Client<T>::get_order_book_ticker(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_get_order_book_ticker(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -369,16 +375,17 @@ simdjson::dom::element Client<T>::get_order_book_ticker(const Params* params_ptr
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::test_new_order(const Params* params_ptr) 
+RestResponse Client<T>::test_new_order(const Params* params_ptr) 
 {
 	try
 	{
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
 		return static_cast<T*>(this)->v_test_new_order(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -388,16 +395,17 @@ simdjson::dom::element Client<T>::test_new_order(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::new_order(const Params* params_ptr) 
+RestResponse Client<T>::new_order(const Params* params_ptr) 
 {
 	try
 	{
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
 		return static_cast<T*>(this)->v_new_order(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -407,16 +415,16 @@ simdjson::dom::element Client<T>::new_order(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::cancel_order(const Params* params_ptr) 
+RestResponse Client<T>::cancel_order(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_cancel_order(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -426,16 +434,16 @@ simdjson::dom::element Client<T>::cancel_order(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::cancel_all_orders(const Params* params_ptr) 
+RestResponse Client<T>::cancel_all_orders(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_cancel_all_orders(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -445,16 +453,16 @@ simdjson::dom::element Client<T>::cancel_all_orders(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::query_order(const Params* params_ptr) 
+RestResponse Client<T>::query_order(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_query_order(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -464,16 +472,16 @@ simdjson::dom::element Client<T>::query_order(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::open_orders(const Params* params_ptr) 
+RestResponse Client<T>::open_orders(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_open_orders(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -483,16 +491,16 @@ simdjson::dom::element Client<T>::open_orders(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::all_orders(const Params* params_ptr) 
+RestResponse Client<T>::all_orders(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_all_orders(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -502,16 +510,16 @@ simdjson::dom::element Client<T>::all_orders(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::account_info(const Params* params_ptr) 
+RestResponse Client<T>::account_info(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_account_info(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -521,16 +529,16 @@ simdjson::dom::element Client<T>::account_info(const Params* params_ptr)
 	@return the json returned by the request
 */
 template<typename T>
-simdjson::dom::element Client<T>::account_trades_list(const Params* params_ptr) 
+RestResponse Client<T>::account_trades_list(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<T*>(this)->v_account_trades_list(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -548,10 +556,11 @@ simdjson::dom::element Client<T>::account_trades_list(const Params* params_ptr)
 
 /**
 	Initialize a rest session
+	@param warm_connections - number of keep-alive connections to open in advance
 	@return bool value for success (pings the exchange to determine success)
 */
 template <typename T>
-bool Client<T>::init_rest_session()
+bool Client<T>::init_rest_session(const unsigned int warm_connections)
 {
 	try
 	{
@@ -564,6 +573,8 @@ bool Client<T>::init_rest_session()
 		}
 		if (!(this->ping_client())) return 0;
 
+		if (warm_connections > 1) this->warm_rest_session(warm_connections);
+
 		return 1;
 	}
 	catch (...)
@@ -575,6 +586,41 @@ bool Client<T>::init_rest_session()
 
 }
 
+/**
+	Open keep-alive connections in advance
+	pings are sent concurrently, so each one warms its own GET handle and connection - other handles open their connection
+	with their first request, resuming the shared TLS session
+	@param connections - number of connections to open
+*/
+template <typename T>
+void Client<T>::warm_rest_session(const unsigned int connections)
+{
+	try
+	{
+		std::vector<std::thread> ping_threads;
+		ping_threads.reserve(connections);
+
+		for (unsigned int i = 0; i < connections; i++)
+		{
+			ping_threads.emplace_back([this]()
+				{
+					try { this->ping_client(); }
+					catch (...) {} // a failed warm-up only costs a handshake later on
+				});
+		}
+		for (std::thread& ping_thread : ping_threads)
+		{
+			ping_thread.join();
+		}
+	}
+	catch (...)
+	{
+		BadSetupSessionREST e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+}
+
 /**
 	Send a custom GET request
 	@param base - base URL of request path
@@ -584,18 +630,17 @@ bool Client<T>::init_rest_session()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::custom_get_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
+RestResponse Client<T>::custom_get_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
 {
 	try
 	{
-		std::string query = this->_generate_query(params_ptr, signature);
-		std::string full_path = base + endpoint + query;
+		const std::string& full_path = this->_generate_path(base, endpoint, params_ptr, signature);
 		return this->_rest_client->_getreq(full_path);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -608,18 +653,17 @@ simdjson::dom::element Client<T>::custom_get_req(const std::string& base, const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::custom_post_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
+RestResponse Client<T>::custom_post_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
 {
 	try
 	{
-	std::string query = this->_generate_query(params_ptr, signature);
-	std::string full_path = base + endpoint + query;
+	const std::string& full_path = this->_generate_path(base, endpoint, params_ptr, signature);
 	return this->_rest_client->_postreq(full_path);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -632,18 +676,17 @@ simdjson::dom::element Client<T>::custom_post_req(const std::string& base, const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::custom_put_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
+RestResponse Client<T>::custom_put_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
 {
 	try
 	{
-		std::string query = this->_generate_query(params_ptr, signature);
-		std::string full_path = base + endpoint + query;
+		const std::string& full_path = this->_generate_path(base, endpoint, params_ptr, signature);
 		return this->_rest_client->_putreq(full_path);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 }
 }
 
@@ -656,417 +699,778 @@ simdjson::dom::element Client<T>::custom_put_req(const std::string& base, const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::custom_delete_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
+RestResponse Client<T>::custom_delete_req(const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
 {
 	try
 	{
-		std::string query = this->_generate_query(params_ptr, signature);
-		std::string full_path = base + endpoint + query;
+		const std::string& full_path = this->_generate_path(base, endpoint, params_ptr, signature);
 		return this->_rest_client->_deletereq(full_path);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
 /**
-	Set headers for REST session
-	@param rest_client - a pointer to the RestSession object
-	@return bool - return true if success
+	Build an order book request, for 'async_req()'
+	@param params_ptr - a pointer to the request Params object
+	@return the request
 */
 template <typename T>
-bool Client<T>::set_headers(RestSession* rest_client)
+RestRequest Client<T>::order_book_request(const Params* params_ptr)
 {
 	try
 	{
-	std::string key_header = "X-MBX-APIKEY:" + this->_api_key;
-	struct curl_slist* auth_headers;
-	auth_headers = curl_slist_append(NULL, key_header.c_str());
-
-	curl_easy_setopt((rest_client->_get_handle), CURLOPT_HTTPHEADER, auth_headers);
-	curl_easy_setopt((rest_client->_post_handle), CURLOPT_HTTPHEADER, auth_headers);
-	curl_easy_setopt((rest_client->_put_handle), CURLOPT_HTTPHEADER, auth_headers);
-	curl_easy_setopt((rest_client->_delete_handle), CURLOPT_HTTPHEADER, auth_headers);
-
-	return 1;
+		return static_cast<T*>(this)->v_order_book_request(params_ptr);
 	}
-	catch (ClientException e)
-	{
-		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
-	} 
-	catch (...)
+	catch (ClientException& e)
 	{
-		BadSetupHeadersREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
-	}; 
-
-}
-
-/**
-	Set verbose state for REST session (prints more info regarding requests)
-	@param state - a bool for enabling (1) or disabling (0)
-*/
-template <typename T>
-void Client<T>::rest_set_verbose(const bool& state)
-{
-	if (state) this->_rest_client->set_verbose(1L);
-	else this->_rest_client->set_verbose(0);
+		throw;
+	}
 }
 
 /**
-	Generate a REST request query
+	Build a klines request, for 'async_req()' - i.e: to backfill several ranges in parallel
 	@param params_ptr - a pointer to the request Params object
-	@param sign_query - a bool for whether to sign the request or not
-	@return string - the query generated
+	@return the request
 */
 template <typename T>
-std::string Client<T>::_generate_query(const Params* params_ptr, const bool& sign_query) const
+RestRequest Client<T>::klines_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string query{};
-		bool no_params{ 1 };
-		if (params_ptr && (!params_ptr->empty())) // if ptr passed and it's not empty
-		{
-			no_params = 0;
-			for (std::unordered_map<std::string, std::string>::const_iterator itr = params_ptr->param_map.begin();
-				itr != params_ptr->param_map.end();
-				itr++)
-			{
-
-				if (itr != params_ptr->param_map.begin()) query += "&";
-
-				query += (itr->first + "=" + itr->second);
-			}
-		}
-
-		if (sign_query)
-		{
-			unsigned long long timestamp = local_timestamp();
-			query = no_params ? "timestamp=" : query + "&timestamp=";
-
-			query += std::to_string(timestamp);
-
-			std::string signature = HMACsha256(query, this->_api_secret);
-			query += "&signature=" + signature;
-		}
-
-		query = query.empty() ? "" : ("?" + query); // no need for the question mark if empty
-
-		return query;
-	}
-	catch (ClientException e)
-	{
-		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		return static_cast<T*>(this)->v_klines_request(params_ptr);
 	}
-	catch (...)
+	catch (ClientException& e)
 	{
-		BadQuery e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
-
-//  ------------------------------ End | Client General methods - Infrastructure
-
-
-// ***************************************************************************
-
-
-//  ------------------------------ Start | Client Wallet - User Wallet Endpoints
-
-// ------ Class methods
-
-
 /**
-	A constructor - called directly by the user
-	@param client_obj - the exchange client object
+	Build a test new order request, for 'async_req()' - validated like 'test_new_order()'
+	@param params_ptr - a pointer to the request Params object
+	@return the request
 */
 template <typename T>
-Client<T>::Wallet::Wallet(Client<T>& client_obj)
-	: user_client{ &client_obj } // snatching pointer and releasing later on to avoid deleting this reference
+RestRequest Client<T>::test_new_order_request(const Params* params_ptr)
 {
-	if (user_client->_public_client)
+	try
 	{
-		MissingCredentials e{};
-		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
-	};
-}
-
-/**
-	A constructor - called directly by the user
-	@param client_obj - the exchange client object (constant)
-*/
-template <typename T>
-Client<T>::Wallet::Wallet(const Client<T>& client_obj)
-	: user_client{ &client_obj } // snatching pointer and releasing later on to avoid deleting this reference
-{
-	if (user_client->_public_client)
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
+		return static_cast<T*>(this)->v_test_new_order_request(params_ptr);
+	}
+	catch (ClientException& e)
 	{
-		MissingCredentials e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
-	};
-}
-
-/**
-	A destructor
-	since 'user_client' is a reference to an exchange client outside the class
-	it should be set to nullptr prior deletion
-*/
-template <typename T>
-Client<T>::Wallet::~Wallet()
-{
-	user_client = nullptr;
+		throw;
+	}
 }
 
-// ------ Endpoint methods
-
 /**
-	Get all coins
+	Build a new order request, for 'async_req()' - validated like 'new_order()'
 	@param params_ptr - a pointer to the request Params object
-	@return the json returned by the request
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::get_all_coins(const Params* params_ptr)
+RestRequest Client<T>::new_order_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/capital/config/getall";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
-
-		return response;
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
+		return static_cast<T*>(this)->v_new_order_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Get a daily wallet snapshot
+	Build a cancel order request, for 'async_req()'
 	@param params_ptr - a pointer to the request Params object
-	@return the json returned by the request
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::daily_snapshot(const Params* params_ptr)
+RestRequest Client<T>::cancel_order_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/accountSnapshot";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
-
-		return response;
-
+		return static_cast<T*>(this)->v_cancel_order_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Turn on / off fast withdrawals
-	@param state - 1 to enable, 0 to disable
-	@return the json returned by the request
+	Build a cancel all orders request, for 'async_req()'
+	@param params_ptr - a pointer to the request Params object
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::fast_withdraw_switch(const bool& state)
+RestRequest Client<T>::cancel_all_orders_request(const Params* params_ptr)
 {
 	try
 	{
-		Params temp_params;
-		std::string endpoint = state ? "/sapi/v1/account/enableFastWithdrawSwitch" : "/sapi/v1/account/disableFastWithdrawSwitch";
-		std::string full_path = _BASE_REST_SPOT + endpoint;
-		std::string query = user_client->_generate_query(&temp_params, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
-
-		return response;
+		return static_cast<T*>(this)->v_cancel_all_orders_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Submit a withdraw request
+	Build a query order request, for 'async_req()'
 	@param params_ptr - a pointer to the request Params object
-	@param SAPI - a bool for whether to use SAPI or WAPI endpoint
-	@return the json returned by the request
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::withdraw_balances(const Params* params_ptr)
+RestRequest Client<T>::query_order_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string endpoint = "/sapi/v1/capital/withdraw/apply";
-		std::string full_path = _BASE_REST_SPOT + endpoint;
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
-
-		return response;
+		return static_cast<T*>(this)->v_query_order_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Fetch deposit history
+	Build an open orders request, for 'async_req()'
 	@param params_ptr - a pointer to the request Params object
-	@param network - a bool for whether to use an endpoint that support network
-	@return the json returned by the request
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::deposit_history(const Params* params_ptr)
+RestRequest Client<T>::open_orders_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string endpoint = "/sapi/v1/capital/deposit/hisrec";
-		std::string full_path = _BASE_REST_SPOT + endpoint;
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
-
-		return response;
+		return static_cast<T*>(this)->v_open_orders_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Fetch withdraw history
-	@param params_ptr - a pointer to the request Params object
-	@param network - a bool for whether to fetch with network
-	@return the json returned by the request
+	Build a listen key ping request, for 'async_req()'
+	@param listen_key - a string representing the listen key
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::withdraw_history(const Params* params_ptr)
+RestRequest Client<T>::ping_listen_key_request(const std::string& listen_key)
 {
 	try
 	{
-		std::string endpoint = "/sapi/v1/capital/withdraw/history";
-		std::string full_path = _BASE_REST_SPOT + endpoint;
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
-
-		return response;
+		return static_cast<T*>(this)->v_ping_listen_key_request(listen_key);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Fetch deposit address 
+	Build a custom request, for 'async_req()'
+	@param request_type - the type of the request
+	@param base - base URL of request path
+	@param endpoint - endpoint of request path
 	@param params_ptr - a pointer to the request Params object
-	@param network - a bool for whether to fetch with network
-	@return the json returned by the request
+	@bool signature - a bool for whether to sign the request or not
+	@return the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::deposit_address(const Params* params_ptr)
+RestRequest Client<T>::custom_request(const RestRequestType request_type, const std::string& base, const std::string& endpoint, const Params* params_ptr, const bool& signature)
 {
 	try
 	{
-		std::string endpoint = "/sapi/v1/capital/deposit/address";
-		std::string full_path = _BASE_REST_SPOT + endpoint;
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
-
-		return response;
+		return this->_build_request(request_type, base, endpoint, params_ptr, signature);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Convert dust assets to BNB
-	@param params_ptr - a pointer to the request Params object
-	@return the json returned by the request
+	Send a request asynchronously, on the event loop of the REST session
+	the request is built (and signed) when its builder is called, so its Params may be reused before sending it
+	i.e: client.async_req(client.new_order_request(&params));
+
+	@param request - a request built by this client
+	@return a future of the response - holds BadRequestREST if the request failed
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::dust_transfer(const Params* params_ptr)
+std::future<RestResponse> Client<T>::async_req(const RestRequest& request)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/asset/dust";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		if (request.session != this->_rest_client) // signed for another client's key
+		{
+			BadRequestREST e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
 
-		return response;
+		return this->_rest_client->_asyncreq(request.full_path, request.request_type);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Query asset dividend record
-	@param params_ptr - a pointer to the request Params object
-	@return the json returned by the request
+	Send a request asynchronously, on the event loop of the REST session
+	@param request - a request built by this client
+	@param callback - called with a 'RestResponse&' on the event loop thread (empty if the request failed)
+		must not make blocking requests - they would wait for the event loop it runs on, and throw instead. use 'async_req()' from it
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::asset_dividend_records(const Params* params_ptr)
+void Client<T>::async_req(const RestRequest& request, std::function<void(RestResponse&)> callback)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/asset/assetDividend";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		if (request.session != this->_rest_client) // signed for another client's key
+		{
+			BadRequestREST e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
 
-		return response;
+		this->_rest_client->_asyncreq(request.full_path, request.request_type, std::move(callback));
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Make User Universal Transfer
+	Set headers for REST session
+	@param rest_client - a pointer to the RestSession object
+	@return bool - return true if success
+*/
+template <typename T>
+bool Client<T>::set_headers(RestSession* rest_client)
+{
+	try
+	{
+	std::string key_header = "X-MBX-APIKEY:" + this->_api_key;
+	struct curl_slist* auth_headers;
+	auth_headers = curl_slist_append(NULL, key_header.c_str());
+
+	rest_client->set_headers(auth_headers);
+
+	return 1;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	} 
+	catch (...)
+	{
+		BadSetupHeadersREST e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}; 
+
+}
+
+/**
+	Set verbose state for REST session (prints more info regarding requests)
+	@param state - a bool for enabling (1) or disabling (0)
+*/
+template <typename T>
+void Client<T>::rest_set_verbose(const bool& state)
+{
+	if (state) this->_rest_client->set_verbose(1L);
+	else this->_rest_client->set_verbose(0);
+}
+
+/**
+	Set the max number of concurrent REST requests of each request type (GET, POST, PUT, DELETE)
+	@param max_connections - 0 for unlimited (default), 1 to send requests of each type one at a time
+*/
+template <typename T>
+void Client<T>::rest_set_max_connections(const unsigned int max_connections)
+{
+	this->_rest_client->set_max_connections(max_connections);
+}
+
+/**
+	Set HTTP/2 mode for the REST session - one connection per base URL, with concurrent requests multiplexed over it
+	should be set before sending requests
+	@param state - a bool for enabling (1) or disabling (0)
+	@return 1 if set, 0 if curl is built without HTTP/2 support
+*/
+template <typename T>
+bool Client<T>::rest_set_http2(const bool state)
+{
+	return this->_rest_client->set_http2(state);
+}
+
+/**
+	Set the client-side rate limiter of the REST session
+	the limits are synced with the usage reported by the exchange in each response
+	@param policy - what to do with requests that do not fit the limits (none, block, priority_queue, reject)
+	@param weight_per_minute - request weight limit of the account per minute
+	@param orders_per_10s - order limit of the account per 10 seconds
+*/
+template <typename T>
+void Client<T>::rest_set_rate_limit(const RateLimitPolicy policy, const unsigned int weight_per_minute, const unsigned int orders_per_10s)
+{
+	this->_rest_client->_rate_limiter.set_limits(weight_per_minute, orders_per_10s);
+	this->_rest_client->_rate_limiter.set_policy(policy);
+}
+
+/**
+	Check orders against the filters of symbols before they are sent - new_order, test_new_order, oco_new_order and batch_orders
+	orders failing a filter throw 'OrderRejected', or are normalized first (see 'OrderValidationPolicy')
+	@param order_validator - a pointer to the validator, nullptr for no validation - must outlive the client
+*/
+template <typename T>
+void Client<T>::rest_set_order_validator(OrderValidator* order_validator)
+{
+	this->_order_validator = order_validator;
+}
+
+/**
+	Stamp signed requests with the time of an exchange clock instead of the system clock (see 'ClockSync') - for a tight recvWindow
+	order templates take the clock set when they are created
+	@param clock - a pointer to the clock, nullptr for the system clock - must outlive the client
+*/
+template <typename T>
+void Client<T>::rest_set_clock(const ExchangeClock* clock)
+{
+	this->_clock = clock;
+}
+
+/**
+	Get the stats of the REST requests of the session by endpoint (method and path)
+	timings in microseconds: DNS, connect and TLS of new connections, time to first byte and total - plus HTTP statuses and error codes of errors
+	@return a snapshot of each endpoint
+*/
+template <typename T>
+std::vector<EndpointSnapshot> Client<T>::rest_stats() const
+{
+	return this->_rest_client->_stats.snapshot();
+}
+
+/**
+	Get the stats of the REST requests of the session by endpoint, as text
+	@return the report - percentiles (50, 90, 99, 99.9) of each timing, in microseconds
+*/
+template <typename T>
+std::string Client<T>::rest_stats_report() const
+{
+	return this->_rest_client->_stats.report();
+}
+
+/**
+	Clear the stats of the REST requests of the session
+*/
+template <typename T>
+void Client<T>::rest_reset_stats()
+{
+	this->_rest_client->_stats.reset();
+}
+
+/**
+	Generate a REST request query
+	@param params_ptr - a pointer to the request Params object
+	@param sign_query - a bool for whether to sign the request or not
+	@return string - the query generated
+*/
+template <typename T>
+std::string Client<T>::_generate_query(const Params* params_ptr, const bool& sign_query) const
+{
+	try
+	{
+		return std::string{ this->_generate_path("", "", params_ptr, sign_query) };
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Generate the full path of a REST request - base, endpoint and query
+	the path is built into a buffer of the thread, so no memory is allocated once the buffer is large enough
+	@param base - base URL of the request path
+	@param endpoint - endpoint of the request path
+	@param params_ptr - a pointer to the request Params object
+	@param sign_query - a bool for whether to sign the request or not
+	@return the full path - valid until the next path is generated on this thread
+*/
+template <typename T>
+const std::string& Client<T>::_generate_path(std::string_view base, std::string_view endpoint, const Params* params_ptr, const bool& sign_query) const
+{
+	static thread_local QueryBuilder query_builder{};
+
+	try
+	{
+		query_builder.reset(base, endpoint);
+		query_builder.append_params(params_ptr);
+
+		if (sign_query)
+		{
+			if (!this->_signer)
+			{
+				MissingCredentials e{};
+				e.append_to_traceback(std::string(__FUNCTION__));
+				throw(e);
+			}
+
+			query_builder.append_timestamp(this->_clock ? this->_clock->timestamp() : local_timestamp());
+			query_builder.sign(*this->_signer);
+		}
+
+		return query_builder.str();
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+	catch (...)
+	{
+		BadQuery e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+}
+
+/**
+	Build a REST request of this client without sending it
+	@param request_type - the type of the request
+	@param base - base URL of the request path
+	@param endpoint - endpoint of the request path
+	@param params_ptr - a pointer to the request Params object
+	@param sign_query - a bool for whether to sign the request or not
+	@return the request - owns a copy of its path
+*/
+template <typename T>
+RestRequest Client<T>::_build_request(const RestRequestType request_type, std::string_view base, std::string_view endpoint, const Params* params_ptr, const bool& sign_query) const
+{
+	try
+	{
+		return RestRequest{ std::string{ this->_generate_path(base, endpoint, params_ptr, sign_query) }, request_type, this->_rest_client };
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+
+//  ------------------------------ End | Client General methods - Infrastructure
+
+
+// ***************************************************************************
+
+
+//  ------------------------------ Start | Client Wallet - User Wallet Endpoints
+
+// ------ Class methods
+
+
+/**
+	A constructor - called directly by the user
+	@param client_obj - the exchange client object
+*/
+template <typename T>
+Client<T>::Wallet::Wallet(Client<T>& client_obj)
+	: user_client{ &client_obj } // snatching pointer and releasing later on to avoid deleting this reference
+{
+	if (user_client->_public_client)
+	{
+		MissingCredentials e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	};
+}
+
+/**
+	A constructor - called directly by the user
+	@param client_obj - the exchange client object (constant)
+*/
+template <typename T>
+Client<T>::Wallet::Wallet(const Client<T>& client_obj)
+	: user_client{ &client_obj } // snatching pointer and releasing later on to avoid deleting this reference
+{
+	if (user_client->_public_client)
+	{
+		MissingCredentials e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	};
+}
+
+/**
+	A destructor
+	since 'user_client' is a reference to an exchange client outside the class
+	it should be set to nullptr prior deletion
+*/
+template <typename T>
+Client<T>::Wallet::~Wallet()
+{
+	user_client = nullptr;
+}
+
+// ------ Endpoint methods
+
+/**
+	Get all coins
 	@param params_ptr - a pointer to the request Params object
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::make_user_transfer_universal(const Params* params_ptr)
+RestResponse Client<T>::Wallet::get_all_coins(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/asset/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/capital/config/getall", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
+	}
+};
+
+/**
+	Get a daily wallet snapshot
+	@param params_ptr - a pointer to the request Params object
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::daily_snapshot(const Params* params_ptr)
+{
+	try
+	{
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/accountSnapshot", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
+
+		return response;
+
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Turn on / off fast withdrawals
+	@param state - 1 to enable, 0 to disable
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::fast_withdraw_switch(const bool& state)
+{
+	try
+	{
+		Params temp_params;
+		std::string endpoint = state ? "/sapi/v1/account/enableFastWithdrawSwitch" : "/sapi/v1/account/disableFastWithdrawSwitch";
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, endpoint, &temp_params, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Submit a withdraw request
+	@param params_ptr - a pointer to the request Params object
+	@param SAPI - a bool for whether to use SAPI or WAPI endpoint
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::withdraw_balances(const Params* params_ptr)
+{
+	try
+	{
+		std::string endpoint = "/sapi/v1/capital/withdraw/apply";
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Fetch deposit history
+	@param params_ptr - a pointer to the request Params object
+	@param network - a bool for whether to use an endpoint that support network
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::deposit_history(const Params* params_ptr)
+{
+	try
+	{
+		std::string endpoint = "/sapi/v1/capital/deposit/hisrec";
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Fetch withdraw history
+	@param params_ptr - a pointer to the request Params object
+	@param network - a bool for whether to fetch with network
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::withdraw_history(const Params* params_ptr)
+{
+	try
+	{
+		std::string endpoint = "/sapi/v1/capital/withdraw/history";
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Fetch deposit address 
+	@param params_ptr - a pointer to the request Params object
+	@param network - a bool for whether to fetch with network
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::deposit_address(const Params* params_ptr)
+{
+	try
+	{
+		std::string endpoint = "/sapi/v1/capital/deposit/address";
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Convert dust assets to BNB
+	@param params_ptr - a pointer to the request Params object
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::dust_transfer(const Params* params_ptr)
+{
+	try
+	{
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/asset/dust", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Query asset dividend record
+	@param params_ptr - a pointer to the request Params object
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::asset_dividend_records(const Params* params_ptr)
+{
+	try
+	{
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/asset/assetDividend", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+};
+
+/**
+	Make User Universal Transfer
+	@param params_ptr - a pointer to the request Params object
+	@return the json returned by the request
+*/
+template <typename T>
+RestResponse Client<T>::Wallet::make_user_transfer_universal(const Params* params_ptr)
+{
+	try
+	{
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/asset/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
+
+		return response;
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
 	}
 };
 
@@ -1076,20 +1480,19 @@ simdjson::dom::element Client<T>::Wallet::make_user_transfer_universal(const Par
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Wallet::query_user_transfer_universal(const Params* params_ptr)
+RestResponse Client<T>::Wallet::query_user_transfer_universal(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/asset/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/asset/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1155,20 +1558,19 @@ Client<T>::FuturesWallet::~FuturesWallet()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::futures_transfer(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::futures_transfer(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/transfer";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/transfer", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1178,20 +1580,19 @@ simdjson::dom::element Client<T>::FuturesWallet::futures_transfer(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::futures_transfer_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::futures_transfer_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/transfer";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/transfer", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1201,20 +1602,19 @@ simdjson::dom::element Client<T>::FuturesWallet::futures_transfer_history(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_borrow(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_borrow(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/borrow";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/borrow", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1224,20 +1624,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_borrow(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_borrow_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_borrow_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/borrow/history";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/borrow/history", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1247,20 +1646,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_borrow_history(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_cross_repay(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_cross_repay(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/repay";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/repay", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1270,20 +1668,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_cross_repay(const Pa
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_repay_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_repay_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/repay/history";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/repay/history", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1293,21 +1690,21 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_repay_history(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_wallet(const Params* params_ptr, const unsigned int version)
+RestResponse Client<T>::FuturesWallet::collateral_wallet(const Params* params_ptr, const unsigned int version)
 {
 	try
 	{
-		
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v" + std::to_string(version) + "/futures/loan/wallet";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		char endpoint_buffer[64];
+		const std::string_view endpoint = versioned_endpoint(endpoint_buffer, sizeof(endpoint_buffer), "/sapi/v", version, "/futures/loan/wallet");
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1318,20 +1715,21 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_wallet(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_info(const Params* params_ptr, const unsigned int version)
+RestResponse Client<T>::FuturesWallet::collateral_info(const Params* params_ptr, const unsigned int version)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v" + std::to_string(version) + "/futures/loan/configs";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		char endpoint_buffer[64];
+		const std::string_view endpoint = versioned_endpoint(endpoint_buffer, sizeof(endpoint_buffer), "/sapi/v", version, "/futures/loan/configs");
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1341,20 +1739,21 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_info(const Params* p
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_calc_rate(const Params* params_ptr, const unsigned int version)
+RestResponse Client<T>::FuturesWallet::collateral_adjust_calc_rate(const Params* params_ptr, const unsigned int version)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v" + std::to_string(version) + "/futures/loan/calcAdjustLevel";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		char endpoint_buffer[64];
+		const std::string_view endpoint = versioned_endpoint(endpoint_buffer, sizeof(endpoint_buffer), "/sapi/v", version, "/futures/loan/calcAdjustLevel");
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1364,20 +1763,21 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_calc_rate(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_get_max(const Params* params_ptr, const unsigned int version)
+RestResponse Client<T>::FuturesWallet::collateral_adjust_get_max(const Params* params_ptr, const unsigned int version)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v" + std::to_string(version) + "/futures/loan/calcMaxAdjustAmount";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		char endpoint_buffer[64];
+		const std::string_view endpoint = versioned_endpoint(endpoint_buffer, sizeof(endpoint_buffer), "/sapi/v", version, "/futures/loan/calcMaxAdjustAmount");
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1387,20 +1787,21 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_get_max(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust(const Params* params_ptr, const unsigned int version)
+RestResponse Client<T>::FuturesWallet::collateral_adjust(const Params* params_ptr, const unsigned int version)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v" + std::to_string(version) + "/futures/loan/adjustCollateral";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path + query);
+		char endpoint_buffer[64];
+		const std::string_view endpoint = versioned_endpoint(endpoint_buffer, sizeof(endpoint_buffer), "/sapi/v", version, "/futures/loan/adjustCollateral");
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, endpoint, params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1410,20 +1811,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_adjust_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/adjustCollateral/history";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/adjustCollateral/history", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1433,20 +1833,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_adjust_history(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_liquidation_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_liquidation_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/liquidationHistory";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/liquidationHistory", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1456,20 +1855,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_liquidation_history(
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_check_repay_limit(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_check_repay_limit(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/collateralRepayLimit";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/collateralRepayLimit", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1481,20 +1879,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_check_repay_limit(co
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_get_repay_quote(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_get_repay_quote(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/collateralRepay";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/collateralRepay", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1505,20 +1902,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_get_repay_quote(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_repay(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_repay(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/collateralRepay";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/collateralRepay", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1529,20 +1925,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_repay(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_repay_result(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_repay_result(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/collateralRepayResult";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/collateralRepayResult", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1553,20 +1948,19 @@ simdjson::dom::element Client<T>::FuturesWallet::collateral_repay_result(const P
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::FuturesWallet::collateral_cross_interest_history(const Params* params_ptr)
+RestResponse Client<T>::FuturesWallet::collateral_cross_interest_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/futures/loan/interestHistory";
-		std::string query = this->user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/futures/loan/interestHistory", params_ptr, 1);
+		RestResponse response = (this->user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -1634,20 +2028,19 @@ Client<T>::SubAccount::~SubAccount()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::create_virtual_subaccount(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::create_virtual_subaccount(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/virtualSubAccount";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/virtualSubAccount", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1658,20 +2051,19 @@ simdjson::dom::element Client<T>::SubAccount::create_virtual_subaccount(const Pa
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::query_subaccount_list_sapi(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::query_subaccount_list_sapi(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1681,20 +2073,19 @@ simdjson::dom::element Client<T>::SubAccount::query_subaccount_list_sapi(const P
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_spot_subaccount_history(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_spot_subaccount_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/sub/transfer/history";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/sub/transfer/history", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1704,20 +2095,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_spot_subaccount_history(c
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::futures_transfer_master_history(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::futures_transfer_master_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/internalTransfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/internalTransfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1727,20 +2117,19 @@ simdjson::dom::element Client<T>::SubAccount::futures_transfer_master_history(co
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::futures_transfer_master_to_subaccount(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::futures_transfer_master_to_subaccount(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/internalTransfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/internalTransfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1750,20 +2139,19 @@ simdjson::dom::element Client<T>::SubAccount::futures_transfer_master_to_subacco
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_balances_summary(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_balances_summary(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/spotSummary";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/spotSummary", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1773,20 +2161,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_balances_summary(co
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_deposit_address(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_deposit_address(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/capital/deposit/subAddress";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/capital/deposit/subAddress", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1796,20 +2183,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_deposit_address(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_deposit_history(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_deposit_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/capital/deposit/subHisrec";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/capital/deposit/subHisrec", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1819,20 +2205,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_deposit_history(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_future_margin_status(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_future_margin_status(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/status";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/status", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1842,20 +2227,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_future_margin_statu
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::enable_subaccount_margin(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::enable_subaccount_margin(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/margin/enable";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/margin/enable", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1865,20 +2249,19 @@ simdjson::dom::element Client<T>::SubAccount::enable_subaccount_margin(const Par
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_margin_status(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_margin_status(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/margin/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/margin/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1888,20 +2271,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_margin_status(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_margin_summary(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_margin_summary(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/margin/accountSummary";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/margin/accountSummary", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1911,20 +2293,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_margin_summary(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::enable_subaccount_futures(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::enable_subaccount_futures(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/enable";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/enable", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1934,20 +2315,19 @@ simdjson::dom::element Client<T>::SubAccount::enable_subaccount_futures(const Pa
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_status(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_futures_status(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1957,20 +2337,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_status(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_summary(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_futures_summary(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/accountSummary";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/accountSummary", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -1980,20 +2359,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_summary(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_positionrisk(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_subaccount_futures_positionrisk(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/positionRisk";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/positionRisk", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2003,20 +2381,19 @@ simdjson::dom::element Client<T>::SubAccount::get_subaccount_futures_positionris
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_to_subaccount_futures(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_to_subaccount_futures(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/futures/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/futures/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2026,20 +2403,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_to_subaccount_futures(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_to_subaccount_margin(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_to_subaccount_margin(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/margin/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/margin/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2049,20 +2425,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_to_subaccount_margin(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_to_subaccount(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_subaccount_to_subaccount(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/transfer/subToSub";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/transfer/subToSub", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2072,20 +2447,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_to_subaccount(
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_to_master(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_subaccount_to_master(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/transfer/subToMaster";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/transfer/subToMaster", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2095,20 +2469,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_to_master(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_history(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::transfer_subaccount_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/transfer/subUserHistory";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/transfer/subUserHistory", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2118,20 +2491,19 @@ simdjson::dom::element Client<T>::SubAccount::transfer_subaccount_history(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::make_universal_transfer(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::make_universal_transfer(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/universalTransfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/universalTransfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2141,20 +2513,19 @@ simdjson::dom::element Client<T>::SubAccount::make_universal_transfer(const Para
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_universal_transfer_history(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_universal_transfer_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/universalTransfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/universalTransfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2164,20 +2535,19 @@ simdjson::dom::element Client<T>::SubAccount::get_universal_transfer_history(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_details_subaccount_futures(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_details_subaccount_futures(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v2/sub-account/futures/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v2/sub-account/futures/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2187,20 +2557,19 @@ simdjson::dom::element Client<T>::SubAccount::get_details_subaccount_futures(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_summary_subaccount_futures(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_summary_subaccount_futures(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v2/sub-account/futures/accountSummary";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v2/sub-account/futures/accountSummary", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2210,20 +2579,19 @@ simdjson::dom::element Client<T>::SubAccount::get_summary_subaccount_futures(con
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::get_positionrisk_subaccount_futures(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::get_positionrisk_subaccount_futures(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v2/sub-account/futures/positionRisk";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v2/sub-account/futures/positionRisk", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2234,20 +2602,19 @@ simdjson::dom::element Client<T>::SubAccount::get_positionrisk_subaccount_future
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::SubAccount::enable_leverage_token_subaccount(const Params* params_ptr)
+RestResponse Client<T>::SubAccount::enable_leverage_token_subaccount(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/sub-account/blvt/enable";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/sub-account/blvt/enable", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2309,20 +2676,19 @@ Client<T>::MarginAccount::~MarginAccount()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_transfer(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_transfer(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2332,20 +2698,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_transfer(const Params* p
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_borrow(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_borrow(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/loan";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/loan", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2355,20 +2720,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_borrow(const Params* par
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_repay(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_repay(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/repay";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/repay", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2378,20 +2742,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_repay(const Params* para
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_asset_query(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_asset_query(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/asset";
-		std::string query = params_ptr ? this->user_client->_generate_query(params_ptr) : "";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/asset", params_ptr);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2401,20 +2764,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_asset_query(const Params
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_pair_query(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_pair_query(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/pair";
-		std::string query = params_ptr ? this->user_client->_generate_query(params_ptr) : "";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/pair", params_ptr);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2424,19 +2786,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_pair_query(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_all_assets_query()
+RestResponse Client<T>::MarginAccount::margin_all_assets_query()
 {
 	try
 	{
 		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/allAssets";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2446,19 +2808,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_all_assets_query()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_all_pairs_query()
+RestResponse Client<T>::MarginAccount::margin_all_pairs_query()
 {
 	try
 	{
 		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/allPairs";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2468,20 +2830,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_all_pairs_query()
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_price_index(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_price_index(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/transfer";
-		std::string query = params_ptr ? this->user_client->_generate_query(params_ptr) : "";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/transfer", params_ptr);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2491,20 +2852,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_price_index(const Params
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_new_order(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_new_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/order";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/order", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2514,20 +2874,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_new_order(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_cancel_order(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_cancel_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/order";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_deletereq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/order", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_deletereq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2537,20 +2896,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_cancel_order(const Param
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_cancel_all_orders(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_cancel_all_orders(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/openOrders";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_deletereq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/openOrders", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_deletereq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2564,20 +2922,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_cancel_all_orders(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_transfer_history(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_transfer_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2592,20 +2949,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_transfer_history(const P
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_loan_record(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_loan_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/loan";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/loan", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2620,20 +2976,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_loan_record(const Params
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_repay_record(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_repay_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/repay";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/repay", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2652,20 +3007,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_repay_record(const Param
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_interest_history(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_interest_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/interestHistory";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/interestHistory", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2675,20 +3029,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_interest_history(const P
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_liquidations_record(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_liquidations_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/forceLiquidationRec";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/forceLiquidationRec", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2698,20 +3051,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_liquidations_record(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_account_info(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_account_info(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2724,20 +3076,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_account_info(const Param
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_account_order(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_account_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/order";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/order", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2751,20 +3102,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_account_order(const Para
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_account_open_orders(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_account_open_orders(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/openOrders";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/openOrders", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2777,20 +3127,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_account_open_orders(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_account_all_orders(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_account_all_orders(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/allOrders";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/allOrders", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2802,20 +3151,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_account_all_orders(const
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_account_trades_list(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_account_trades_list(const Params* params_ptr)
 {
 	try
 	{ 
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/myTrades";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/myTrades", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2828,20 +3176,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_account_trades_list(cons
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_max_borrow(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_max_borrow(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/maxBorrowable";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/maxBorrowable", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2853,20 +3200,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_max_borrow(const Params*
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_max_transfer(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_max_transfer(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/maxTransferable";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/maxTransferable", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2877,20 +3223,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_max_transfer(const Param
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_transfer(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_isolated_margin_transfer(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/isolated/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/isolated/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2901,20 +3246,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_transfer
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_transfer_history(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_isolated_margin_transfer_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/isolated/transfer";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/isolated/transfer", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2927,20 +3271,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_transfer
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_account_info(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_isolated_margin_account_info(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/isolated/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/isolated/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2951,20 +3294,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_account_
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_symbol(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_isolated_margin_symbol(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/isolated/pair";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/isolated/pair", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2975,20 +3317,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_symbol(c
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_symbol_all(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::margin_isolated_margin_symbol_all(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/isolated/allPairs";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/isolated/allPairs", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -2999,20 +3340,19 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_margin_symbol_a
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::toggle_bnb_burn(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::toggle_bnb_burn(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bnbBurn";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bnbBurn", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3023,20 +3363,19 @@ simdjson::dom::element Client<T>::MarginAccount::toggle_bnb_burn(const Params* p
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::get_bnb_burn_status(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::get_bnb_burn_status(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bnbBurn";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bnbBurn", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3047,20 +3386,19 @@ simdjson::dom::element Client<T>::MarginAccount::get_bnb_burn_status(const Param
 	@return the json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::query_margin_interest_rate_history(const Params* params_ptr)
+RestResponse Client<T>::MarginAccount::query_margin_interest_rate_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/margin/interestRateHistory";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/margin/interestRateHistory", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3075,13 +3413,13 @@ std::string Client<T>::MarginAccount::margin_get_listen_key()
 	{
 		std::string endpoint = "/sapi/v1/userDataStream";
 		std::string full_path = _BASE_REST_SPOT + endpoint;
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 		return std::string(response["listenKey"].get_string().value());
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3097,14 +3435,14 @@ std::string Client<T>::MarginAccount::margin_isolated_get_listen_key(const std::
 	{
 		std::string endpoint = "/sapi/v1/userDataStream/isolated?symbol=" + symbol;
 		std::string full_path = _BASE_REST_SPOT + endpoint;
-		simdjson::dom::element response = (this->user_client->_rest_client)->_postreq(full_path);
+		RestResponse response = (this->user_client->_rest_client)->_postreq(full_path);
 
 		return std::string(response["listenKey"].get_string().value());
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3114,20 +3452,20 @@ std::string Client<T>::MarginAccount::margin_isolated_get_listen_key(const std::
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_ping_listen_key(const std::string& listen_key)
+RestResponse Client<T>::MarginAccount::margin_ping_listen_key(const std::string& listen_key)
 {
 	try
 	{
 		std::string endpoint = "/sapi/v1/userDataStream";
 		std::string full_path = _BASE_REST_SPOT + endpoint + "?listenKey=" + listen_key;
-		simdjson::dom::element response = listen_key.empty() ? (this->user_client->_rest_client)->_putreq(full_path) : (this->user_client->_rest_client)->_postreq(full_path);
+		RestResponse response = listen_key.empty() ? (this->user_client->_rest_client)->_putreq(full_path) : (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3137,20 +3475,20 @@ simdjson::dom::element Client<T>::MarginAccount::margin_ping_listen_key(const st
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_ping_listen_key(const std::string& listen_key, const std::string symbol)
+RestResponse Client<T>::MarginAccount::margin_isolated_ping_listen_key(const std::string& listen_key, const std::string symbol)
 {
 	try
 	{
 		std::string endpoint = "/sapi/v1/userDataStream/isolated?symbol=" + symbol;
 		std::string full_path = _BASE_REST_SPOT + endpoint + "?listenKey=" + listen_key;
-		simdjson::dom::element response = listen_key.empty() ? (this->user_client->_rest_client)->_putreq(full_path) : (this->user_client->_rest_client)->_postreq(full_path);
+		RestResponse response = listen_key.empty() ? (this->user_client->_rest_client)->_putreq(full_path) : (this->user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3160,20 +3498,20 @@ simdjson::dom::element Client<T>::MarginAccount::margin_isolated_ping_listen_key
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_revoke_listen_key(const std::string& listen_key)
+RestResponse Client<T>::MarginAccount::margin_revoke_listen_key(const std::string& listen_key)
 {
 	try
 	{
 		std::string endpoint = "/sapi/v1/userDataStream";
 		std::string full_path = _BASE_REST_SPOT + endpoint + "?listenKey=" + listen_key;
-		simdjson::dom::element response = (this->user_client->_rest_client)->_deletereq(full_path);
+		RestResponse response = (this->user_client->_rest_client)->_deletereq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3184,20 +3522,20 @@ simdjson::dom::element Client<T>::MarginAccount::margin_revoke_listen_key(const
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::MarginAccount::margin_isolated_revoke_listen_key(const std::string& listen_key, const std::string symbol)
+RestResponse Client<T>::MarginAccount::margin_isolated_revoke_listen_key(const std::string& listen_key, const std::string symbol)
 {
 	try
 	{
 		std::string endpoint = "/sapi/v1/userDataStream/isolated?symbol=" + symbol;
 		std::string full_path = _BASE_REST_SPOT + endpoint + "?listenKey=" + listen_key;
-		simdjson::dom::element response = (this->user_client->_rest_client)->_deletereq(full_path);
+		RestResponse response = (this->user_client->_rest_client)->_deletereq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -3258,20 +3596,19 @@ Client<T>::Savings::~Savings()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_list_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_list_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/product/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/product/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3281,20 +3618,19 @@ simdjson::dom::element Client<T>::Savings::get_product_list_flexible(const Param
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_daily_quota_purchase_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_daily_quota_purchase_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/userLeftQuota";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/userLeftQuota", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3304,20 +3640,19 @@ simdjson::dom::element Client<T>::Savings::get_product_daily_quota_purchase_flex
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::purchase_product_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::purchase_product_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/purchase";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/purchase", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3327,20 +3662,19 @@ simdjson::dom::element Client<T>::Savings::purchase_product_flexible(const Param
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_daily_quota_redemption_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_daily_quota_redemption_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/userRedemptionQuota";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/userRedemptionQuota", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3350,20 +3684,19 @@ simdjson::dom::element Client<T>::Savings::get_product_daily_quota_redemption_fl
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::redeem_product_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::redeem_product_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/redeem";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/redeem", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3373,20 +3706,19 @@ simdjson::dom::element Client<T>::Savings::redeem_product_flexible(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_position_flexible(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_position_flexible(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/daily/token/position";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/daily/token/position", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3396,20 +3728,19 @@ simdjson::dom::element Client<T>::Savings::get_product_position_flexible(const P
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_list_fixed(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_list_fixed(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/project/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/project/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3419,20 +3750,19 @@ simdjson::dom::element Client<T>::Savings::get_product_list_fixed(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::purchase_product_fixed(const Params* params_ptr)
+RestResponse Client<T>::Savings::purchase_product_fixed(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/customizedFixed/purchase";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/customizedFixed/purchase", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3442,20 +3772,19 @@ simdjson::dom::element Client<T>::Savings::purchase_product_fixed(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_product_position_fixed(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_product_position_fixed(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/project/position/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/project/position/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3465,20 +3794,19 @@ simdjson::dom::element Client<T>::Savings::get_product_position_fixed(const Para
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::lending_account(const Params* params_ptr)
+RestResponse Client<T>::Savings::lending_account(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/union/account";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/union/account", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3488,20 +3816,19 @@ simdjson::dom::element Client<T>::Savings::lending_account(const Params* params_
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_purchase_record(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_purchase_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/union/purchaseRecord";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/union/purchaseRecord", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3511,20 +3838,19 @@ simdjson::dom::element Client<T>::Savings::get_purchase_record(const Params* par
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_redemption_record(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_redemption_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/union/redemptionRecord";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/union/redemptionRecord", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3534,20 +3860,19 @@ simdjson::dom::element Client<T>::Savings::get_redemption_record(const Params* p
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::get_interest_history(const Params* params_ptr)
+RestResponse Client<T>::Savings::get_interest_history(const Params* params_ptr)
 {
 	try
 	{ 
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/union/interestHistory";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/union/interestHistory", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3557,20 +3882,19 @@ simdjson::dom::element Client<T>::Savings::get_interest_history(const Params* pa
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Savings::change_fixed_pos_to_daily_pos(const Params* params_ptr)
+RestResponse Client<T>::Savings::change_fixed_pos_to_daily_pos(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/lending/positionChanged";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/lending/positionChanged", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3632,19 +3956,19 @@ Client<T>::Mining::~Mining()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::algo_list()
+RestResponse Client<T>::Mining::algo_list()
 {
 	try
 	{
 		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/pub/algoList";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3653,19 +3977,19 @@ simdjson::dom::element Client<T>::Mining::algo_list()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::coin_list()
+RestResponse Client<T>::Mining::coin_list()
 {
 	try
 	{
 		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/pub/coinList";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3675,20 +3999,19 @@ simdjson::dom::element Client<T>::Mining::coin_list()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::get_miner_list_detail(const Params* params_ptr)
+RestResponse Client<T>::Mining::get_miner_list_detail(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/worker/detail";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/worker/detail", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3698,20 +4021,19 @@ simdjson::dom::element Client<T>::Mining::get_miner_list_detail(const Params* pa
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::get_miner_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::get_miner_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/worker/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/worker/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3721,20 +4043,19 @@ simdjson::dom::element Client<T>::Mining::get_miner_list(const Params* params_pt
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::revenue_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::revenue_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/payment/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/payment/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3744,20 +4065,19 @@ simdjson::dom::element Client<T>::Mining::revenue_list(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::get_extra_bonus_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::get_extra_bonus_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/payment/other";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/payment/other", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3767,20 +4087,19 @@ simdjson::dom::element Client<T>::Mining::get_extra_bonus_list(const Params* par
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::get_hashrate_resale_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::get_hashrate_resale_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/hash-transfer/config/details/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/hash-transfer/config/details/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3790,20 +4109,19 @@ simdjson::dom::element Client<T>::Mining::get_hashrate_resale_list(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::get_hashrate_resale_detail(const Params* params_ptr)
+RestResponse Client<T>::Mining::get_hashrate_resale_detail(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/hash-transfer/profit/details";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/hash-transfer/profit/details", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3813,20 +4131,19 @@ simdjson::dom::element Client<T>::Mining::get_hashrate_resale_detail(const Param
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::make_hashrate_resale_request(const Params* params_ptr)
+RestResponse Client<T>::Mining::make_hashrate_resale_request(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/hash-transfer/config";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/hash-transfer/config", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3836,20 +4153,19 @@ simdjson::dom::element Client<T>::Mining::make_hashrate_resale_request(const Par
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::cancel_hashrate_resale_config(const Params* params_ptr)
+RestResponse Client<T>::Mining::cancel_hashrate_resale_config(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/hash-transfer/config/cancel";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/hash-transfer/config/cancel", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3859,20 +4175,19 @@ simdjson::dom::element Client<T>::Mining::cancel_hashrate_resale_config(const Pa
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::statistic_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::statistic_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/statistics/user/status";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/statistics/user/status", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3882,20 +4197,19 @@ simdjson::dom::element Client<T>::Mining::statistic_list(const Params* params_pt
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::Mining::account_list(const Params* params_ptr)
+RestResponse Client<T>::Mining::account_list(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/mining/statistics/user/list";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/mining/statistics/user/list", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3960,20 +4274,19 @@ Client<T>::BLVT::~BLVT()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::get_blvt_info(const Params* params_ptr)
+RestResponse Client<T>::BLVT::get_blvt_info(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/tokenInfo";
-		std::string query = user_client->_generate_query(params_ptr, 0);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/tokenInfo", params_ptr, 0);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -3983,20 +4296,19 @@ simdjson::dom::element Client<T>::BLVT::get_blvt_info(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::subscribe_blvt(const Params* params_ptr)
+RestResponse Client<T>::BLVT::subscribe_blvt(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/subscribe";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/subscribe", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4006,20 +4318,19 @@ simdjson::dom::element Client<T>::BLVT::subscribe_blvt(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::get_subscribe_blvt_history(const Params* params_ptr)
+RestResponse Client<T>::BLVT::get_subscribe_blvt_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/subscribe/record";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/subscribe/record", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4029,20 +4340,19 @@ simdjson::dom::element Client<T>::BLVT::get_subscribe_blvt_history(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::redeem_blvt(const Params* params_ptr)
+RestResponse Client<T>::BLVT::redeem_blvt(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/redeem";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/redeem", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4052,20 +4362,19 @@ simdjson::dom::element Client<T>::BLVT::redeem_blvt(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::get_redeem_blvt_history(const Params* params_ptr)
+RestResponse Client<T>::BLVT::get_redeem_blvt_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/redeem/record";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/redeem/record", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4075,20 +4384,19 @@ simdjson::dom::element Client<T>::BLVT::get_redeem_blvt_history(const Params* pa
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BLVT::get_blvt_user_limit(const Params* params_ptr)
+RestResponse Client<T>::BLVT::get_blvt_user_limit(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/blvt/userLimit";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/blvt/userLimit", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4152,19 +4460,19 @@ Client<T>::BSwap::~BSwap()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::get_all_swap_pools()
+RestResponse Client<T>::BSwap::get_all_swap_pools()
 {
 	try
 	{
 		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/pools";
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4174,20 +4482,19 @@ simdjson::dom::element Client<T>::BSwap::get_all_swap_pools()
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::get_liquidity_info_pool(const Params* params_ptr)
+RestResponse Client<T>::BSwap::get_liquidity_info_pool(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/liquidity";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/liquidity", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4197,20 +4504,19 @@ simdjson::dom::element Client<T>::BSwap::get_liquidity_info_pool(const Params* p
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::add_liquidity(const Params* params_ptr)
+RestResponse Client<T>::BSwap::add_liquidity(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/liquidityAdd";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/liquidityAdd", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4223,20 +4529,19 @@ simdjson::dom::element Client<T>::BSwap::add_liquidity(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::remove_liquidity(const Params* params_ptr)
+RestResponse Client<T>::BSwap::remove_liquidity(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/liquidityRemove";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/liquidityRemove", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4246,20 +4551,19 @@ simdjson::dom::element Client<T>::BSwap::remove_liquidity(const Params* params_p
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::get_liquidity_ops_record(const Params* params_ptr)
+RestResponse Client<T>::BSwap::get_liquidity_ops_record(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/liquidityOps";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/liquidityOps", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4271,20 +4575,19 @@ simdjson::dom::element Client<T>::BSwap::get_liquidity_ops_record(const Params*
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::request_quote(const Params* params_ptr)
+RestResponse Client<T>::BSwap::request_quote(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/quote";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/quote", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4294,20 +4597,19 @@ simdjson::dom::element Client<T>::BSwap::request_quote(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::make_swap(const Params* params_ptr)
+RestResponse Client<T>::BSwap::make_swap(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/swap";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_postreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/swap", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4317,20 +4619,19 @@ simdjson::dom::element Client<T>::BSwap::make_swap(const Params* params_ptr)
 	@return json returned by the request
 */
 template <typename T>
-simdjson::dom::element Client<T>::BSwap::get_swap_history(const Params* params_ptr)
+RestResponse Client<T>::BSwap::get_swap_history(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/sapi/v1/bswap/swap";
-		std::string query = user_client->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (user_client->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = user_client->_generate_path(_BASE_REST_SPOT, "/sapi/v1/bswap/swap", params_ptr, 1);
+		RestResponse response = (user_client->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 };
 
@@ -4369,6 +4670,34 @@ SpotClient::~SpotClient()
 	delete this->_rest_client;
 };
 
+/**
+	Create a template of new orders - for sending repeated orders of a symbol with minimal overhead
+	the static params are serialized and hashed once, each order sets only the price, quantity and client order id
+	@param static_params - the params sent with every order (symbol, side, type, timeInForce...)
+	@param price_precision - number of decimals of prices
+	@param quantity_precision - number of decimals of quantities
+	@return the template - must not outlive the client
+*/
+OrderTemplate SpotClient::order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision)
+{
+	try
+	{
+		if (!this->_signer)
+		{
+			MissingCredentials e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		return OrderTemplate{ this->_rest_client, *this->_signer, _BASE_REST_SPOT + "/api/v3/order", static_params, price_precision, quantity_precision, this->_clock };
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
 //  ------------------------------ End | SpotClient General methods - Infrastructure
 
 //  ------------------------------ Start | SpotClient CRTP methods - Client infrastructure
@@ -4389,7 +4718,7 @@ void SpotClient::v_init_ws_session()
 std::string SpotClient::v_get_listen_key()
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v3/userDataStream";
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return std::string(response["listenKey"].get_string().value());
 }
@@ -4399,23 +4728,32 @@ std::string SpotClient::v_get_listen_key()
 	@param listen_key - the listen_key
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::v_ping_listen_key(const std::string& listen_key)
+RestResponse SpotClient::v_ping_listen_key(const std::string& listen_key)
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v3/userDataStream" + "?listenKey=" + listen_key;
-	simdjson::dom::element response = listen_key.empty() ? (this->_rest_client)->_putreq(full_path) : (this->_rest_client)->_postreq(full_path);
+	RestResponse response = listen_key.empty() ? (this->_rest_client)->_putreq(full_path) : (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of ping_listen_key_request()
+*/
+RestRequest SpotClient::v_ping_listen_key_request(const std::string& listen_key)
+{
+	std::string endpoint = "/api/v3/userDataStream?listenKey=" + listen_key;
+	return this->_build_request(listen_key.empty() ? RestRequestType::put_request : RestRequestType::post_request, _BASE_REST_SPOT, endpoint, nullptr);
+}
+
 /**
 	Revoke a ListenKey
 	@param listen_key - the listen_key
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::v_revoke_listen_key(const std::string& listen_key)
+RestResponse SpotClient::v_revoke_listen_key(const std::string& listen_key)
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v3/userDataStream" + "?listenKey=" + listen_key;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -4430,7 +4768,7 @@ simdjson::dom::element SpotClient::v_revoke_listen_key(const std::string& listen
 bool SpotClient::v_ping_client()
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v3/ping";
-	simdjson::dom::element ping_response = (this->_rest_client)->_getreq(full_path);
+	RestResponse ping_response = (this->_rest_client)->_getreq(full_path);
 	return !ping_response.is_null();
 }
 
@@ -4440,106 +4778,115 @@ bool SpotClient::v_ping_client()
 unsigned long long SpotClient::v_exchange_time()
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v3/time";
-	std::string ex_time = std::string((this->_rest_client)->_getreq(full_path)["serverTime"].get_string().value());
+	uint64_t server_time{ 0 };
+	if ((this->_rest_client)->_getreq(full_path)["serverTime"].get_uint64().get(server_time)) server_time = 0; // serverTime is a number
 
-	return std::atoll(ex_time.c_str());
+	return server_time;
 }
 
 /**
 	CRTP of exchange_info()
 */
-simdjson::dom::element SpotClient::v_exchange_info() 
+RestResponse SpotClient::v_exchange_info() 
 {
 	std::string full_path = _BASE_REST_SPOT + "/api/v1/exchangeInfo";
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of order_book()
 */
-simdjson::dom::element SpotClient::v_order_book(const Params* params_ptr)
+RestResponse SpotClient::v_order_book(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/depth" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/depth", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of order_book_request()
+*/
+RestRequest SpotClient::v_order_book_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, _BASE_REST_SPOT, "/api/v3/depth", params_ptr);
+}
+
 /**
 	CRTP of public_trades_recent()
 */
-simdjson::dom::element SpotClient::v_public_trades_recent(const Params* params_ptr)
+RestResponse SpotClient::v_public_trades_recent(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/trades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/trades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of public_trades_historical()
 */
-simdjson::dom::element SpotClient::v_public_trades_historical(const Params* params_ptr)
+RestResponse SpotClient::v_public_trades_historical(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/historicalTrades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/historicalTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of public_trades_agg()
 */
-simdjson::dom::element SpotClient::v_public_trades_agg(const Params* params_ptr)
+RestResponse SpotClient::v_public_trades_agg(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/aggTrades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/aggTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of klines()
 */
-simdjson::dom::element SpotClient::v_klines(const Params* params_ptr)
+RestResponse SpotClient::v_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/klines" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/klines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of klines_request()
+*/
+RestRequest SpotClient::v_klines_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, _BASE_REST_SPOT, "/api/v3/klines", params_ptr);
+}
+
 /**
 	CRTP of daily_ticker_stats()
 */
-simdjson::dom::element SpotClient::v_daily_ticker_stats(const Params* params_ptr)
+RestResponse SpotClient::v_daily_ticker_stats(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/ticker/24hr" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/ticker/24hr", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of get_ticker()
 */
-simdjson::dom::element SpotClient::v_get_ticker(const Params* params_ptr)
+RestResponse SpotClient::v_get_ticker(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/ticker/price" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/ticker/price", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of get_order_book_ticker()
 */
-simdjson::dom::element SpotClient::v_get_order_book_ticker(const Params* params_ptr)
+RestResponse SpotClient::v_get_order_book_ticker(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/ticker/bookTicker" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/ticker/bookTicker", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -4555,83 +4902,124 @@ simdjson::dom::element SpotClient::v_get_order_book_ticker(const Params* params_
 /**
 	CRTP of test_new_order()
 */
-simdjson::dom::element SpotClient::v_test_new_order(const Params* params_ptr)
+RestResponse SpotClient::v_test_new_order(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/order/test";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/order/test", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of test_new_order_request()
+*/
+RestRequest SpotClient::v_test_new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, _BASE_REST_SPOT, "/api/v3/order/test", params_ptr, 1);
+}
+
 /**
 	CRTP of new_order()
 */
-simdjson::dom::element SpotClient::v_new_order(const Params* params_ptr)
+RestResponse SpotClient::v_new_order(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/order";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of new_order_request()
+*/
+RestRequest SpotClient::v_new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, _BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_order()
 */
-simdjson::dom::element SpotClient::v_cancel_order(const Params* params_ptr)
+RestResponse SpotClient::v_cancel_order(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/order";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of cancel_order_request()
+*/
+RestRequest SpotClient::v_cancel_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, _BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_all_orders()
 */
-simdjson::dom::element SpotClient::v_cancel_all_orders(const Params* params_ptr)
+RestResponse SpotClient::v_cancel_all_orders(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "api/v3/openOrders";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/openOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of cancel_all_orders_request()
+*/
+RestRequest SpotClient::v_cancel_all_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, _BASE_REST_SPOT, "/api/v3/openOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of query_order()
 */
-simdjson::dom::element SpotClient::v_query_order(const Params* params_ptr)
+RestResponse SpotClient::v_query_order(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/order";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of query_order_request()
+*/
+RestRequest SpotClient::v_query_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, _BASE_REST_SPOT, "/api/v3/order", params_ptr, 1);
+}
+
 /**
 	CRTP of open_orders()
 */
-simdjson::dom::element SpotClient::v_open_orders(const Params* params_ptr)
+RestResponse SpotClient::v_open_orders(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/openOrders";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/openOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of open_orders_request()
+*/
+RestRequest SpotClient::v_open_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, _BASE_REST_SPOT, "/api/v3/openOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of all_orders()
 */
-simdjson::dom::element SpotClient::v_all_orders(const Params* params_ptr)
+RestResponse SpotClient::v_all_orders(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/allOrders";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/allOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -4639,11 +5027,10 @@ simdjson::dom::element SpotClient::v_all_orders(const Params* params_ptr)
 /**
 	CRTP of account_info()
 */
-simdjson::dom::element SpotClient::v_account_info(const Params* params_ptr)
+RestResponse SpotClient::v_account_info(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/account";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/account", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -4651,11 +5038,10 @@ simdjson::dom::element SpotClient::v_account_info(const Params* params_ptr)
 /**
 	CRTP of account_trades_list()
 */
-simdjson::dom::element SpotClient::v_account_trades_list(const Params* params_ptr)
+RestResponse SpotClient::v_account_trades_list(const Params* params_ptr)
 {
-	std::string full_path = _BASE_REST_SPOT + "/api/v3/myTrades";
-	std::string query = this->_generate_query(params_ptr, 1);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+	const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/myTrades", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -4669,43 +5055,61 @@ simdjson::dom::element SpotClient::v_account_trades_list(const Params* params_pt
 	@param params_ptr - a pointer to the request Params object
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::oco_new_order(const Params* params_ptr)
+RestResponse SpotClient::oco_new_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/api/v3/order/oco";
-		std::string query = this->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->_rest_client)->_postreq(full_path + query);
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
+		const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/order/oco", params_ptr, 1);
+		RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 
 }
 
+/**
+	Build a new OCO request, for 'async_req()' - validated like 'oco_new_order()'
+	@param params_ptr - a pointer to the request Params object
+	@return the request
+*/
+RestRequest SpotClient::oco_new_order_request(const Params* params_ptr)
+{
+	try
+	{
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_order(params_ptr);
+		return this->_build_request(RestRequestType::post_request, _BASE_REST_SPOT, "/api/v3/order/oco", params_ptr, 1);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
 /**
 	Cancel OCO
 	@param params_ptr - a pointer to the request Params object
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::oco_cancel_order(const Params* params_ptr)
+RestResponse SpotClient::oco_cancel_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/api/v3/orderList";
-		std::string query = this->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path + query);
+		const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/orderList", params_ptr, 1);
+		RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4714,20 +5118,19 @@ simdjson::dom::element SpotClient::oco_cancel_order(const Params* params_ptr)
 	@param params_ptr - a pointer to the request Params object
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::oco_query_order(const Params* params_ptr)
+RestResponse SpotClient::oco_query_order(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/api/v3/orderList";
-		std::string query = this->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/orderList", params_ptr, 1);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4736,20 +5139,19 @@ simdjson::dom::element SpotClient::oco_query_order(const Params* params_ptr)
 	@param params_ptr - a pointer to the request Params object
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::oco_all_orders(const Params* params_ptr)
+RestResponse SpotClient::oco_all_orders(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/api/v3/allOrderList";
-		std::string query = this->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/allOrderList", params_ptr, 1);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4758,20 +5160,19 @@ simdjson::dom::element SpotClient::oco_all_orders(const Params* params_ptr)
 	@param params_ptr - a pointer to the request Params object
 	@return json returned by the request
 */
-simdjson::dom::element SpotClient::oco_open_orders(const Params* params_ptr)
+RestResponse SpotClient::oco_open_orders(const Params* params_ptr)
 {
 	try
 	{
-		std::string full_path = _BASE_REST_SPOT + "/api/v3/openOrderList";
-		std::string query = this->_generate_query(params_ptr, 1);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path + query);
+		const std::string& full_path = this->_generate_path(_BASE_REST_SPOT, "/api/v3/openOrderList", params_ptr, 1);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4817,6 +5218,35 @@ template <typename CT>
 FuturesClient<CT>::~FuturesClient()
 {}
 
+/**
+	Create a template of new orders - for sending repeated orders of a symbol with minimal overhead
+	the static params are serialized and hashed once, each order sets only the price, quantity and client order id
+	@param static_params - the params sent with every order (symbol, side, type, timeInForce...)
+	@param price_precision - number of decimals of prices
+	@param quantity_precision - number of decimals of quantities
+	@return the template - must not outlive the client, and uses the testnet mode set at creation
+*/
+template <typename CT>
+OrderTemplate FuturesClient<CT>::order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision)
+{
+	try
+	{
+		if (!this->_signer)
+		{
+			MissingCredentials e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		return static_cast<CT*>(this)->v__order_template(static_params, price_precision, quantity_precision);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
 
 //  ------------------------------ End | FuturesClient General methods - Infrastructure
 
@@ -4850,55 +5280,67 @@ bool FuturesClient<CT>::v_ping_client() { return static_cast<CT*>(this)->v__ping
 	CRTP of exchange_info()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_exchange_info() { return static_cast<CT*>(this)->v__exchange_info(); }
+RestResponse FuturesClient<CT>::v_exchange_info() { return static_cast<CT*>(this)->v__exchange_info(); }
 
 /**
 	CRTP of order_book()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_order_book(const Params* params_ptr) { return static_cast<CT*>(this)->v__order_book(params_ptr); }
+RestResponse FuturesClient<CT>::v_order_book(const Params* params_ptr) { return static_cast<CT*>(this)->v__order_book(params_ptr); }
+
+/**
+	CRTP of order_book_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_order_book_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__order_book_request(params_ptr); }
 
 /**
 	CRTP of trades_recent()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_public_trades_recent(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_recent(params_ptr); }
+RestResponse FuturesClient<CT>::v_public_trades_recent(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_recent(params_ptr); }
 
 /**
 	CRTP of public_trades_historical()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_public_trades_historical(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_historical(params_ptr); }
+RestResponse FuturesClient<CT>::v_public_trades_historical(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_historical(params_ptr); }
 
 /**
 	CRTP of public_trades_agg()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_public_trades_agg(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_agg(params_ptr); }
+RestResponse FuturesClient<CT>::v_public_trades_agg(const Params* params_ptr) { return static_cast<CT*>(this)->v__public_trades_agg(params_ptr); }
 
 /**
 	CRTP of klines()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_klines(const Params* params_ptr) { return static_cast<CT*>(this)->v__klines(params_ptr); }
+RestResponse FuturesClient<CT>::v_klines(const Params* params_ptr) { return static_cast<CT*>(this)->v__klines(params_ptr); }
+
+/**
+	CRTP of klines_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_klines_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__klines_request(params_ptr); }
 
 /**
 	CRTP of daily_ticker_stats()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_daily_ticker_stats(const Params* params_ptr) { return static_cast<CT*>(this)->v__daily_ticker_stats(params_ptr); }
+RestResponse FuturesClient<CT>::v_daily_ticker_stats(const Params* params_ptr) { return static_cast<CT*>(this)->v__daily_ticker_stats(params_ptr); }
 
 /**
 	CRTP of get_ticker()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_get_ticker(const Params* params_ptr) { return static_cast<CT*>(this)->v__get_ticker(params_ptr); }
+RestResponse FuturesClient<CT>::v_get_ticker(const Params* params_ptr) { return static_cast<CT*>(this)->v__get_ticker(params_ptr); }
 
 /**
 	CRTP of get_order_book_ticker()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_get_order_book_ticker(const Params* params_ptr) { return static_cast<CT*>(this)->v__get_order_book_ticker(params_ptr); }
+RestResponse FuturesClient<CT>::v_get_order_book_ticker(const Params* params_ptr) { return static_cast<CT*>(this)->v__get_order_book_ticker(params_ptr); }
 
 //  ------------------------------ End | FuturesClient CRTP methods - Market Data Implementations
 
@@ -4911,16 +5353,16 @@ simdjson::dom::element FuturesClient<CT>::v_get_order_book_ticker(const Params*
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::mark_price(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::mark_price(const Params* params_ptr) 
 { 
 	try
 	{
 		return static_cast<CT*>(this)->v_mark_price(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4930,16 +5372,16 @@ simdjson::dom::element FuturesClient<CT>::mark_price(const Params* params_ptr)
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::open_interest(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::open_interest(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_open_interest(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4949,16 +5391,16 @@ simdjson::dom::element FuturesClient<CT>::open_interest(const Params* params_ptr
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClient<CT>::composite_index_symbol_info(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_open_interest(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4970,16 +5412,16 @@ simdjson::dom::element FuturesClient<CT>::composite_index_symbol_info(const Para
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::continues_klines(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::continues_klines(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_continues_klines(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -4989,16 +5431,16 @@ simdjson::dom::element FuturesClient<CT>::continues_klines(const Params* params_
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::index_klines(const Params* params_ptr)
+RestResponse FuturesClient<CT>::index_klines(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_index_klines(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5008,16 +5450,16 @@ simdjson::dom::element FuturesClient<CT>::index_klines(const Params* params_ptr)
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::mark_klines(const Params* params_ptr)
+RestResponse FuturesClient<CT>::mark_klines(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_ticker(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5030,16 +5472,16 @@ simdjson::dom::element FuturesClient<CT>::mark_klines(const Params* params_ptr)
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::funding_rate_history(const Params* params_ptr)
+RestResponse FuturesClient<CT>::funding_rate_history(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_funding_rate_history(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5050,16 +5492,16 @@ simdjson::dom::element FuturesClient<CT>::funding_rate_history(const Params* par
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClient<CT>::change_multiasset_margin_mode(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_multiasset_margin_mode(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5070,16 +5512,16 @@ simdjson::dom::element FuturesClient<CT>::change_multiasset_margin_mode(const Pa
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::check_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClient<CT>::check_multiasset_margin_mode(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_multiasset_margin_mode(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5094,7 +5536,7 @@ simdjson::dom::element FuturesClient<CT>::check_multiasset_margin_mode(const Par
 	CRTP of test_new_order()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_test_new_order(const Params* params_ptr)
+RestResponse FuturesClient<CT>::v_test_new_order(const Params* params_ptr)
 { 
 	std::string error_msg{ "use_tesnet_instead" };
 	CustomException e(error_msg);
@@ -5102,111 +5544,302 @@ simdjson::dom::element FuturesClient<CT>::v_test_new_order(const Params* params_
 	throw(e);
 }
 
+/**
+	CRTP of test_new_order_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_test_new_order_request(const Params* params_ptr)
+{
+	std::string error_msg{ "use_tesnet_instead" };
+	CustomException e(error_msg);
+	e.append_to_traceback(std::string(__FUNCTION__));
+	throw(e);
+}
+
 /**
 	CRTP of new_order()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_new_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__new_order(params_ptr); }
+RestResponse FuturesClient<CT>::v_new_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__new_order(params_ptr); }
+
+/**
+	CRTP of new_order_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_new_order_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__new_order_request(params_ptr); }
 
 /**
 	CRTP of cancel_order()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_cancel_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_order(params_ptr); }
+RestResponse FuturesClient<CT>::v_cancel_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_order(params_ptr); }
+
+/**
+	CRTP of cancel_order_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_cancel_order_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_order_request(params_ptr); }
 
 /**
 	CRTP of cancel_all_orders()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_cancel_all_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_all_orders(params_ptr); }
+RestResponse FuturesClient<CT>::v_cancel_all_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_all_orders(params_ptr); }
+
+/**
+	CRTP of cancel_all_orders_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_cancel_all_orders_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__cancel_all_orders_request(params_ptr); }
 
 /**
 	CRTP of query_order()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_query_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__query_order(params_ptr); }
+RestResponse FuturesClient<CT>::v_query_order(const Params* params_ptr) { return static_cast<CT*>(this)->v__query_order(params_ptr); }
+
+/**
+	CRTP of query_order_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_query_order_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__query_order_request(params_ptr); }
 
 /**
 	CRTP of open_orders()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_open_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__open_orders(params_ptr); }
+RestResponse FuturesClient<CT>::v_open_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__open_orders(params_ptr); }
+
+/**
+	CRTP of open_orders_request()
+*/
+template<typename CT>
+RestRequest FuturesClient<CT>::v_open_orders_request(const Params* params_ptr) { return static_cast<CT*>(this)->v__open_orders_request(params_ptr); }
 
 /**
 	CRTP of all_orders()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_all_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__all_orders(params_ptr); }
+RestResponse FuturesClient<CT>::v_all_orders(const Params* params_ptr) { return static_cast<CT*>(this)->v__all_orders(params_ptr); }
 
 /**
 	CRTP of account_info()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_account_info(const Params* params_ptr) { return static_cast<CT*>(this)->v__account_info(params_ptr); }
+RestResponse FuturesClient<CT>::v_account_info(const Params* params_ptr) { return static_cast<CT*>(this)->v__account_info(params_ptr); }
 
 /**
 	CRTP of account_trades_list()
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::v_account_trades_list(const Params* params_ptr) { return static_cast<CT*>(this)->v__account_trades_list(params_ptr); }
+RestResponse FuturesClient<CT>::v_account_trades_list(const Params* params_ptr) { return static_cast<CT*>(this)->v__account_trades_list(params_ptr); }
 
 // -- Up to 'FuturesClient' (this) Level
 
 /**
-	Change Position Mode - Change user's position mode (Hedge Mode or One-way Mode ) on EVERY symbol
+	Change Position Mode - Change user's position mode (Hedge Mode or One-way Mode ) on EVERY symbol
+	@param params_ptr - a pointer to the request Params object
+	@return json returned by the request
+*/
+template<typename CT>
+RestResponse FuturesClient<CT>::change_position_mode(const Params* params_ptr) 
+{
+	try
+	{
+		return static_cast<CT*>(this)->v_change_position_mode(params_ptr);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Get Position Mode - Get user's position mode (Hedge Mode or One-way Mode ) on EVERY symbol
+	@param params_ptr - a pointer to the request Params object
+	@return json returned by the request
+*/
+template<typename CT>
+RestResponse FuturesClient<CT>::get_position_mode(const Params* params_ptr)
+{
+	try
+	{
+		return static_cast<CT*>(this)->v_get_position_mode(params_ptr);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Place Multiple Orders
+	@param params_ptr - a pointer to the request Params object
+	@return json returned by the request
+*/
+template<typename CT>
+RestResponse FuturesClient<CT>::batch_orders(const Params* params_ptr) 
+{
+	try
+	{
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_batch_orders(params_ptr);
+		return static_cast<CT*>(this)->v_batch_orders(params_ptr);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Build a Place Multiple Orders request, for 'async_req()' - validated like 'batch_orders()'
 	@param params_ptr - a pointer to the request Params object
-	@return json returned by the request
+	@return the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_position_mode(const Params* params_ptr) 
+RestRequest FuturesClient<CT>::batch_orders_request(const Params* params_ptr)
 {
 	try
 	{
-		return static_cast<CT*>(this)->v_change_position_mode(params_ptr);
+		if (this->_order_validator) params_ptr = this->_order_validator->validate_batch_orders(params_ptr);
+		return static_cast<CT*>(this)->v_batch_orders_request(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
 /**
-	Get Position Mode - Get user's position mode (Hedge Mode or One-way Mode ) on EVERY symbol
-	@param params_ptr - a pointer to the request Params object
-	@return json returned by the request
+	Place any number of orders, in batchOrders requests of up to 5 orders sent concurrently (async requests)
+	each order is checked by the order validator on its own - a rejected order is not sent, and the others are
+	@param orders - the params of each order, as for new_order (symbol, side, type, quantity...)
+	@param batch_params - params of each request, not of the orders (i.e: recvWindow) - may be null
+	@return the result of each order, in the order of the input
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_position_mode(const Params* params_ptr)
+BatchResponse FuturesClient<CT>::batch_new_orders(const std::vector<Params>& orders, const Params* batch_params)
 {
+	static thread_local Params chunk_params{};
+	static thread_local std::string batch_buffer = std::string(1024, '\0'); // the capacity is kept between batches
+
 	try
 	{
-		return static_cast<CT*>(this)->v_get_position_mode(params_ptr);
+		BatchResponse batch_response{ orders.size() };
+
+		std::vector<size_t> order_indices{}; // of the orders sent, chunk n holds [n * 5, n * 5 + 5)
+		order_indices.reserve(orders.size());
+		std::vector<std::future<RestResponse>> chunk_responses{};
+		chunk_responses.reserve((orders.size() + MAX_BATCH_ORDERS - 1) / MAX_BATCH_ORDERS);
+
+		auto send_chunk = [this, batch_params, &chunk_responses, &order_indices, &batch_response]()
+		{
+			batch_buffer.append("%5D"); // ']'
+
+			if (batch_params) chunk_params = *batch_params;
+			else chunk_params.flush_params();
+			chunk_params.set_param<std::string>("batchOrders", batch_buffer);
+
+			try
+			{
+				chunk_responses.push_back(this->async_req(static_cast<CT*>(this)->v_batch_orders_request(&chunk_params))); // validated already
+			}
+			catch (ClientException& e) // not sent (i.e: RateLimitExceeded) - chunks already sent are still collected
+			{
+				chunk_responses.emplace_back(); // an invalid future marks the chunk
+				const size_t chunk_start = (chunk_responses.size() - 1) * MAX_BATCH_ORDERS;
+				std::string error{ e.what() };
+				for (size_t chunk_index = chunk_start; chunk_index < order_indices.size(); chunk_index++) batch_response.set_error(order_indices[chunk_index], error);
+			}
+		};
+
+		for (size_t order_index = 0; order_index < orders.size(); order_index++)
+		{
+			const Params* order_params = &orders[order_index];
+			try
+			{
+				if (this->_order_validator) order_params = this->_order_validator->validate_order(order_params); // a normalized copy is kept until the next call
+			}
+			catch (const OrderRejected& e)
+			{
+				batch_response.set_error(order_index, "order_rejected_" + e.reason);
+				continue;
+			}
+
+			if (!(order_indices.size() % MAX_BATCH_ORDERS)) batch_buffer.assign("%5B"); // '[' - the array is sent url encoded
+			else batch_buffer.append("%2C"); // ','
+			FuturesClient<CT>::_append_batch_order(batch_buffer, *order_params);
+
+			order_indices.push_back(order_index);
+			if (!(order_indices.size() % MAX_BATCH_ORDERS)) send_chunk();
+		}
+		if (order_indices.size() % MAX_BATCH_ORDERS) send_chunk();
+
+		for (size_t chunk_number = 0; chunk_number < chunk_responses.size(); chunk_number++)
+		{
+			const size_t chunk_start = chunk_number * MAX_BATCH_ORDERS;
+			const size_t chunk_size = std::min(order_indices.size() - chunk_start, size_t{ MAX_BATCH_ORDERS });
+			if (!chunk_responses[chunk_number].valid()) continue; // errors set when it was not sent
+
+			try
+			{
+				batch_response.add_response(chunk_responses[chunk_number].get(), &order_indices[chunk_start], chunk_size);
+			}
+			catch (ClientException& e)
+			{
+				std::string error{ e.what() };
+				for (size_t chunk_index = chunk_start; chunk_index < chunk_start + chunk_size; chunk_index++) batch_response.set_error(order_indices[chunk_index], error);
+			}
+		}
+
+		return batch_response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
 /**
-	Place Multiple Orders
-	@param params_ptr - a pointer to the request Params object
-	@return json returned by the request
+	Append an order to a batchOrders array, as a url encoded json object of strings
+	@param batch_buffer - the array being written
+	@param order - the params of the order
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::batch_orders(const Params* params_ptr) 
+void FuturesClient<CT>::_append_batch_order(std::string& batch_buffer, const Params& order)
 {
-	try
+	auto append_string = [&batch_buffer](std::string_view text)
 	{
-		return static_cast<CT*>(this)->v_batch_orders(params_ptr);
-	}
-	catch (ClientException e)
+		batch_buffer.append("%22"); // '"'
+		size_t part_start = 0;
+		for (size_t i = 0; i < text.size(); i++)
+		{
+			if (text[i] != '"' && text[i] != '\\') continue;
+			url_encode(text.substr(part_start, i - part_start), batch_buffer);
+			batch_buffer.append("%5C"); // json escape
+			part_start = i;
+		}
+		url_encode(text.substr(part_start), batch_buffer);
+		batch_buffer.append("%22");
+	};
+
+	bool first_field{ 1 };
+	batch_buffer.append("%7B"); // '{'
+	for (const Params::Param& param : order)
 	{
-		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		if (param.key == "recvWindow" || param.key == "timestamp") continue; // params of the request
+		if (!first_field) batch_buffer.append("%2C"); // ','
+		first_field = 0;
+		append_string(param.key);
+		batch_buffer.append("%3A"); // ':'
+		append_string(param.value);
 	}
+	batch_buffer.append("%7D");
 }
 
 /**
@@ -5215,16 +5848,16 @@ simdjson::dom::element FuturesClient<CT>::batch_orders(const Params* params_ptr)
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::cancel_batch_orders(const Params* params_ptr)
+RestResponse FuturesClient<CT>::cancel_batch_orders(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_cancel_batch_orders(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5245,16 +5878,16 @@ simdjson::dom::element FuturesClient<CT>::cancel_batch_orders(const Params* para
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::cancel_all_orders_timer(const Params* params_ptr)
+RestResponse FuturesClient<CT>::cancel_all_orders_timer(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_cancel_all_orders_timer(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5264,16 +5897,16 @@ simdjson::dom::element FuturesClient<CT>::cancel_all_orders_timer(const Params*
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::query_open_order(const Params* params_ptr)
+RestResponse FuturesClient<CT>::query_open_order(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_query_open_order(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5283,16 +5916,16 @@ simdjson::dom::element FuturesClient<CT>::query_open_order(const Params* params_
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::account_balances(const Params* params_ptr)
+RestResponse FuturesClient<CT>::account_balances(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_account_balances(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 	}
 
@@ -5302,16 +5935,16 @@ simdjson::dom::element FuturesClient<CT>::account_balances(const Params* params_
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_leverage(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::change_leverage(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_leverage(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5321,16 +5954,16 @@ simdjson::dom::element FuturesClient<CT>::change_leverage(const Params* params_p
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_margin_type(const Params* params_ptr)
+RestResponse FuturesClient<CT>::change_margin_type(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_margin_type(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5340,16 +5973,16 @@ simdjson::dom::element FuturesClient<CT>::change_margin_type(const Params* param
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_position_margin(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::change_position_margin(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_position_margin(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5359,16 +5992,16 @@ simdjson::dom::element FuturesClient<CT>::change_position_margin(const Params* p
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::change_position_margin_history(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::change_position_margin_history(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_change_position_margin_history(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5378,16 +6011,16 @@ simdjson::dom::element FuturesClient<CT>::change_position_margin_history(const P
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::position_info(const Params* params_ptr)
+RestResponse FuturesClient<CT>::position_info(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_position_info(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5397,16 +6030,16 @@ simdjson::dom::element FuturesClient<CT>::position_info(const Params* params_ptr
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_income_history(const Params* params_ptr)
+RestResponse FuturesClient<CT>::get_income_history(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_income_history(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5416,16 +6049,16 @@ simdjson::dom::element FuturesClient<CT>::get_income_history(const Params* param
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_leverage_bracket(const Params* params_ptr) 
+RestResponse FuturesClient<CT>::get_leverage_bracket(const Params* params_ptr) 
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_leverage_bracket(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5435,16 +6068,16 @@ simdjson::dom::element FuturesClient<CT>::get_leverage_bracket(const Params* par
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::users_force_orders(const Params* params_ptr)
+RestResponse FuturesClient<CT>::users_force_orders(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_users_force_orders(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5463,16 +6096,16 @@ simdjson::dom::element FuturesClient<CT>::users_force_orders(const Params* param
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::pos_adl_quantile_est(const Params* params_ptr)
+RestResponse FuturesClient<CT>::pos_adl_quantile_est(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_pos_adl_quantile_est(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5482,16 +6115,16 @@ simdjson::dom::element FuturesClient<CT>::pos_adl_quantile_est(const Params* par
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_user_comission_rate(const Params* params_ptr)
+RestResponse FuturesClient<CT>::get_user_comission_rate(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_user_comission_rate(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5501,16 +6134,16 @@ simdjson::dom::element FuturesClient<CT>::get_user_comission_rate(const Params*
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::api_quant_trading_rules(const Params* params_ptr)
+RestResponse FuturesClient<CT>::api_quant_trading_rules(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_api_quant_trading_rules(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5520,16 +6153,16 @@ simdjson::dom::element FuturesClient<CT>::api_quant_trading_rules(const Params*
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_blvt_kline_history(const Params* params_ptr)
+RestResponse FuturesClient<CT>::get_blvt_kline_history(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_blvt_kline_history(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5539,16 +6172,16 @@ simdjson::dom::element FuturesClient<CT>::get_blvt_kline_history(const Params* p
 	@return json returned by the request
 */
 template<typename CT>
-simdjson::dom::element FuturesClient<CT>::get_composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClient<CT>::get_composite_index_symbol_info(const Params* params_ptr)
 {
 	try
 	{
 		return static_cast<CT*>(this)->v_get_composite_index_symbol_info(params_ptr);
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5567,13 +6200,19 @@ std::string FuturesClient<CT>::v_get_listen_key() { return static_cast<CT*>(this
 	CRTP of ping_listen_key()
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::v_ping_listen_key(const std::string& listen_key) { return static_cast<CT*>(this)->v__ping_listen_key(); }
+RestResponse FuturesClient<CT>::v_ping_listen_key(const std::string& listen_key) { return static_cast<CT*>(this)->v__ping_listen_key(); }
+
+/**
+	CRTP of ping_listen_key_request()
+*/
+template <typename CT>
+RestRequest FuturesClient<CT>::v_ping_listen_key_request(const std::string& listen_key) { return static_cast<CT*>(this)->v__ping_listen_key_request(); }
 
 /**
 	CRTP of revoke_listen_key()
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::v_revoke_listen_key(const std::string& listen_key) { return static_cast<CT*>(this)->v__revoke_listen_key(); }
+RestResponse FuturesClient<CT>::v_revoke_listen_key(const std::string& listen_key) { return static_cast<CT*>(this)->v__revoke_listen_key(); }
 
 //  ------------------------------ End | FuturesClient Global + CRTP methods - WS Streams 
 
@@ -5586,20 +6225,18 @@ simdjson::dom::element FuturesClient<CT>::v_revoke_listen_key(const std::string&
 	@return json returned by the request
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::open_interest_stats(const Params* params_ptr)
+RestResponse FuturesClient<CT>::open_interest_stats(const Params* params_ptr)
 {
 	try
 	{
-		std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-		std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-		full_path += "/futures/data/openInterestHist" + query;
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+		const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/futures/data/openInterestHist", params_ptr);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5610,21 +6247,19 @@ simdjson::dom::element FuturesClient<CT>::open_interest_stats(const Params* para
 	@return json returned by the request
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::top_long_short_ratio(const Params* params_ptr, bool accounts)
+RestResponse FuturesClient<CT>::top_long_short_ratio(const Params* params_ptr, bool accounts)
 {
 	try
 	{
-		std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-		std::string endpoint = accounts ? "/futures/data/topLongShortAccountRatio" : "/futures/data/topLongShortPositionRatio";
-		std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-		full_path += (endpoint + query);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+		const std::string_view endpoint = accounts ? "/futures/data/topLongShortAccountRatio" : "/futures/data/topLongShortPositionRatio";
+		const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, endpoint, params_ptr);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5637,20 +6272,18 @@ simdjson::dom::element FuturesClient<CT>::top_long_short_ratio(const Params* par
 	@return json returned by the request
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::global_long_short_ratio(const Params* params_ptr)
+RestResponse FuturesClient<CT>::global_long_short_ratio(const Params* params_ptr)
 {
 	try
 	{
-		std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-		std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-		full_path += ("/futures/data/globalLongShortAccountRatio" + query);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+		const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/futures/data/globalLongShortAccountRatio", params_ptr);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5663,20 +6296,18 @@ simdjson::dom::element FuturesClient<CT>::global_long_short_ratio(const Params*
 	@return json returned by the request
 */
 template <typename CT>
-simdjson::dom::element FuturesClient<CT>::taker_long_short_ratio(const Params* params_ptr)
+RestResponse FuturesClient<CT>::taker_long_short_ratio(const Params* params_ptr)
 {
 	try
 	{
-		std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-		std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-		full_path += ("/futures/data/takerlongshortRatio" + query);
-		simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+		const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/futures/data/takerlongshortRatio", params_ptr);
+		RestResponse response = (this->_rest_client)->_getreq(full_path);
 		return response;
 	}
-	catch (ClientException e)
+	catch (ClientException& e)
 	{
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
 }
 
@@ -5746,7 +6377,7 @@ bool FuturesClientUSDT::v__ping_client()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/ping";
-	simdjson::dom::element ping_response = (this->_rest_client)->_getreq(full_path);
+	RestResponse ping_response = (this->_rest_client)->_getreq(full_path);
 	return (ping_response.is_null());
 }
 
@@ -5757,115 +6388,116 @@ unsigned long long FuturesClientUSDT::v__exchange_time()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/time";
-	std::string ex_time = std::string((this->_rest_client)->_getreq(full_path)["serverTime"].get_string().value());
+	uint64_t server_time{ 0 };
+	if ((this->_rest_client)->_getreq(full_path)["serverTime"].get_uint64().get(server_time)) server_time = 0; // serverTime is a number
 
-	return std::atoll(ex_time.c_str());
+	return server_time;
 }
 
 /**
 	CRTP of v_exchange_info()
 */
-simdjson::dom::element FuturesClientUSDT::v__exchange_info()
+RestResponse FuturesClientUSDT::v__exchange_info()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/exchangeInfo";
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_order_book()
 */
-simdjson::dom::element FuturesClientUSDT::v__order_book(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__order_book(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/depth" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/depth", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of v_order_book_request()
+*/
+RestRequest FuturesClientUSDT::v__order_book_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/depth", params_ptr);
+}
+
 /**
 	CRTP of v_public_trades_recent()
 */
-simdjson::dom::element FuturesClientUSDT::v__public_trades_recent(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__public_trades_recent(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/trades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/trades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_public_trades_historical()
 */
-simdjson::dom::element FuturesClientUSDT::v__public_trades_historical(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__public_trades_historical(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/historicalTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/historicalTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_public_trades_agg()
 */
-simdjson::dom::element FuturesClientUSDT::v__public_trades_agg(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__public_trades_agg(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/aggTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/aggTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_klines()
 */
-simdjson::dom::element FuturesClientUSDT::v__klines(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/klines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/klines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of v_klines_request()
+*/
+RestRequest FuturesClientUSDT::v__klines_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/klines", params_ptr);
+}
+
 /**
 	CRTP of v_daily_ticker_stats()
 */
-simdjson::dom::element FuturesClientUSDT::v__daily_ticker_stats(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__daily_ticker_stats(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/ticker/24hr" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/ticker/24hr", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_get_ticker()
 */
-simdjson::dom::element FuturesClientUSDT::v__get_ticker(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__get_ticker(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/ticker/price" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/ticker/price", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_get_order_book_ticker()
 */
-simdjson::dom::element FuturesClientUSDT::v__get_order_book_ticker(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__get_order_book_ticker(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/ticker/bookTicker" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/ticker/bookTicker", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -5877,36 +6509,30 @@ simdjson::dom::element FuturesClientUSDT::v__get_order_book_ticker(const Params*
 /**
 	CRTP of mark_price()
 */
-simdjson::dom::element FuturesClientUSDT::v_mark_price(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_mark_price(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/premiumIndex" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/premiumIndex", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of open_interest()
 */
-simdjson::dom::element FuturesClientUSDT::v_open_interest(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_open_interest(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/openInterest" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/openInterest", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of composite_index_symbol_info()
 */
-simdjson::dom::element FuturesClientUSDT::v_composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_composite_index_symbol_info(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/indexInfo" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/indexInfo", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -5915,36 +6541,30 @@ simdjson::dom::element FuturesClientUSDT::v_composite_index_symbol_info(const Pa
 /**
 	CRTP of continues_klines()
 */
-simdjson::dom::element FuturesClientUSDT::v_continues_klines(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_continues_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/continuousKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/continuousKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of index_klines()
 */
-simdjson::dom::element FuturesClientUSDT::v_index_klines(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_index_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/indexPriceKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/indexPriceKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of mark_klines()
 */
-simdjson::dom::element FuturesClientUSDT::v_mark_klines(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_mark_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/markPriceKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/markPriceKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -5954,36 +6574,30 @@ simdjson::dom::element FuturesClientUSDT::v_mark_klines(const Params* params_ptr
 /**
 	CRTP of funding_rate_history() - Unique for USDT margined client
 */
-simdjson::dom::element FuturesClientUSDT::v_funding_rate_history(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_funding_rate_history(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/fundingRate" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/fundingRate", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of change_multiasset_margin_mode() - Unique for USDT margined client
 */
-simdjson::dom::element FuturesClientUSDT::v_change_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_multiasset_margin_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/multiAssetsMargin" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/multiAssetsMargin", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of check_multiasset_margin_mode() - Unique for USDT margined client
 */
-simdjson::dom::element FuturesClientUSDT::v_check_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_check_multiasset_margin_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/multiAssetsMargin" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/multiAssetsMargin", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -5997,78 +6611,106 @@ simdjson::dom::element FuturesClientUSDT::v_check_multiasset_margin_mode(const P
 /**
 	CRTP of v_new_order()
 */
-simdjson::dom::element FuturesClientUSDT::v__new_order(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__new_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/order" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_new_order_request()
+*/
+RestRequest FuturesClientUSDT::v__new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_cancel_order()
 */
-simdjson::dom::element FuturesClientUSDT::v__cancel_order(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__cancel_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += "/fapi/v1/order";
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_cancel_order_request()
+*/
+RestRequest FuturesClientUSDT::v__cancel_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_cancel_all_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v__cancel_all_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__cancel_all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += "/fapi/v1/allOpenOrders";
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/allOpenOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_cancel_all_orders_request()
+*/
+RestRequest FuturesClientUSDT::v__cancel_all_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/allOpenOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of v_query_order()
 */
-simdjson::dom::element FuturesClientUSDT::v__query_order(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__query_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/order" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_query_order_request()
+*/
+RestRequest FuturesClientUSDT::v__query_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_open_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v__open_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__open_orders(const Params* params_ptr)
 {
 
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/openOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/openOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_open_orders_request()
+*/
+RestRequest FuturesClientUSDT::v__open_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/openOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of v_all_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v__all_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/allOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/allOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6076,12 +6718,10 @@ simdjson::dom::element FuturesClientUSDT::v__all_orders(const Params* params_ptr
 /**
 	CRTP of v_account_info()
 */
-simdjson::dom::element FuturesClientUSDT::v__account_info(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__account_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v2/account" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v2/account", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6089,12 +6729,10 @@ simdjson::dom::element FuturesClientUSDT::v__account_info(const Params* params_p
 /**
 	CRTP of v_account_trades_list()
 */
-simdjson::dom::element FuturesClientUSDT::v__account_trades_list(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v__account_trades_list(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/userTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/userTrades", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6104,12 +6742,10 @@ simdjson::dom::element FuturesClientUSDT::v__account_trades_list(const Params* p
 /**
 	CRTP of change_position_mode()
 */
-simdjson::dom::element FuturesClientUSDT::v_change_position_mode(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_position_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/positionSide/dual" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/positionSide/dual", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6117,12 +6753,10 @@ simdjson::dom::element FuturesClientUSDT::v_change_position_mode(const Params* p
 /**
 	CRTP of get_position_mode()
 */
-simdjson::dom::element FuturesClientUSDT::v_get_position_mode(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_position_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/positionSide/dual" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/positionSide/dual", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6130,38 +6764,51 @@ simdjson::dom::element FuturesClientUSDT::v_get_position_mode(const Params* para
 /**
 	CRTP of batch_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v_batch_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_batch_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/batchOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/batchOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
 
+/**
+	CRTP of batch_orders_request()
+*/
+RestRequest FuturesClientUSDT::v_batch_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/batchOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_batch_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v_cancel_batch_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_cancel_batch_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/batchOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/batchOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path); // should be spot?
 
 	return response;
 }
 
+/**
+	CRTP of order_template()
+*/
+OrderTemplate FuturesClientUSDT::v__order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision)
+{
+	std::string order_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
+	order_path += "/fapi/v1/order";
+
+	return OrderTemplate{ this->_rest_client, *this->_signer, order_path, static_params, price_precision, quantity_precision, this->_clock };
+}
+
 /**
 	CRTP of cancel_all_orders_timer()
 */
-simdjson::dom::element FuturesClientUSDT::v_cancel_all_orders_timer(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_cancel_all_orders_timer(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/countdownCancelAll" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/countdownCancelAll", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6169,12 +6816,10 @@ simdjson::dom::element FuturesClientUSDT::v_cancel_all_orders_timer(const Params
 /**
 	CRTP of query_open_order()
 */
-simdjson::dom::element FuturesClientUSDT::v_query_open_order(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_query_open_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/openOrder" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/openOrder", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6182,13 +6827,11 @@ simdjson::dom::element FuturesClientUSDT::v_query_open_order(const Params* param
 /**
 	CRTP of account_balances()
 */
-simdjson::dom::element FuturesClientUSDT::v_account_balances(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_account_balances(const Params* params_ptr)
 {
 
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v2/balance" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v2/balance", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6196,12 +6839,10 @@ simdjson::dom::element FuturesClientUSDT::v_account_balances(const Params* param
 /**
 	CRTP of change_leverage()
 */
-simdjson::dom::element FuturesClientUSDT::v_change_leverage(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_leverage(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/leverage" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/leverage", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6209,12 +6850,10 @@ simdjson::dom::element FuturesClientUSDT::v_change_leverage(const Params* params
 /**
 	CRTP of change_margin_type()
 */
-simdjson::dom::element FuturesClientUSDT::v_change_margin_type(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_margin_type(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/marginType" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/marginType", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6222,12 +6861,10 @@ simdjson::dom::element FuturesClientUSDT::v_change_margin_type(const Params* par
 /**
 	CRTP of change_position_margin()
 */
-simdjson::dom::element FuturesClientUSDT::v_change_position_margin(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_position_margin(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/positionMargin" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/positionMargin", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6235,12 +6872,10 @@ simdjson::dom::element FuturesClientUSDT::v_change_position_margin(const Params*
 /**
 	CRTP of change_position_margin_history()
 */
-simdjson::dom::element FuturesClientUSDT::v_change_position_margin_history(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_change_position_margin_history(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/positionMargin/history" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path); // should be spot?
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/positionMargin/history", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path); // should be spot?
 
 	return response;
 }
@@ -6248,12 +6883,10 @@ simdjson::dom::element FuturesClientUSDT::v_change_position_margin_history(const
 /**
 	CRTP of position_info()
 */
-simdjson::dom::element FuturesClientUSDT::v_position_info(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_position_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v2/positionRisk" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v2/positionRisk", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6261,12 +6894,10 @@ simdjson::dom::element FuturesClientUSDT::v_position_info(const Params* params_p
 /**
 	CRTP of get_income_history()
 */
-simdjson::dom::element FuturesClientUSDT::v_get_income_history(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_income_history(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/income" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/income", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6274,12 +6905,10 @@ simdjson::dom::element FuturesClientUSDT::v_get_income_history(const Params* par
 /**
 	CRTP of get_leverage_bracket()
 */
-simdjson::dom::element FuturesClientUSDT::v_get_leverage_bracket(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_leverage_bracket(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/leverageBracket" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/leverageBracket", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6287,7 +6916,7 @@ simdjson::dom::element FuturesClientUSDT::v_get_leverage_bracket(const Params* p
 /**
 	CRTP of users_force_orders()
 */
-simdjson::dom::element FuturesClientUSDT::v_users_force_orders(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_users_force_orders(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -6297,12 +6926,10 @@ simdjson::dom::element FuturesClientUSDT::v_users_force_orders(const Params* par
 /**
 	CRTP of pos_adl_quantile_est()
 */
-simdjson::dom::element FuturesClientUSDT::v_pos_adl_quantile_est(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_pos_adl_quantile_est(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/adlQuantile" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/adlQuantile", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6310,7 +6937,7 @@ simdjson::dom::element FuturesClientUSDT::v_pos_adl_quantile_est(const Params* p
 /**
 	CRTP of get_user_comission_rate() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientUSDT::v_get_user_comission_rate(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_user_comission_rate(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -6321,12 +6948,10 @@ simdjson::dom::element FuturesClientUSDT::v_get_user_comission_rate(const Params
 /**
 	CRTP of api_quant_trading_rules() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientUSDT::v_api_quant_trading_rules(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_api_quant_trading_rules(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 0);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/apiTradingStatus" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/apiTradingStatus", params_ptr, 0);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6334,12 +6959,10 @@ simdjson::dom::element FuturesClientUSDT::v_api_quant_trading_rules(const Params
 /**
 	CRTP of get_blvt_kline_history() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientUSDT::v_get_blvt_kline_history(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_blvt_kline_history(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 0);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/lvtKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/lvtKlines", params_ptr, 0);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6347,12 +6970,10 @@ simdjson::dom::element FuturesClientUSDT::v_get_blvt_kline_history(const Params*
 /**
 	CRTP of get_composite_index_symbol_info() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientUSDT::v_get_composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClientUSDT::v_get_composite_index_symbol_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 0);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/fapi/v1/indexInfo" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/indexInfo", params_ptr, 0);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6368,7 +6989,7 @@ std::string FuturesClientUSDT::v__get_listen_key()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/listenKey";
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return std::string(response["listenKey"].get_string().value());
 }
@@ -6376,26 +6997,34 @@ std::string FuturesClientUSDT::v__get_listen_key()
 /**
 	CRTP of v_ping_listen_key()
 */
-simdjson::dom::element FuturesClientUSDT::v__ping_listen_key()
+RestResponse FuturesClientUSDT::v__ping_listen_key()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/listenKey";
 
-	simdjson::dom::element response = (this->_rest_client)->_putreq(full_path);
+	RestResponse response = (this->_rest_client)->_putreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_ping_listen_key_request()
+*/
+RestRequest FuturesClientUSDT::v__ping_listen_key_request()
+{
+	return this->_build_request(RestRequestType::put_request, !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET, "/fapi/v1/listenKey", nullptr);
+}
+
 /**
 	CRTP of v_revoke_listen_key()
 */
-simdjson::dom::element FuturesClientUSDT::v__revoke_listen_key()
+RestResponse FuturesClientUSDT::v__revoke_listen_key()
 {
 
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_USDT : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/fapi/v1/listenKey";
 
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
@@ -6467,7 +7096,7 @@ bool FuturesClientCoin::v__ping_client()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/ping";
-	simdjson::dom::element ping_response = (this->_rest_client)->_getreq(full_path);
+	RestResponse ping_response = (this->_rest_client)->_getreq(full_path);
 	return (ping_response.is_null());
 }
 
@@ -6478,115 +7107,116 @@ unsigned long long FuturesClientCoin::v__exchange_time()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/time";
-	std::string ex_time = std::string((this->_rest_client)->_getreq(full_path)["serverTime"].get_string().value());
+	uint64_t server_time{ 0 };
+	if ((this->_rest_client)->_getreq(full_path)["serverTime"].get_uint64().get(server_time)) server_time = 0; // serverTime is a number
 
-	return std::atoll(ex_time.c_str());
+	return server_time;
 }
 
 /**
 	CRTP of v_exchange_info()
 */
-simdjson::dom::element FuturesClientCoin::v__exchange_info()
+RestResponse FuturesClientCoin::v__exchange_info()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/exchangeInfo";
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_order_book()
 */
-simdjson::dom::element FuturesClientCoin::v__order_book(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__order_book(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/depth" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/depth", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of v_order_book_request()
+*/
+RestRequest FuturesClientCoin::v__order_book_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/depth", params_ptr);
+}
+
 /**
 	CRTP of v_public_trades_recent()
 */
-simdjson::dom::element FuturesClientCoin::v__public_trades_recent(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__public_trades_recent(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/trades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/trades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_public_trades_historical()
 */
-simdjson::dom::element FuturesClientCoin::v__public_trades_historical(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__public_trades_historical(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/historicalTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/historicalTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_public_trades_agg()
 */
-simdjson::dom::element FuturesClientCoin::v__public_trades_agg(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__public_trades_agg(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/aggTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/aggTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_klines()
 */
-simdjson::dom::element FuturesClientCoin::v__klines(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__klines(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/klines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/klines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of v_klines_request()
+*/
+RestRequest FuturesClientCoin::v__klines_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/klines", params_ptr);
+}
+
 /**
 	CRTP of v_daily_ticker_stats()
 */
-simdjson::dom::element FuturesClientCoin::v__daily_ticker_stats(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__daily_ticker_stats(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/ticker/24hr" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/ticker/24hr", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_get_ticker()
 */
-simdjson::dom::element FuturesClientCoin::v__get_ticker(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__get_ticker(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/ticker/price" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/ticker/price", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of v_get_order_book_ticker()
 */
-simdjson::dom::element FuturesClientCoin::v__get_order_book_ticker(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__get_order_book_ticker(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/ticker/bookTicker" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/ticker/bookTicker", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -6601,77 +7231,105 @@ simdjson::dom::element FuturesClientCoin::v__get_order_book_ticker(const Params*
 /**
 	CRTP of v_new_order()
 */
-simdjson::dom::element FuturesClientCoin::v__new_order(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__new_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/order" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_new_order_request()
+*/
+RestRequest FuturesClientCoin::v__new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_cancel_order()
 */
-simdjson::dom::element FuturesClientCoin::v__cancel_order(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__cancel_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/order" + query);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_cancel_order_request()
+*/
+RestRequest FuturesClientCoin::v__cancel_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_cancel_all_orders()
 */
-simdjson::dom::element FuturesClientCoin::v__cancel_all_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__cancel_all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/allOpenOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/allOpenOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_cancel_all_orders_request()
+*/
+RestRequest FuturesClientCoin::v__cancel_all_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/allOpenOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of v_query_order()
 */
-simdjson::dom::element FuturesClientCoin::v__query_order(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__query_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/order" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_query_order_request()
+*/
+RestRequest FuturesClientCoin::v__query_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of v_open_orders()
 */
-simdjson::dom::element FuturesClientCoin::v__open_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__open_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/openOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/openOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_open_orders_request()
+*/
+RestRequest FuturesClientCoin::v__open_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/openOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of v_all_orders()
 */
-simdjson::dom::element FuturesClientCoin::v__all_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/allOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/allOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6679,12 +7337,10 @@ simdjson::dom::element FuturesClientCoin::v__all_orders(const Params* params_ptr
 /**
 	CRTP of v_account_info()
 */
-simdjson::dom::element FuturesClientCoin::v__account_info(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__account_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/account" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/account", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6692,12 +7348,10 @@ simdjson::dom::element FuturesClientCoin::v__account_info(const Params* params_p
 /**
 	CRTP of v_account_trades_list()
 */
-simdjson::dom::element FuturesClientCoin::v__account_trades_list(const Params* params_ptr)
+RestResponse FuturesClientCoin::v__account_trades_list(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/userTrades" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/userTrades", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6708,12 +7362,10 @@ simdjson::dom::element FuturesClientCoin::v__account_trades_list(const Params* p
 /**
 	CRTP of change_position_mode()
 */
-simdjson::dom::element FuturesClientCoin::v_change_position_mode(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_position_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/positionSide/dual" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/positionSide/dual", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -6721,12 +7373,10 @@ simdjson::dom::element FuturesClientCoin::v_change_position_mode(const Params* p
 /**
 	CRTP of get_position_mode()
 */
-simdjson::dom::element FuturesClientCoin::v_get_position_mode(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_position_mode(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/positionSide/dual" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/positionSide/dual", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6734,38 +7384,51 @@ simdjson::dom::element FuturesClientCoin::v_get_position_mode(const Params* para
 /**
 	CRTP of batch_orders()
 */
-simdjson::dom::element FuturesClientCoin::v_batch_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_batch_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/batchOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/batchOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of batch_orders_request()
+*/
+RestRequest FuturesClientCoin::v_batch_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/batchOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_batch_orders()
 */
-simdjson::dom::element FuturesClientCoin::v_cancel_batch_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_cancel_batch_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/batchOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/batchOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of order_template()
+*/
+OrderTemplate FuturesClientCoin::v__order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision)
+{
+	std::string order_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
+	order_path += "/dapi/v1/order";
+
+	return OrderTemplate{ this->_rest_client, *this->_signer, order_path, static_params, price_precision, quantity_precision, this->_clock };
+}
+
 /**
 	CRTP of cancel_all_orders_timer()
 */
-simdjson::dom::element FuturesClientCoin::v_cancel_all_orders_timer(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_cancel_all_orders_timer(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/countdownCancelAll" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/countdownCancelAll", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -6773,12 +7436,10 @@ simdjson::dom::element FuturesClientCoin::v_cancel_all_orders_timer(const Params
 /**
 	CRTP of query_open_order()
 */
-simdjson::dom::element FuturesClientCoin::v_query_open_order(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_query_open_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/openOrder" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/openOrder", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6786,12 +7447,10 @@ simdjson::dom::element FuturesClientCoin::v_query_open_order(const Params* param
 /**
 	CRTP of account_balances()
 */
-simdjson::dom::element FuturesClientCoin::v_account_balances(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_account_balances(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/balance" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/balance", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6799,12 +7458,10 @@ simdjson::dom::element FuturesClientCoin::v_account_balances(const Params* param
 /**
 	CRTP of change_leverage()
 */
-simdjson::dom::element FuturesClientCoin::v_change_leverage(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_leverage(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/leverage" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/leverage", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -6812,12 +7469,10 @@ simdjson::dom::element FuturesClientCoin::v_change_leverage(const Params* params
 /**
 	CRTP of change_margin_type()
 */
-simdjson::dom::element FuturesClientCoin::v_change_margin_type(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_margin_type(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/marginType" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/marginType", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -6825,12 +7480,10 @@ simdjson::dom::element FuturesClientCoin::v_change_margin_type(const Params* par
 /**
 	CRTP of change_position_margin()
 */
-simdjson::dom::element FuturesClientCoin::v_change_position_margin(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_position_margin(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/positionMargin" + query);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/positionMargin", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -6838,12 +7491,10 @@ simdjson::dom::element FuturesClientCoin::v_change_position_margin(const Params*
 /**
 	CRTP of change_position_margin_history()
 */
-simdjson::dom::element FuturesClientCoin::v_change_position_margin_history(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_position_margin_history(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/positionMargin/history" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/positionMargin/history", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6851,12 +7502,10 @@ simdjson::dom::element FuturesClientCoin::v_change_position_margin_history(const
 /**
 	CRTP of position_info()
 */
-simdjson::dom::element FuturesClientCoin::v_position_info(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_position_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/positionRisk" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/positionRisk", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6864,12 +7513,10 @@ simdjson::dom::element FuturesClientCoin::v_position_info(const Params* params_p
 /**
 	CRTP of get_income_history()
 */
-simdjson::dom::element FuturesClientCoin::v_get_income_history(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_income_history(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/income" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/income", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6877,12 +7524,10 @@ simdjson::dom::element FuturesClientCoin::v_get_income_history(const Params* par
 /**
 	CRTP of get_leverage_bracket()
 */
-simdjson::dom::element FuturesClientCoin::v_get_leverage_bracket(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_leverage_bracket(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/leverageBracket" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/leverageBracket", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6890,12 +7535,10 @@ simdjson::dom::element FuturesClientCoin::v_get_leverage_bracket(const Params* p
 /**
 	CRTP of users_force_orders()
 */
-simdjson::dom::element FuturesClientCoin::v_users_force_orders(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_users_force_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/forceOrders" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/forceOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6903,12 +7546,10 @@ simdjson::dom::element FuturesClientCoin::v_users_force_orders(const Params* par
 /**
 	CRTP of pos_adl_quantile_est()
 */
-simdjson::dom::element FuturesClientCoin::v_pos_adl_quantile_est(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_pos_adl_quantile_est(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/adlQuantile" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/adlQuantile", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6916,12 +7557,10 @@ simdjson::dom::element FuturesClientCoin::v_pos_adl_quantile_est(const Params* p
 /**
 	CRTP of get_user_comission_rate()
 */
-simdjson::dom::element FuturesClientCoin::v_get_user_comission_rate(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_user_comission_rate(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/commissionRate" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/commissionRate", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -6930,7 +7569,7 @@ simdjson::dom::element FuturesClientCoin::v_get_user_comission_rate(const Params
 /**
 	CRTP of api_quant_trading_rules() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientCoin::v_api_quant_trading_rules(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_api_quant_trading_rules(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -6940,7 +7579,7 @@ simdjson::dom::element FuturesClientCoin::v_api_quant_trading_rules(const Params
 /**
 	CRTP of get_blvt_kline_history() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientCoin::v_get_blvt_kline_history(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_blvt_kline_history(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -6950,7 +7589,7 @@ simdjson::dom::element FuturesClientCoin::v_get_blvt_kline_history(const Params*
 /**
 	CRTP of get_composite_index_symbol_info() - Does not exist for Coin
 */
-simdjson::dom::element FuturesClientCoin::v_get_composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_get_composite_index_symbol_info(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -6981,7 +7620,7 @@ std::string FuturesClientCoin::v__get_listen_key()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/listenKey";
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return std::string(response["listenKey"].get_string().value());
 }
@@ -6989,27 +7628,36 @@ std::string FuturesClientCoin::v__get_listen_key()
 /**
 	CRTP of v_ping_listen_key()
 */
-simdjson::dom::element FuturesClientCoin::v__ping_listen_key()
+RestResponse FuturesClientCoin::v__ping_listen_key()
 {
 	// no signature is needed here
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/listenKey";
 
-	simdjson::dom::element response = (this->_rest_client)->_putreq(full_path);
+	RestResponse response = (this->_rest_client)->_putreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of v_ping_listen_key_request()
+*/
+RestRequest FuturesClientCoin::v__ping_listen_key_request()
+{
+	// no signature is needed here
+	return this->_build_request(RestRequestType::put_request, !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/listenKey", nullptr);
+}
+
 /**
 	CRTP of v_revoke_listen_key()
 */
-simdjson::dom::element FuturesClientCoin::v__revoke_listen_key()
+RestResponse FuturesClientCoin::v__revoke_listen_key()
 {
 	// no signature is needed here
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
 	full_path += "/dapi/v1/listenKey";
 
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
@@ -7022,31 +7670,27 @@ simdjson::dom::element FuturesClientCoin::v__revoke_listen_key()
 /**
 	CRTP of mark_price()
 */
-simdjson::dom::element FuturesClientCoin::v_mark_price(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_mark_price(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/premiumIndex" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/premiumIndex", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of open_interest()
 */
-simdjson::dom::element FuturesClientCoin::v_open_interest(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_open_interest(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/openInterest" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/openInterest", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of composite_index_symbol_info() - Missing endpoint for Coin margined
 */
-simdjson::dom::element FuturesClientCoin::v_composite_index_symbol_info(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_composite_index_symbol_info(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7059,36 +7703,30 @@ simdjson::dom::element FuturesClientCoin::v_composite_index_symbol_info(const Pa
 /**
 	CRTP of continues_klines() - Unique for Coin Margined client
 */
-simdjson::dom::element FuturesClientCoin::v_continues_klines(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_continues_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/continuousKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/continuousKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of index_klines() - Unique for Coin Margined client
 */
-simdjson::dom::element FuturesClientCoin::v_index_klines(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_index_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/indexPriceKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/indexPriceKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of mark_klines() - Unique for Coin Margined client
 */
-simdjson::dom::element FuturesClientCoin::v_mark_klines(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_mark_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET;
-	full_path += ("/dapi/v1/markPriceKlines" + query);
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_FUTURES_COIN : _BASE_REST_FUTURES_TESTNET, "/dapi/v1/markPriceKlines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -7099,7 +7737,7 @@ simdjson::dom::element FuturesClientCoin::v_mark_klines(const Params* params_ptr
 /**
 	CRTP of funding_rate_history() - Missing endpoint for this client
 */
-simdjson::dom::element FuturesClientCoin::v_funding_rate_history(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_funding_rate_history(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7109,7 +7747,7 @@ simdjson::dom::element FuturesClientCoin::v_funding_rate_history(const Params* p
 /**
 	CRTP of change_multiasset_margin_mode() - Missing endpoint for this client
 */
-simdjson::dom::element FuturesClientCoin::v_change_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_change_multiasset_margin_mode(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7119,7 +7757,7 @@ simdjson::dom::element FuturesClientCoin::v_change_multiasset_margin_mode(const
 /**
 	CRTP of check_multiasset_margin_mode() - Missing endpoint for this client
 */
-simdjson::dom::element FuturesClientCoin::v_check_multiasset_margin_mode(const Params* params_ptr)
+RestResponse FuturesClientCoin::v_check_multiasset_margin_mode(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7201,7 +7839,7 @@ std::string OpsClient::v_get_listen_key()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += "/vapi/v1/userDataStream";
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return std::string(response["listenKey"].get_string().value());
 }
@@ -7211,25 +7849,34 @@ std::string OpsClient::v_get_listen_key()
 	@param listen_key - the listen_key
 	@return json returned by the request
 */
-simdjson::dom::element OpsClient::v_ping_listen_key(const std::string& listen_key)
+RestResponse OpsClient::v_ping_listen_key(const std::string& listen_key)
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += ("/vapi/v1/userDataStream?listenKey=" + listen_key);
-	simdjson::dom::element response = listen_key.empty() ? (this->_rest_client)->_putreq(full_path) : (this->_rest_client)->_postreq(full_path);
+	RestResponse response = listen_key.empty() ? (this->_rest_client)->_putreq(full_path) : (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of ping_listen_key_request()
+*/
+RestRequest OpsClient::v_ping_listen_key_request(const std::string& listen_key)
+{
+	std::string endpoint = "/vapi/v1/userDataStream?listenKey=" + listen_key;
+	return this->_build_request(listen_key.empty() ? RestRequestType::put_request : RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, endpoint, nullptr);
+}
+
 /**
 	Revoke a ListenKey
 	@param listen_key - the listen_key
 	@return json returned by the request
 */
-simdjson::dom::element OpsClient::v_revoke_listen_key(const std::string& listen_key)
+RestResponse OpsClient::v_revoke_listen_key(const std::string& listen_key)
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += ("/vapi/v1/userDataStream?listenKey=" + listen_key);
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
@@ -7245,7 +7892,7 @@ bool OpsClient::v_ping_client()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += "/vapi/v1/ping";
-	simdjson::dom::element ping_response = (this->_rest_client)->_getreq(full_path);
+	RestResponse ping_response = (this->_rest_client)->_getreq(full_path);
 	return (ping_response .is_null());
 }
 
@@ -7256,55 +7903,50 @@ unsigned long long OpsClient::v_exchange_time()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += "/vapi/v1/time";
-	std::string ex_time = std::string((this->_rest_client)->_getreq(full_path)["serverTime"].get_string().value());
+	uint64_t server_time{ 0 };
+	if ((this->_rest_client)->_getreq(full_path)["serverTime"].get_uint64().get(server_time)) server_time = 0; // serverTime is a number
 
-	return std::atoll(ex_time.c_str());
+	return server_time;
 }
 
 /**
 	CRTP of exchange_info()
 */
-simdjson::dom::element OpsClient::v_exchange_info()
+RestResponse OpsClient::v_exchange_info()
 {
 	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
 	full_path += "/vapi/v1/exchangeInfo";
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of public_trades_recent()
 */
-simdjson::dom::element OpsClient::v_get_ticker(const Params* params_ptr)
+RestResponse OpsClient::v_get_ticker(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/ticker" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/ticker", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 
 */
-simdjson::dom::element OpsClient::get_spot_index_price(const Params* params_ptr)
+RestResponse OpsClient::get_spot_index_price(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/index" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/index", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 
 */
-simdjson::dom::element OpsClient::get_mark_price(const Params* params_ptr)
+RestResponse OpsClient::get_mark_price(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/mark" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/mark", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
@@ -7313,105 +7955,103 @@ simdjson::dom::element OpsClient::get_mark_price(const Params* params_ptr)
 /**
 	CRTP of order_book()
 */
-simdjson::dom::element OpsClient::v_order_book(const Params* params_ptr)
+RestResponse OpsClient::v_order_book(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/depth" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/depth", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of order_book_request()
+*/
+RestRequest OpsClient::v_order_book_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/depth", params_ptr);
+}
+
 /**
 	CRTP of klines()
 */
-simdjson::dom::element OpsClient::v_klines(const Params* params_ptr)
+RestResponse OpsClient::v_klines(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/klines" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/klines", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
+/**
+	CRTP of klines_request()
+*/
+RestRequest OpsClient::v_klines_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/klines", params_ptr);
+}
+
 /**
 	CRTP of public_trades_recent()
 */
-simdjson::dom::element OpsClient::v_public_trades_recent(const Params* params_ptr)
+RestResponse OpsClient::v_public_trades_recent(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/trades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/trades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 	CRTP of public_trades_historical()
 */
-simdjson::dom::element OpsClient::v_public_trades_historical(const Params* params_ptr)
+RestResponse OpsClient::v_public_trades_historical(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/historicalTrades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/historicalTrades", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 
 /**
 
 */
-simdjson::dom::element OpsClient::funds_transfer(const Params* params_ptr)
+RestResponse OpsClient::funds_transfer(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/transfer" + query;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/transfer", params_ptr);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 	return response;
 }
 
 /**
 
 */
-simdjson::dom::element OpsClient::holding_info(const Params* params_ptr)
+RestResponse OpsClient::holding_info(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/position" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/position", params_ptr);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 	return response;
 }
 /**
 
 */
-simdjson::dom::element OpsClient::account_funding_flow(const Params* params_ptr)
+RestResponse OpsClient::account_funding_flow(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/bill" + query;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/bill", params_ptr);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 	return response;
 }
 /**
 
 */
-simdjson::dom::element OpsClient::batch_orders(const Params* params_ptr)
+RestResponse OpsClient::batch_orders(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/batchOrders" + query;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/batchOrders", params_ptr);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 	return response;
 }
 /**
 
 */
-simdjson::dom::element OpsClient::cancel_batch_orders(const Params* params_ptr)
+RestResponse OpsClient::cancel_batch_orders(const Params* params_ptr)
 {
-	std::string query = params_ptr ? this->_generate_query(params_ptr) : "";
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/batchOrders" + query;
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/batchOrders", params_ptr);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 	return response;
 }
 //  ------------------------------ End | OpsClient CRTP methods - Market Data Implementations
@@ -7426,12 +8066,10 @@ simdjson::dom::element OpsClient::cancel_batch_orders(const Params* params_ptr)
 /**
 	CRTP of account_info()
 */
-simdjson::dom::element OpsClient::v_account_info(const Params* params_ptr)
+RestResponse OpsClient::v_account_info(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/account" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/account", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -7440,90 +8078,124 @@ simdjson::dom::element OpsClient::v_account_info(const Params* params_ptr)
 /**
 	CRTP of test_new_order()
 */
-simdjson::dom::element OpsClient::v_test_new_order(const Params* params_ptr)
+RestResponse OpsClient::v_test_new_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/order" + query;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of test_new_order_request()
+*/
+RestRequest OpsClient::v_test_new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of new_order()
 */
-simdjson::dom::element OpsClient::v_new_order(const Params* params_ptr)
+RestResponse OpsClient::v_new_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/order" + query;
-	simdjson::dom::element response = (this->_rest_client)->_postreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_postreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of new_order_request()
+*/
+RestRequest OpsClient::v_new_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::post_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_order()
 */
-simdjson::dom::element OpsClient::v_cancel_order(const Params* params_ptr)
+RestResponse OpsClient::v_cancel_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/order" + query;
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of cancel_order_request()
+*/
+RestRequest OpsClient::v_cancel_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of cancel_all_orders()
 */
-simdjson::dom::element OpsClient::v_cancel_all_orders(const Params* params_ptr)
+RestResponse OpsClient::v_cancel_all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/allOpenOrders" + query;
-	simdjson::dom::element response = (this->_rest_client)->_deletereq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/allOpenOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_deletereq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of cancel_all_orders_request()
+*/
+RestRequest OpsClient::v_cancel_all_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::delete_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/allOpenOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of query_order()
 */
-simdjson::dom::element OpsClient::v_query_order(const Params* params_ptr)
+RestResponse OpsClient::v_query_order(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += " /vapi/v1/order" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of query_order_request()
+*/
+RestRequest OpsClient::v_query_order_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/order", params_ptr, 1);
+}
+
 /**
 	CRTP of open_orders()
 */
-simdjson::dom::element OpsClient::v_open_orders(const Params* params_ptr)
+RestResponse OpsClient::v_open_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/openOrders" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/openOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
 
+/**
+	CRTP of open_orders_request()
+*/
+RestRequest OpsClient::v_open_orders_request(const Params* params_ptr)
+{
+	return this->_build_request(RestRequestType::get_request, !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/openOrders", params_ptr, 1);
+}
+
 /**
 	CRTP of all_orders()
 */
-simdjson::dom::element OpsClient::v_all_orders(const Params* params_ptr)
+RestResponse OpsClient::v_all_orders(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/historyOrders" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/historyOrders", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -7531,12 +8203,10 @@ simdjson::dom::element OpsClient::v_all_orders(const Params* params_ptr)
 /**
 	CRTP of account_trades_list()
 */
-simdjson::dom::element OpsClient::v_account_trades_list(const Params* params_ptr)
+RestResponse OpsClient::v_account_trades_list(const Params* params_ptr)
 {
-	std::string query = this->_generate_query(params_ptr, 1);
-	std::string full_path = !this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET;
-	full_path += "/vapi/v1/userTrades" + query;
-	simdjson::dom::element response = (this->_rest_client)->_getreq(full_path);
+	const std::string& full_path = this->_generate_path(!this->_testnet_mode ? _BASE_REST_OPS : _BASE_REST_OPS_TESTNET, "/vapi/v1/userTrades", params_ptr, 1);
+	RestResponse response = (this->_rest_client)->_getreq(full_path);
 
 	return response;
 }
@@ -7544,7 +8214,7 @@ simdjson::dom::element OpsClient::v_account_trades_list(const Params* params_ptr
 /**
 	CRTP of public_trades_agg()
 */
-simdjson::dom::element OpsClient::v_public_trades_agg(const Params* params_ptr)
+RestResponse OpsClient::v_public_trades_agg(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7554,7 +8224,7 @@ simdjson::dom::element OpsClient::v_public_trades_agg(const Params* params_ptr)
 /**
 	CRTP of get_order_book_ticker()
 */
-simdjson::dom::element OpsClient::v_get_order_book_ticker(const Params* params_ptr)
+RestResponse OpsClient::v_get_order_book_ticker(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7563,7 +8233,7 @@ simdjson::dom::element OpsClient::v_get_order_book_ticker(const Params* params_p
 /**
 	CRTP of daily_ticker_stats()
 */
-simdjson::dom::element OpsClient::v_daily_ticker_stats(const Params* params_ptr)
+RestResponse OpsClient::v_daily_ticker_stats(const Params* params_ptr)
 {
 	MissingEndpoint e{};
 	e.append_to_traceback(std::string(__FUNCTION__));
@@ -7598,27 +8268,25 @@ simdjson::dom::element OpsClient::v_daily_ticker_stats(const Params* params_ptr)
 	Default constructor
 */
 Params::Params()
-	: default_recv{ 0 }, default_recv_amt{ 0 }
+	: default_recv{ 0 }, default_recv_amt{ 0 }, _size{ 0 }
 {};
 
 /**
 	Copy constructor
 */
 Params::Params(Params& params_obj)
+	: Params()
 {
-	this->param_map = params_obj.param_map;
-	this->default_recv = params_obj.default_recv;
-	this->default_recv_amt = params_obj.default_recv_amt;
+	*this = static_cast<const Params&>(params_obj);
 }
 
 /**
 	Copy constructor (constant)
 */
 Params::Params(const Params& params_obj)
+	: Params()
 {
-	this->param_map = params_obj.param_map;
-	this->default_recv = params_obj.default_recv;
-	this->default_recv_amt = params_obj.default_recv_amt;
+	*this = params_obj;
 }
 
 /**
@@ -7626,19 +8294,22 @@ Params::Params(const Params& params_obj)
 */
 Params& Params::operator=(Params& params_obj)
 {
-	this->param_map = params_obj.param_map;
-	this->default_recv = params_obj.default_recv;
-	this->default_recv_amt = params_obj.default_recv_amt;
-
-	return *this;
+	return *this = static_cast<const Params&>(params_obj);
 }
 
 /**
 	Copy assignment (constant)
+	slots of this object are reused
 */
 Params& Params::operator=(const Params& params_obj)
 {
-	this->param_map = params_obj.param_map;
+	if (this == &params_obj) return *this;
+
+	this->_size = 0;
+	for (const Param& param : params_obj)
+	{
+		this->_value_slot(param.key).assign(param.value);
+	}
 	this->default_recv = params_obj.default_recv;
 	this->default_recv_amt = params_obj.default_recv_amt;
 
@@ -7650,79 +8321,84 @@ Params& Params::operator=(const Params& params_obj)
 */
 Params& Params::operator=(Params&& params_obj)
 {
-	this->param_map = std::move(params_obj.param_map);
-	this->default_recv = std::move(params_obj.default_recv);
-	this->default_recv_amt = std::move(params_obj.default_recv_amt);
+	this->_params = std::move(params_obj._params);
+	this->_size = params_obj._size;
+	this->default_recv = params_obj.default_recv;
+	this->default_recv_amt = params_obj.default_recv_amt;
+	params_obj._size = 0;
 
 	return *this;
 }
 
 /**
-	Set a new parameter
-	@typename PT - Type of value
+	Find the slot of a key, or take a new slot for it
 	@param key - name of parameter
-	@param value - value of parameter to set
+	@return the value of the slot, to be written to
 */
-template <typename PT>
-void Params::set_param(const std::string& key, const PT& value)
+std::string& Params::_value_slot(const std::string& key)
 {
-	param_map[key] = std::to_string(value);
-}
+	for (size_t i = 0; i < this->_size; i++)
+	{
+		if (this->_params[i].key == key) return this->_params[i].value;
+	}
 
-/**
-	Set a new parameter - type of value = std::string
-	@param key - name of parameter
-	@param value - value of parameter to set
-*/
-template <> // do not call to_string on a string
-void Params::set_param<std::string>(const std::string& key, const std::string& value)
-{
-	param_map[key] = value;
-}
+	if (this->_size == this->_params.size()) this->_params.emplace_back();
+	Param& param = this->_params[this->_size++];
+	param.key.assign(key);
 
-/**
-	Set a new parameter
-	@typename PT - Type of value
-	@param key - name of parameter
-	@param value - value of parameter to set (Move)
-*/
-template <typename PT>
-void Params::set_param(const std::string& key, PT&& value)
-{
-	param_map[key] = std::to_string(std::move(value));
+	return param.value;
 }
 
 /**
-	Set a new parameter - type of value = std::string
+	Set a new parameter - a floating point number with a fixed number of decimals
+	i.e: the precision of the tick size of a symbol for prices, or of the step size for quantities
 	@param key - name of parameter
-	@param value - value of parameter to set (Move)
+	@param value - value of parameter to set (rounded to the precision)
+	@param precision - number of decimals
 */
-template <>
-void Params::set_param<std::string>(const std::string& key, std::string&& value)
+void Params::set_param(const std::string& key, const double value, const unsigned int precision)
 {
-	param_map[key] = std::move(value);
+	char number_buffer[64];
+	std::to_chars_result result = std::to_chars(number_buffer, number_buffer + sizeof(number_buffer), value, std::chars_format::fixed, precision);
+	if (result.ec != std::errc{}) result = std::to_chars(number_buffer, number_buffer + sizeof(number_buffer), value); // out of the fixed range
+
+	this->_value_slot(key).assign(number_buffer, result.ptr - number_buffer);
 }
 
 /**
 	Delete a parameter
+	the order of the remaining params is kept
 	@param key - name of parameter
 	@return - bool for success
 */
 bool Params::delete_param(const std::string& key)
 {
-	std::unordered_map<std::string, std::string>::iterator itr;
-
-	for (itr = this->param_map.begin(); itr != this->param_map.end(); itr++)
+	for (size_t i = 0; i < this->_size; i++)
 	{
-		if (itr->first == key)
+		if (this->_params[i].key == key)
 		{
-			this->param_map.erase(itr);
+			std::rotate(this->_params.begin() + i, this->_params.begin() + i + 1, this->_params.begin() + this->_size); // the slot is kept for reuse
+			this->_size--;
 			return 1;
 		}
 	}
 	return 0;
 }
 
+/**
+	Get the value of a parameter
+	@param key - name of parameter
+	@return - a pointer to the encoded value, nullptr if not set
+*/
+const std::string* Params::get_param(const std::string& key) const
+{
+	for (const Param& param : *this)
+	{
+		if (param.key == key) return &param.value;
+	}
+	return nullptr;
+}
+
 /**
 	Set a default RecvWindow value
 	@param set_always - a bool for whether to keep after flush
@@ -7746,11 +8422,12 @@ void Params::set_recv(const bool& set_always, const unsigned int& recv_val)
 
 /**
 	Flush params - erase all keys
+	slots are kept, so setting params again does not allocate memory
 	if default recvWindow is set, it will be kept
 */
 void Params::flush_params()
 {
-	this->param_map.clear();
+	this->_size = 0;
 	if(this->default_recv)
 	{
 		this->set_param<unsigned int>("recvWindow", this->default_recv_amt);
@@ -7760,83 +8437,408 @@ void Params::flush_params()
 
 //  ------------------------------ End | Params methods
 
+
+//  ------------------------------ Start | QueryBuilder methods
+
+/**
+	Constructor
+	@param reserve_size - initial size of the buffer, grows if needed and is kept between requests
+*/
+QueryBuilder::QueryBuilder(const size_t reserve_size)
+	: _buffer{}, _query_start{ std::string::npos }
+{
+	this->_buffer.reserve(reserve_size);
+}
+
+/**
+	Start a new path - the buffer keeps its size
+	@param base - base URL of the request path (may be empty)
+	@param endpoint - endpoint of the request path (may be empty)
+*/
+void QueryBuilder::reset(std::string_view base, std::string_view endpoint)
+{
+	this->_buffer.clear();
+	this->_buffer.append(base).append(endpoint);
+	this->_query_start = std::string::npos;
+}
+
+/**
+	Append a parameter to the query
+	@param key - the key
+	@param value - the value (already encoded)
+*/
+void QueryBuilder::append_param(std::string_view key, std::string_view value)
+{
+	if (this->_query_start == std::string::npos)
+	{
+		this->_query_start = this->_buffer.size();
+		this->_buffer.push_back('?');
+	}
+	else
+	{
+		this->_buffer.push_back('&');
+	}
+	this->_buffer.append(key).append(1, '=').append(value);
+}
+
+/**
+	Append all parameters of a Params object to the query
+	@param params_ptr - a pointer to the request Params object (may be null)
+*/
+void QueryBuilder::append_params(const Params* params_ptr)
+{
+	if (!params_ptr) return;
+
+	for (const Params::Param& param : *params_ptr)
+	{
+		this->append_param(param.key, param.value);
+	}
+}
+
+/**
+	Append a timestamp parameter to the query
+	@param timestamp - epoch timestamp in ms
+*/
+void QueryBuilder::append_timestamp(const unsigned long long timestamp)
+{
+	char timestamp_buffer[20];
+	std::to_chars_result result = std::to_chars(timestamp_buffer, timestamp_buffer + sizeof(timestamp_buffer), timestamp);
+
+	this->append_param("timestamp", std::string_view{ timestamp_buffer, static_cast<size_t>(result.ptr - timestamp_buffer) });
+}
+
+/**
+	Sign the query and append the signature - must be the last parameter
+	@param signer - the signer of the client
+*/
+void QueryBuilder::sign(const HMACSigner& signer)
+{
+	char signature[HMACSigner::SIGNATURE_SIZE];
+	std::string_view query = this->query();
+	signer.sign(query.empty() ? query : query.substr(1), signature);
+
+	this->append_param("signature", std::string_view{ signature, HMACSigner::SIGNATURE_SIZE });
+}
+
+//  ------------------------------ End | QueryBuilder methods
+
+//  ------------------------------ Start | OrderTemplate methods
+
+/**
+	Constructor - called by the 'order_template()' of the exchange clients
+	@param rest_client - the REST session of the client
+	@param signer - the signer of the client
+	@param order_path - base + endpoint of the new order request
+	@param static_params - the params sent with every order (symbol, side, type, timeInForce...)
+	@param price_precision - number of decimals of prices
+	@param quantity_precision - number of decimals of quantities
+	@param clock - the clock of the timestamps, nullptr for the system clock
+*/
+OrderTemplate::OrderTemplate(RestSession* rest_client, const HMACSigner& signer, std::string_view order_path, const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision, const ExchangeClock* clock)
+	: _rest_client{ rest_client },
+	_path_prefix{ OrderTemplate::_serialize_prefix(order_path, static_params) },
+	_query_start{ order_path.size() + 1 },
+	_signer{ signer, std::string_view{ this->_path_prefix }.substr(order_path.size() + 1) },
+	_price_precision{ price_precision },
+	_quantity_precision{ quantity_precision },
+	_clock{ clock }
+{}
+
+/**
+	Serialize the path of the template, up to the per-order params
+	@param order_path - base + endpoint of the new order request
+	@param static_params - the params sent with every order
+	@return base + endpoint + '?' + static query
+*/
+std::string OrderTemplate::_serialize_prefix(std::string_view order_path, const Params& static_params)
+{
+	if (static_params.empty())
+	{
+		BadQuery e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+
+	QueryBuilder query_builder{ 256 };
+	query_builder.reset(order_path, "");
+	query_builder.append_params(&static_params);
+
+	return query_builder.str();
+}
+
+/**
+	Send an order
+	@param price - the price, already encoded (empty to omit, i.e: market orders)
+	@param quantity - the quantity, already encoded (empty to omit)
+	@param client_order_id - newClientOrderId (empty to omit)
+	@return json returned by the request
+*/
+RestResponse OrderTemplate::send(std::string_view price, std::string_view quantity, std::string_view client_order_id) const
+{
+	static thread_local std::string full_path = std::string(1024, '\0'); // the capacity is kept between orders
+
+	try
+	{
+		full_path.assign(this->_path_prefix);
+		size_t tail_start = full_path.size();
+
+		if (!price.empty()) full_path.append("&price=").append(price);
+		if (!quantity.empty()) full_path.append("&quantity=").append(quantity);
+		if (!client_order_id.empty()) full_path.append("&newClientOrderId=").append(client_order_id);
+
+		char timestamp_buffer[20];
+		std::to_chars_result result = std::to_chars(timestamp_buffer, timestamp_buffer + sizeof(timestamp_buffer), this->_clock ? this->_clock->timestamp() : local_timestamp());
+		full_path.append("&timestamp=").append(timestamp_buffer, result.ptr - timestamp_buffer);
+
+		char signature[HMACSigner::SIGNATURE_SIZE];
+		this->_signer.sign(std::string_view{ full_path }.substr(tail_start), signature); // the static query is already hashed
+		full_path.append("&signature=").append(signature, HMACSigner::SIGNATURE_SIZE);
+
+		return this->_rest_client->_postreq(full_path);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Send an order
+	@param price - the price, rounded to the price precision (0 to omit, i.e: market orders)
+	@param quantity - the quantity, rounded to the quantity precision
+	@param client_order_id - newClientOrderId (empty to omit)
+	@return json returned by the request
+*/
+RestResponse OrderTemplate::send(const double price, const double quantity, std::string_view client_order_id) const
+{
+	try
+	{
+		char price_buffer[64];
+		char quantity_buffer[64];
+		std::to_chars_result price_result{ price_buffer, std::errc{} };
+
+		if (price)
+		{
+			price_result = std::to_chars(price_buffer, price_buffer + sizeof(price_buffer), price, std::chars_format::fixed, this->_price_precision);
+			if (price_result.ec != std::errc{}) price_result = std::to_chars(price_buffer, price_buffer + sizeof(price_buffer), price); // out of the fixed range
+		}
+		std::to_chars_result quantity_result = std::to_chars(quantity_buffer, quantity_buffer + sizeof(quantity_buffer), quantity, std::chars_format::fixed, this->_quantity_precision);
+		if (quantity_result.ec != std::errc{}) quantity_result = std::to_chars(quantity_buffer, quantity_buffer + sizeof(quantity_buffer), quantity);
+
+		return this->send(std::string_view{ price_buffer, static_cast<size_t>(price_result.ptr - price_buffer) },
+			std::string_view{ quantity_buffer, static_cast<size_t>(quantity_result.ptr - quantity_buffer) },
+			client_order_id);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+/**
+	Send an order
+	@param price - the price, rescaled to the price precision (0 to omit, i.e: market orders)
+	@param quantity - the quantity, rescaled to the quantity precision
+	@param client_order_id - newClientOrderId (empty to omit)
+	@return json returned by the request - throws BadQuery if a value does not fit 18 digits at its precision
+*/
+RestResponse OrderTemplate::send(const Decimal& price, const Decimal& quantity, std::string_view client_order_id) const
+{
+	try
+	{
+		Decimal scaled_price{};
+		Decimal scaled_quantity{};
+		if (!price.rescale(this->_price_precision, scaled_price) || !quantity.rescale(this->_quantity_precision, scaled_quantity)) // more than 18 digits at the precision
+		{
+			BadQuery e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		char price_buffer[Decimal::MAX_FORMAT_SIZE];
+		char quantity_buffer[Decimal::MAX_FORMAT_SIZE];
+		const size_t price_size = price.is_zero() ? 0 : scaled_price.format(price_buffer);
+		const size_t quantity_size = scaled_quantity.format(quantity_buffer);
+
+		return this->send(std::string_view{ price_buffer, price_size }, std::string_view{ quantity_buffer, quantity_size }, client_order_id);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
+
+//  ------------------------------ End | OrderTemplate methods
+
+//  ------------------------------ Start | BatchResponse methods
+
+/**
+	Constructor
+	@param order_count - the number of orders of the batch - all are not placed until a response is added
+*/
+BatchResponse::BatchResponse(const size_t order_count)
+	: _responses{}, _results(order_count, BatchOrderResult{ 0, 0, std::string{}, simdjson::dom::element{} })
+{}
+
+/**
+	Map the response of a chunk to its orders - items of the array of the response are in the order of the chunk
+	an error object instead of an array (i.e: -1021) is the result of every order of the chunk
+	@param response - the response of the batchOrders request
+	@param order_indices - the indices of the orders of the chunk, in the input
+	@param order_count - the number of orders of the chunk
+*/
+void BatchResponse::add_response(RestResponse&& response, const size_t* order_indices, const size_t order_count)
+{
+	this->_responses.push_back(std::move(response));
+	const RestResponse& chunk_response = this->_responses.back();
+
+	simdjson::dom::array items;
+	const bool is_array = !chunk_response.get().get_array().get(items);
+	simdjson::dom::array::iterator item_it = is_array ? items.begin() : simdjson::dom::array::iterator{};
+
+	for (size_t chunk_index = 0; chunk_index < order_count; chunk_index++)
+	{
+		BatchOrderResult& result = this->_results[order_indices[chunk_index]];
+		if (is_array && item_it == items.end())
+		{
+			result.error = "missing_in_response";
+			continue;
+		}
+
+		result.order = is_array ? *item_it : chunk_response.get();
+		if (is_array) ++item_it;
+
+		int64_t code{ 0 };
+		std::string_view message{};
+		if (!result.order["code"].get_int64().get(code) && code) // error items have a code and msg, and no orderId
+		{
+			result.code = code;
+			if (!result.order["msg"].get_string().get(message)) result.error = std::string{ message };
+			continue;
+		}
+		result.placed = result.order.is_object();
+		if (!result.placed) result.error = "bad_response";
+	}
+}
+
+/**
+	Set an order as not placed
+	@param order_index - the index of the order, in the input
+	@param error - the reason
+*/
+void BatchResponse::set_error(const size_t order_index, std::string error)
+{
+	BatchOrderResult& result = this->_results[order_index];
+	result.placed = 0;
+	result.error = std::move(error);
+}
+
+/**
+	@param order_index - the index of the order, in the input
+	@return the result of the order
+*/
+const BatchOrderResult& BatchResponse::operator[](const size_t order_index) const
+{
+	return this->_results[order_index];
+}
+
+/**
+	@return the number of orders of the batch
+*/
+size_t BatchResponse::size() const
+{
+	return this->_results.size();
+}
+
+/**
+	@return the number of orders accepted by the exchange
+*/
+size_t BatchResponse::placed_count() const
+{
+	size_t placed_count{ 0 };
+	for (const BatchOrderResult& result : this->_results) placed_count += result.placed;
+	return placed_count;
+}
+
+//  ------------------------------ End | BatchResponse methods
+
 //  ------------------------------ Start | Explicit template instantiations
 
 template class Client<SpotClient>;
 
 template class Client<FuturesClient<FuturesClientUSDT>>;
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_position_mode(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::change_position_mode(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::batch_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::cancel_batch_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::cancel_all_orders_timer(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::query_open_order(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::account_balances(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::change_leverage(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::change_margin_type(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::change_position_margin(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::change_position_margin_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::position_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_income_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_leverage_bracket(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::users_force_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::pos_adl_quantile_est(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_user_comission_rate(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::api_quant_trading_rules(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_blvt_kline_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::get_composite_index_symbol_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::mark_price(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::open_interest(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::composite_index_symbol_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::continues_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::index_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::mark_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::funding_rate_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::open_interest_stats(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::top_long_short_ratio(const Params* params_ptr, bool accounts);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::global_long_short_ratio(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientUSDT>::taker_long_short_ratio(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_position_mode(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::change_position_mode(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::batch_orders(const Params* params_ptr);
+template RestRequest FuturesClient<FuturesClientUSDT>::batch_orders_request(const Params* params_ptr);
+template BatchResponse FuturesClient<FuturesClientUSDT>::batch_new_orders(const std::vector<Params>& orders, const Params* batch_params);
+template OrderTemplate FuturesClient<FuturesClientUSDT>::order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision);
+template RestResponse FuturesClient<FuturesClientUSDT>::cancel_batch_orders(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::cancel_all_orders_timer(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::query_open_order(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::account_balances(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::change_leverage(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::change_margin_type(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::change_position_margin(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::change_position_margin_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::position_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_income_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_leverage_bracket(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::users_force_orders(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::pos_adl_quantile_est(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_user_comission_rate(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::api_quant_trading_rules(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_blvt_kline_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::get_composite_index_symbol_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::mark_price(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::open_interest(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::composite_index_symbol_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::continues_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::index_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::mark_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::funding_rate_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::open_interest_stats(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::top_long_short_ratio(const Params* params_ptr, bool accounts);
+template RestResponse FuturesClient<FuturesClientUSDT>::global_long_short_ratio(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientUSDT>::taker_long_short_ratio(const Params* params_ptr);
 
 template class Client<FuturesClient<FuturesClientCoin>>;
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_position_mode(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::change_position_mode(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::batch_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::cancel_batch_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::cancel_all_orders_timer(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::query_open_order(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::account_balances(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::change_leverage(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::change_margin_type(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::change_position_margin(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::change_position_margin_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::position_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_income_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_leverage_bracket(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::users_force_orders(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::pos_adl_quantile_est(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_user_comission_rate(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::api_quant_trading_rules(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_blvt_kline_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::get_composite_index_symbol_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::mark_price(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::open_interest(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::composite_index_symbol_info(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::continues_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::index_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::mark_klines(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::funding_rate_history(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::open_interest_stats(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::top_long_short_ratio(const Params* params_ptr, bool accounts);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::global_long_short_ratio(const Params* params_ptr);
-template simdjson::dom::element FuturesClient<FuturesClientCoin>::taker_long_short_ratio(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_position_mode(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::change_position_mode(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::batch_orders(const Params* params_ptr);
+template RestRequest FuturesClient<FuturesClientCoin>::batch_orders_request(const Params* params_ptr);
+template BatchResponse FuturesClient<FuturesClientCoin>::batch_new_orders(const std::vector<Params>& orders, const Params* batch_params);
+template OrderTemplate FuturesClient<FuturesClientCoin>::order_template(const Params& static_params, const unsigned int price_precision, const unsigned int quantity_precision);
+template RestResponse FuturesClient<FuturesClientCoin>::cancel_batch_orders(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::cancel_all_orders_timer(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::query_open_order(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::account_balances(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::change_leverage(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::change_margin_type(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::change_position_margin(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::change_position_margin_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::position_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_income_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_leverage_bracket(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::users_force_orders(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::pos_adl_quantile_est(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_user_comission_rate(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::api_quant_trading_rules(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_blvt_kline_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::get_composite_index_symbol_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::mark_price(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::open_interest(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::composite_index_symbol_info(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::continues_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::index_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::mark_klines(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::funding_rate_history(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::open_interest_stats(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::top_long_short_ratio(const Params* params_ptr, bool accounts);
+template RestResponse FuturesClient<FuturesClientCoin>::global_long_short_ratio(const Params* params_ptr);
+template RestResponse FuturesClient<FuturesClientCoin>::taker_long_short_ratio(const Params* params_ptr);
 
 template class Client<OpsClient>;
-
-template void Params::set_param<int>(const std::string& key, const int& value);
-template void Params::set_param<float>(const std::string& key, const float& value);
-template void Params::set_param<double>(const std::string& key, const double& value);
-
-template void Params::set_param<int>(const std::string& key, int&& value);
-template void Params::set_param<float>(const std::string& key, float&& value);
-template void Params::set_param<double>(const std::string& key, double&& value);
-
@@ -0,0 +1,223 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | Decimal methods
+
+const int64_t Decimal::_POWERS_OF_10[19] = { 1LL, 10LL, 100LL, 1000LL, 10000LL, 100000LL, 1000000LL, 10000000LL, 100000000LL, 1000000000LL,
+	10000000000LL, 100000000000LL, 1000000000000LL, 10000000000000LL, 100000000000000LL, 1000000000000000LL,
+	10000000000000000LL, 100000000000000000LL, 1000000000000000000LL };
+
+/**
+	Parse a decimal string (i.e: "27100.10000000") - the scale is the number of decimals of the string,
+	so values of one stream share a scale. trailing zeros are dropped only if needed to fit 18 digits
+	@param text - the string, an optional '-', digits and an optional '.' followed by digits
+	@param value - the value to set
+	@return a bool for whether the string was parsed
+*/
+bool Decimal::parse(std::string_view text, Decimal& value)
+{
+	const char* position = text.data();
+	const char* end = position + text.size();
+
+	const bool negative = (position != end && *position == '-');
+	if (negative) position++;
+
+	const char* integer_start = position;
+	while (position != end && *position >= '0' && *position <= '9') position++;
+	const char* integer_end = position;
+
+	const char* fraction_start = position;
+	const char* fraction_end = position;
+	if (position != end && *position == '.')
+	{
+		fraction_start = ++position;
+		while (position != end && *position >= '0' && *position <= '9') position++;
+		fraction_end = position;
+	}
+	if (position != end || (integer_start == integer_end && fraction_start == fraction_end)) return 0;
+
+	while (integer_start != integer_end && *integer_start == '0') integer_start++; // leading zeros
+	const size_t integer_digits = integer_end - integer_start;
+	if (integer_digits > MAX_SCALE) return 0;
+
+	if (integer_digits + (fraction_end - fraction_start) > MAX_SCALE)
+	{
+		while (fraction_end != fraction_start && *(fraction_end - 1) == '0') fraction_end--; // no information lost
+		if (integer_digits + (fraction_end - fraction_start) > MAX_SCALE) fraction_end = fraction_start + (MAX_SCALE - integer_digits); // truncated
+	}
+
+	int64_t units{ 0 };
+	for (const char* digit = integer_start; digit != integer_end; digit++)
+	{
+		units = units * 10 + (*digit - '0');
+	}
+	for (const char* digit = fraction_start; digit != fraction_end; digit++)
+	{
+		units = units * 10 + (*digit - '0');
+	}
+
+	value._units = negative ? -units : units;
+	value._scale = static_cast<unsigned char>(fraction_end - fraction_start);
+	return 1;
+}
+
+/**
+	Parse a decimal string to a scale (i.e: the scale of the tick size of the symbol)
+	@param text - the string
+	@param scale - number of decimals, up to MAX_SCALE - extra decimals are rounded (half away from zero)
+	@param value - the value to set
+	@return a bool for whether the string was parsed, and fits 18 digits at the scale
+*/
+bool Decimal::parse(std::string_view text, const unsigned int scale, Decimal& value)
+{
+	Decimal parsed_value{};
+	if (!Decimal::parse(text, parsed_value)) return 0;
+
+	return parsed_value.rescale(scale, value);
+}
+
+/**
+	Convert a double, rounded to a scale
+	@param value - the value
+	@param scale - number of decimals - clamped to MAX_SCALE
+	@return the decimal - saturated if the value does not fit at the scale, 0 for NaN
+*/
+Decimal Decimal::from_double(const double value, const unsigned int scale)
+{
+	const unsigned int decimal_scale = scale > MAX_SCALE ? MAX_SCALE : scale;
+
+	Decimal decimal{};
+	if (Decimal::from_double(value, decimal_scale, decimal) || std::isnan(value)) return decimal;
+	return Decimal{ value < 0 ? -INT64_MAX : INT64_MAX, decimal_scale };
+}
+
+/**
+	Convert a double, rounded to a scale
+	@param value - the value
+	@param scale - number of decimals, up to MAX_SCALE
+	@param decimal - the decimal to set
+	@return a bool for whether the value is finite and fits 18 digits at the scale
+*/
+bool Decimal::from_double(const double value, const unsigned int scale, Decimal& decimal)
+{
+	if (scale > MAX_SCALE) return 0;
+
+	const double scaled_value = value * Decimal::_POWERS_OF_10[scale];
+	if (!(scaled_value > -9.2e18 && scaled_value < 9.2e18)) return 0; // also NaN - llround is undefined out of range
+
+	decimal = Decimal{ std::llround(scaled_value), scale };
+	return 1;
+}
+
+/**
+	The scale of a tick size or step size of exchangeInfo (i.e: "0.01000000" -> 2, "1.00000000" -> 0)
+	@param step - the tick size or step size
+	@return the number of decimals, up to the last non-zero decimal
+*/
+unsigned int Decimal::scale_of(std::string_view step)
+{
+	const size_t point = step.find('.');
+	if (point == std::string_view::npos) return 0;
+
+	const size_t last_digit = step.find_last_not_of('0');
+	return last_digit == std::string_view::npos || last_digit <= point ? 0 : static_cast<unsigned int>(last_digit - point);
+}
+
+/**
+	Convert to another scale
+	@param scale - number of decimals - clamped to MAX_SCALE
+	@return the value, rounded (half away from zero) if the scale is lower - saturated if it does not fit 18 digits at the scale
+*/
+Decimal Decimal::rescale(const unsigned int scale) const
+{
+	const unsigned int target_scale = scale > MAX_SCALE ? MAX_SCALE : scale;
+
+	Decimal value{};
+	if (this->rescale(target_scale, value)) return value;
+	return Decimal{ this->_units < 0 ? -INT64_MAX : INT64_MAX, target_scale };
+}
+
+/**
+	Convert to another scale
+	@param scale - number of decimals, up to MAX_SCALE
+	@param value - the value to set (may be this value)
+	@return a bool for whether the value fits 18 digits at the scale - rounded (half away from zero) if the scale is lower
+*/
+bool Decimal::rescale(const unsigned int scale, Decimal& value) const
+{
+	if (scale > MAX_SCALE) return 0;
+
+	if (scale >= this->_scale)
+	{
+		const int64_t multiplier = Decimal::_POWERS_OF_10[scale - this->_scale];
+		if (this->_units > INT64_MAX / multiplier || this->_units < -(INT64_MAX / multiplier)) return 0;
+
+		value = Decimal{ this->_units * multiplier, scale };
+		return 1;
+	}
+
+	const int64_t divisor = Decimal::_POWERS_OF_10[this->_scale - scale];
+	const int64_t remainder = this->_units % divisor;
+	int64_t units = this->_units / divisor;
+	if (remainder * 2 >= divisor) units++;
+	else if (remainder * 2 <= -divisor) units--;
+
+	value = Decimal{ units, scale };
+	return 1;
+}
+
+/**
+	@return the nearest double
+*/
+double Decimal::to_double() const
+{
+	return static_cast<double>(this->_units) / Decimal::_POWERS_OF_10[this->_scale];
+}
+
+/**
+	Write the value with all decimals of its scale (i.e: "27100.10")
+	@param buffer - at least MAX_FORMAT_SIZE chars
+	@return the number of chars written (not null terminated)
+*/
+size_t Decimal::format(char* buffer) const
+{
+	char* position = buffer;
+	uint64_t units = static_cast<uint64_t>(this->_units);
+	if (this->_units < 0)
+	{
+		*position++ = '-';
+		units = 0 - units;
+	}
+
+	const uint64_t divisor = static_cast<uint64_t>(Decimal::_POWERS_OF_10[this->_scale]);
+	position = std::to_chars(position, buffer + MAX_FORMAT_SIZE, units / divisor).ptr;
+	if (!this->_scale) return position - buffer;
+
+	*position++ = '.';
+	uint64_t fraction = units % divisor;
+	for (unsigned int digit = this->_scale; digit > 0; digit--)
+	{
+		position[digit - 1] = static_cast<char>('0' + fraction % 10);
+		fraction /= 10;
+	}
+	return (position + this->_scale) - buffer;
+}
+
+/**
+	@return the value with all decimals of its scale
+*/
+std::string Decimal::to_string() const
+{
+	char buffer[MAX_FORMAT_SIZE];
+	return std::string(buffer, this->format(buffer));
+}
+
+/**
+	Print the value with all decimals of its scale
+*/
+std::ostream& operator<<(std::ostream& out, const Decimal& value)
+{
+	char buffer[Decimal::MAX_FORMAT_SIZE];
+	return out.write(buffer, value.format(buffer));
+}
+
+//  ------------------------------ End | Decimal methods
@@ -0,0 +1,85 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | ExchangeClock methods
+
+/**
+	Constructor
+	@param window - number of last samples the offset is chosen from
+*/
+ExchangeClock::ExchangeClock(const size_t window)
+	: _system_base{ std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count() },
+	_steady_base{ std::chrono::steady_clock::now() }, _offset{ 0 }, _round_trip{ -1 }, _sample_count{ 0 },
+	_samples(std::max<size_t>(window, 1), ClockSample{ 0, INT64_MAX }), _next_sample{ 0 }
+{}
+
+/**
+	Get the local time - does not follow changes of the system clock after the clock is constructed
+	@return microseconds since epoch
+*/
+int64_t ExchangeClock::local_time() const
+{
+	return this->_system_base + std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->_steady_base).count();
+}
+
+/**
+	Get the estimated time of the exchange - the local time until the first sample
+	@return milliseconds since epoch, for the timestamp of signed requests
+*/
+unsigned long long ExchangeClock::timestamp() const
+{
+	return static_cast<unsigned long long>((this->local_time() + this->_offset.load(std::memory_order_relaxed)) / 1000);
+}
+
+/**
+	Add a sample of the exchange time - the offset is updated to the sample of least round trip of the window
+	@param request_start - local time before the request was sent ('local_time()')
+	@param server_time - the time of the exchange, in milliseconds (serverTime)
+	@param request_end - local time after the response was received
+*/
+void ExchangeClock::add_sample(const int64_t request_start, const unsigned long long server_time, const int64_t request_end)
+{
+	if (request_end < request_start) return;
+
+	const int64_t round_trip = request_end - request_start;
+	const int64_t offset = static_cast<int64_t>(server_time) * 1000 + 500 - (request_start + round_trip / 2); // serverTime is truncated to the millisecond
+
+	std::lock_guard<std::mutex> samples_guard(this->_samples_lock);
+	this->_samples[this->_next_sample] = ClockSample{ offset, round_trip };
+	this->_next_sample = (this->_next_sample + 1) % this->_samples.size();
+
+	const ClockSample* best_sample = &this->_samples.front();
+	for (const ClockSample& sample : this->_samples)
+	{
+		if (sample.round_trip < best_sample->round_trip) best_sample = &sample;
+	}
+
+	this->_offset.store(best_sample->offset, std::memory_order_relaxed);
+	this->_round_trip.store(best_sample->round_trip, std::memory_order_relaxed);
+	this->_sample_count++;
+}
+
+/**
+	@return the estimated offset of the exchange clock from the local time, in microseconds
+*/
+int64_t ExchangeClock::offset() const
+{
+	return this->_offset.load(std::memory_order_relaxed);
+}
+
+/**
+	@return the round trip of the sample of the offset, in microseconds (the error is at most half of it) - -1 before the first sample
+*/
+int64_t ExchangeClock::round_trip() const
+{
+	return this->_round_trip.load(std::memory_order_relaxed);
+}
+
+/**
+	@return the number of samples added
+*/
+unsigned int ExchangeClock::sample_count() const
+{
+	return this->_sample_count;
+}
+
+//  ------------------------------ End | ExchangeClock methods
@@ -0,0 +1,822 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | SymbolTable methods
+
+/**
+	Constructor - an empty table
+*/
+SymbolTable::SymbolTable()
+	: _slots(8)
+{}
+
+/**
+	Read the symbols of an exchangeInfo response (spot and futures)
+	@param exchange_info - the response of 'exchange_info()'
+	@param rows - the vector to fill, the names are views into the response - symbols whose filters do not fit 18 digits are skipped
+	@return a bool for whether the response holds a symbols array - false for error responses
+*/
+bool SymbolTable::read_symbols(const RestResponse& exchange_info, SymbolRows& rows)
+{
+	simdjson::dom::array symbols;
+	rows.clear();
+	if (exchange_info.empty() || exchange_info["symbols"].get_array().get(symbols)) return 0;
+
+	rows.reserve(symbols.size());
+	for (simdjson::dom::element symbol : symbols)
+	{
+		std::string_view symbol_name;
+		std::string_view status;
+		if (symbol["symbol"].get_string().get(symbol_name)) continue;
+		if (symbol["status"].get_string().get(status) && symbol["contractStatus"].get_string().get(status)) status = std::string_view{}; // contractStatus - COIN futures
+
+		SymbolFilters filters{};
+		filters.trading = (status == "TRADING");
+
+		simdjson::dom::array symbol_filters;
+		if (!symbol["filters"].get_array().get(symbol_filters))
+		{
+			for (simdjson::dom::element symbol_filter : symbol_filters)
+			{
+				simdjson::dom::object filter;
+				std::string_view filter_type;
+				if (symbol_filter.get_object().get(filter) || filter["filterType"].get_string().get(filter_type)) continue;
+
+				if (filter_type == "PRICE_FILTER")
+				{
+					SymbolTable::_read_value(filter, "minPrice", filters.min_price);
+					SymbolTable::_read_value(filter, "maxPrice", filters.max_price);
+					filters.price_scale = Decimal::scale_of(SymbolTable::_read_value(filter, "tickSize", filters.tick_size));
+				}
+				else if (filter_type == "LOT_SIZE")
+				{
+					SymbolTable::_read_value(filter, "minQty", filters.min_quantity);
+					SymbolTable::_read_value(filter, "maxQty", filters.max_quantity);
+					filters.quantity_scale = Decimal::scale_of(SymbolTable::_read_value(filter, "stepSize", filters.step_size));
+				}
+				else if (filter_type == "MIN_NOTIONAL" || filter_type == "NOTIONAL")
+				{
+					if (SymbolTable::_read_value(filter, "minNotional", filters.min_notional).empty()) SymbolTable::_read_value(filter, "notional", filters.min_notional); // futures
+				}
+				else if (filter_type == "PERCENT_PRICE_BY_SIDE")
+				{
+					SymbolTable::_read_value(filter, "bidMultiplierUp", filters.bid_multiplier_up);
+					SymbolTable::_read_value(filter, "bidMultiplierDown", filters.bid_multiplier_down);
+					SymbolTable::_read_value(filter, "askMultiplierUp", filters.ask_multiplier_up);
+					SymbolTable::_read_value(filter, "askMultiplierDown", filters.ask_multiplier_down);
+				}
+				else if (filter_type == "PERCENT_PRICE")
+				{
+					SymbolTable::_read_value(filter, "multiplierUp", filters.bid_multiplier_up);
+					SymbolTable::_read_value(filter, "multiplierDown", filters.ask_multiplier_down);
+					if (filter["multiplierDecimal"].error()) // spot - both bounds for both sides, futures - buys are bounded up and sells down
+					{
+						filters.ask_multiplier_up = filters.bid_multiplier_up;
+						filters.bid_multiplier_down = filters.ask_multiplier_down;
+					}
+				}
+			}
+		}
+
+		if (!filters.min_price.rescale(filters.price_scale, filters.min_price) ||
+			!filters.max_price.rescale(filters.price_scale, filters.max_price) ||
+			!filters.tick_size.rescale(filters.price_scale, filters.tick_size) ||
+			!filters.min_quantity.rescale(filters.quantity_scale, filters.min_quantity) ||
+			!filters.max_quantity.rescale(filters.quantity_scale, filters.max_quantity) ||
+			!filters.step_size.rescale(filters.quantity_scale, filters.step_size) ||
+			!filters.bid_multiplier_up.rescale(SymbolTable::MULTIPLIER_SCALE, filters.bid_multiplier_up) ||
+			!filters.bid_multiplier_down.rescale(SymbolTable::MULTIPLIER_SCALE, filters.bid_multiplier_down) ||
+			!filters.ask_multiplier_up.rescale(SymbolTable::MULTIPLIER_SCALE, filters.ask_multiplier_up) ||
+			!filters.ask_multiplier_down.rescale(SymbolTable::MULTIPLIER_SCALE, filters.ask_multiplier_down)) continue; // a scale above 18 digits - the symbol is skipped
+
+		rows.emplace_back(symbol_name, filters);
+	}
+	return 1;
+}
+
+/**
+	Read a decimal value of a filter
+	@param filter - the filter object
+	@param key - the key of the value (i.e: "tickSize")
+	@param value - the value to set, unchanged if the key is missing
+	@return the value as a string, empty if the key is missing
+*/
+std::string_view SymbolTable::_read_value(simdjson::dom::object filter, std::string_view key, Decimal& value)
+{
+	std::string_view text;
+	if (filter[key].get_string().get(text) || !Decimal::parse(text, value)) return std::string_view{};
+	return text;
+}
+
+/**
+	Check whether rows of a newer exchangeInfo would change the table
+	@param rows - the rows read by 'read_symbols()'
+	@return a bool for whether a symbol was added, removed or changed
+*/
+bool SymbolTable::differs(const SymbolRows& rows) const
+{
+	size_t trading_rows{ 0 };
+	for (const std::pair<std::string_view, SymbolFilters>& row : rows)
+	{
+		const uint32_t symbol_id = this->id(row.first);
+		if (symbol_id == SymbolTable::NOT_FOUND || !this->_equals(symbol_id, row.second)) return 1;
+		trading_rows += row.second.trading;
+	}
+
+	const size_t trading_symbols = std::count(this->_trading.begin(), this->_trading.end(), 1);
+	return trading_symbols != trading_rows; // a trading symbol was removed
+}
+
+/**
+	Update the table from the rows of a newer exchangeInfo - new symbols get new ids, removed symbols keep their id and are not trading
+	@param rows - the rows read by 'read_symbols()'
+*/
+void SymbolTable::assign(const SymbolRows& rows)
+{
+	std::vector<bool> listed_symbols(this->_names.size() + rows.size());
+	for (const std::pair<std::string_view, SymbolFilters>& row : rows)
+	{
+		const uint32_t symbol_id = this->_intern(row.first);
+		this->_set(symbol_id, row.second);
+		listed_symbols[symbol_id] = 1;
+	}
+
+	for (uint32_t symbol_id = 0; symbol_id < this->_names.size(); symbol_id++)
+	{
+		if (!listed_symbols[symbol_id]) this->_trading[symbol_id] = 0;
+	}
+}
+
+/**
+	@return the number of symbols (ids are 0 to size - 1)
+*/
+size_t SymbolTable::size() const
+{
+	return this->_names.size();
+}
+
+/**
+	Get the id of a symbol
+	@param symbol - the symbol, as in exchangeInfo (upper case)
+	@return the id, NOT_FOUND if the symbol is not in the table
+*/
+uint32_t SymbolTable::id(std::string_view symbol) const
+{
+	const Slot& slot = this->_slots[this->_find(symbol, SymbolTable::_hash(symbol))];
+	return slot.hash ? slot.id : SymbolTable::NOT_FOUND;
+}
+
+/**
+	@param id - the id of the symbol
+	@return the symbol
+*/
+const std::string& SymbolTable::name(const uint32_t id) const
+{
+	return this->_names[id];
+}
+
+/**
+	@param id - the id of the symbol
+	@return a bool for whether the symbol is trading
+*/
+bool SymbolTable::trading(const uint32_t id) const
+{
+	return this->_trading[id];
+}
+
+/**
+	@param id - the id of the symbol
+	@return the number of decimals of prices (of tickSize)
+*/
+unsigned int SymbolTable::price_scale(const uint32_t id) const
+{
+	return this->_price_scales[id];
+}
+
+/**
+	@param id - the id of the symbol
+	@return the number of decimals of quantities (of stepSize)
+*/
+unsigned int SymbolTable::quantity_scale(const uint32_t id) const
+{
+	return this->_quantity_scales[id];
+}
+
+/**
+	@param id - the id of the symbol
+	@return the tick size, at the price scale
+*/
+Decimal SymbolTable::tick_size(const uint32_t id) const
+{
+	return Decimal{ this->_tick_sizes[id], this->_price_scales[id] };
+}
+
+/**
+	@param id - the id of the symbol
+	@return the step size, at the quantity scale
+*/
+Decimal SymbolTable::step_size(const uint32_t id) const
+{
+	return Decimal{ this->_step_sizes[id], this->_quantity_scales[id] };
+}
+
+/**
+	@param id - the id of the symbol
+	@return all filters of the symbol
+*/
+SymbolFilters SymbolTable::filters(const uint32_t id) const
+{
+	const unsigned int price_scale = this->_price_scales[id];
+	const unsigned int quantity_scale = this->_quantity_scales[id];
+
+	return SymbolFilters{ static_cast<bool>(this->_trading[id]), price_scale, quantity_scale,
+		Decimal{ this->_min_prices[id], price_scale }, Decimal{ this->_max_prices[id], price_scale }, Decimal{ this->_tick_sizes[id], price_scale },
+		Decimal{ this->_min_quantities[id], quantity_scale }, Decimal{ this->_max_quantities[id], quantity_scale }, Decimal{ this->_step_sizes[id], quantity_scale },
+		Decimal{ this->_min_notionals[id], this->_notional_scales[id] },
+		Decimal{ this->_bid_multipliers_up[id], SymbolTable::MULTIPLIER_SCALE }, Decimal{ this->_bid_multipliers_down[id], SymbolTable::MULTIPLIER_SCALE },
+		Decimal{ this->_ask_multipliers_up[id], SymbolTable::MULTIPLIER_SCALE }, Decimal{ this->_ask_multipliers_down[id], SymbolTable::MULTIPLIER_SCALE } };
+}
+
+/**
+	Get the id of a symbol, or add it with empty filters
+	@param symbol - the symbol
+	@return the id
+*/
+uint32_t SymbolTable::_intern(std::string_view symbol)
+{
+	const uint64_t hash = SymbolTable::_hash(symbol);
+	size_t slot_index = this->_find(symbol, hash);
+	if (this->_slots[slot_index].hash) return this->_slots[slot_index].id;
+
+	if ((this->_names.size() + 1) * 2 > this->_slots.size())
+	{
+		this->_grow();
+		slot_index = this->_find(symbol, hash);
+	}
+
+	const uint32_t symbol_id = static_cast<uint32_t>(this->_names.size());
+	this->_slots[slot_index] = Slot{ hash, symbol_id };
+
+	this->_names.emplace_back(symbol);
+	this->_trading.push_back(0);
+	this->_price_scales.push_back(0);
+	this->_quantity_scales.push_back(0);
+	this->_notional_scales.push_back(0);
+	this->_min_prices.push_back(0);
+	this->_max_prices.push_back(0);
+	this->_tick_sizes.push_back(0);
+	this->_min_quantities.push_back(0);
+	this->_max_quantities.push_back(0);
+	this->_step_sizes.push_back(0);
+	this->_min_notionals.push_back(0);
+	this->_bid_multipliers_up.push_back(0);
+	this->_bid_multipliers_down.push_back(0);
+	this->_ask_multipliers_up.push_back(0);
+	this->_ask_multipliers_down.push_back(0);
+	return symbol_id;
+}
+
+/**
+	Set the filters of a symbol
+	@param id - the id of the symbol
+	@param filters - the filters, prices and quantities at their scales
+*/
+void SymbolTable::_set(const uint32_t id, const SymbolFilters& filters)
+{
+	this->_trading[id] = filters.trading;
+	this->_price_scales[id] = static_cast<unsigned char>(filters.price_scale);
+	this->_quantity_scales[id] = static_cast<unsigned char>(filters.quantity_scale);
+	this->_notional_scales[id] = static_cast<unsigned char>(filters.min_notional.scale());
+	this->_min_prices[id] = filters.min_price.units();
+	this->_max_prices[id] = filters.max_price.units();
+	this->_tick_sizes[id] = filters.tick_size.units();
+	this->_min_quantities[id] = filters.min_quantity.units();
+	this->_max_quantities[id] = filters.max_quantity.units();
+	this->_step_sizes[id] = filters.step_size.units();
+	this->_min_notionals[id] = filters.min_notional.units();
+	this->_bid_multipliers_up[id] = filters.bid_multiplier_up.units();
+	this->_bid_multipliers_down[id] = filters.bid_multiplier_down.units();
+	this->_ask_multipliers_up[id] = filters.ask_multiplier_up.units();
+	this->_ask_multipliers_down[id] = filters.ask_multiplier_down.units();
+}
+
+/**
+	Compare the filters of a symbol
+	@param id - the id of the symbol
+	@param filters - the filters, prices and quantities at their scales
+	@return a bool for whether all filters are the same
+*/
+bool SymbolTable::_equals(const uint32_t id, const SymbolFilters& filters) const
+{
+	return this->_trading[id] == filters.trading && this->_price_scales[id] == filters.price_scale && this->_quantity_scales[id] == filters.quantity_scale &&
+		this->_min_prices[id] == filters.min_price.units() && this->_max_prices[id] == filters.max_price.units() && this->_tick_sizes[id] == filters.tick_size.units() &&
+		this->_min_quantities[id] == filters.min_quantity.units() && this->_max_quantities[id] == filters.max_quantity.units() && this->_step_sizes[id] == filters.step_size.units() &&
+		Decimal{ this->_min_notionals[id], this->_notional_scales[id] } == filters.min_notional &&
+		this->_bid_multipliers_up[id] == filters.bid_multiplier_up.units() && this->_bid_multipliers_down[id] == filters.bid_multiplier_down.units() &&
+		this->_ask_multipliers_up[id] == filters.ask_multiplier_up.units() && this->_ask_multipliers_down[id] == filters.ask_multiplier_down.units();
+}
+
+/**
+	Hash a symbol - FNV-1a
+	@param symbol - the symbol
+	@return the hash, never 0 (marks empty slots)
+*/
+uint64_t SymbolTable::_hash(std::string_view symbol)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (const char c : symbol)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash ? hash : 1;
+}
+
+/**
+	Find the slot of a symbol
+	@param symbol - the symbol
+	@param hash - the hash of the symbol
+	@return the index of the slot of the symbol, or of the empty slot where it would be set
+*/
+size_t SymbolTable::_find(std::string_view symbol, const uint64_t hash) const
+{
+	const size_t mask = this->_slots.size() - 1;
+	size_t index = hash & mask;
+
+	while (this->_slots[index].hash)
+	{
+		if (this->_slots[index].hash == hash && this->_names[this->_slots[index].id] == symbol) break;
+		index = (index + 1) & mask;
+	}
+	return index;
+}
+
+/**
+	Double the number of slots, and set the symbols again
+*/
+void SymbolTable::_grow()
+{
+	std::vector<Slot> old_slots{ std::move(this->_slots) };
+	this->_slots.assign(old_slots.size() * 2, Slot{});
+
+	const size_t mask = this->_slots.size() - 1;
+	for (const Slot& old_slot : old_slots)
+	{
+		if (!old_slot.hash) continue;
+
+		size_t index = old_slot.hash & mask;
+		while (this->_slots[index].hash) index = (index + 1) & mask;
+		this->_slots[index] = old_slot;
+	}
+}
+
+//  ------------------------------ End | SymbolTable methods
+
+
+//  ------------------------------ Start | SymbolIndex methods
+
+/**
+	Constructor - an empty table
+*/
+SymbolIndex::SymbolIndex()
+	: _table{ std::make_shared<const SymbolTable>() }, _table_version{ 0 }
+{}
+
+/**
+	Replace the current table - readers holding the previous table keep it
+	@param table - the new table
+*/
+void SymbolIndex::_publish(std::shared_ptr<const SymbolTable> table)
+{
+	std::atomic_store(&this->_table, std::move(table));
+	this->_table_version++;
+}
+
+/**
+	Get the current table - hold it for repeated lookups, the ids of a table are valid in all later tables
+	@return the table, never null
+*/
+std::shared_ptr<const SymbolTable> SymbolIndex::table() const
+{
+	return std::atomic_load(&this->_table);
+}
+
+/**
+	Get the id of a symbol in the current table
+	@param symbol - the symbol (upper case)
+	@return the id, SymbolTable::NOT_FOUND if the symbol is not in the table
+*/
+uint32_t SymbolIndex::id(std::string_view symbol) const
+{
+	return this->table()->id(symbol);
+}
+
+/**
+	Get the filters of a symbol in the current table
+	@param symbol - the symbol (upper case)
+	@param filters - the filters to set
+	@return a bool for whether the symbol is in the table
+*/
+bool SymbolIndex::filters(std::string_view symbol, SymbolFilters& filters) const
+{
+	std::shared_ptr<const SymbolTable> current_table = this->table();
+	const uint32_t symbol_id = current_table->id(symbol);
+	if (symbol_id == SymbolTable::NOT_FOUND) return 0;
+
+	filters = current_table->filters(symbol_id);
+	return 1;
+}
+
+/**
+	@return the number of tables published - incremented by refreshes that changed a symbol
+*/
+unsigned int SymbolIndex::version() const
+{
+	return this->_table_version;
+}
+
+//  ------------------------------ End | SymbolIndex methods
+
+
+//  ------------------------------ Start | OrderValidator methods
+
+/**
+	Constructor
+	@param index - the index of the filters - must outlive the validator
+	@param policy - reject orders failing a filter, or round their prices and quantities first
+	@param max_symbols - number of symbol ids that may have a reference price
+*/
+OrderValidator::OrderValidator(const SymbolIndex& index, const OrderValidationPolicy policy, const size_t max_symbols)
+	: _index{ &index }, _policy{ policy }, _reference_prices{ new std::atomic<int64_t>[max_symbols]() }, _max_symbols{ max_symbols }
+{}
+
+/**
+	Destructor
+*/
+OrderValidator::~OrderValidator()
+{
+	delete[] this->_reference_prices;
+}
+
+/**
+	Set the reference price of PERCENT_PRICE - from any thread
+	@param symbol_id - the id of the symbol in the index
+	@param price - the weighted average price (spot) or mark price (futures), 0 to skip the filter - rounded to REFERENCE_SCALE decimals (skipped if it does not fit)
+*/
+void OrderValidator::set_reference_price(const uint32_t symbol_id, const Decimal& price)
+{
+	if (symbol_id >= this->_max_symbols) return;
+
+	Decimal reference_price{};
+	if (!price.rescale(OrderValidator::REFERENCE_SCALE, reference_price)) reference_price = Decimal{}; // does not fit - the filter is skipped
+	this->_reference_prices[symbol_id].store(reference_price.units(), std::memory_order_relaxed);
+}
+
+/**
+	Set the reference price of PERCENT_PRICE - from any thread
+	@param symbol - the symbol (upper case)
+	@param price - the weighted average price (spot) or mark price (futures), 0 to skip the filter
+	@return a bool for whether the symbol is in the index
+*/
+bool OrderValidator::set_reference_price(std::string_view symbol, const Decimal& price)
+{
+	const uint32_t symbol_id = this->_index->id(symbol);
+	if (symbol_id == SymbolTable::NOT_FOUND) return 0;
+
+	this->set_reference_price(symbol_id, price);
+	return 1;
+}
+
+/**
+	Check an order (new_order, test_new_order, oco_new_order) - with the normalize policy, its prices and quantity are rounded
+	orders are sent as they are if the index is not loaded yet, or the params have no symbol
+	@param params_ptr - a pointer to the request Params object
+	@return the params to send - a copy kept by the calling thread if the order was normalized
+	@throw OrderRejected - if the order fails a filter
+*/
+const Params* OrderValidator::validate_order(const Params* params_ptr) const
+{
+	static thread_local Params normalized_params{}; // its slots are kept between orders
+
+	std::shared_ptr<const SymbolTable> table = this->_index->table();
+	OrderFields order{};
+	if (!table->size() || !OrderValidator::_read_order(params_ptr, order)) return params_ptr;
+
+	const char* failed_filter = this->_check_order(*table, order);
+	if (failed_filter)
+	{
+		OrderRejected e{ failed_filter };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+	if (this->_policy == OrderValidationPolicy::reject) return params_ptr;
+
+	normalized_params = *params_ptr;
+	if (!order.price.is_zero()) normalized_params.set_param<Decimal>("price", order.price);
+	if (!order.stop_price.is_zero()) normalized_params.set_param<Decimal>("stopPrice", order.stop_price);
+	if (!order.stop_limit_price.is_zero()) normalized_params.set_param<Decimal>("stopLimitPrice", order.stop_limit_price);
+	if (!order.quantity.is_zero()) normalized_params.set_param<Decimal>("quantity", order.quantity);
+	return &normalized_params;
+}
+
+/**
+	Check the orders of batch_orders ('batchOrders' param, a json array of orders, url encoded or not) - with the normalize policy, their prices and quantities are rounded
+	@param params_ptr - a pointer to the request Params object
+	@return the params to send - a copy kept by the calling thread if the orders were normalized (the array is url encoded)
+	@throw OrderRejected - if an order fails a filter, or 'invalid_batch' if the array cannot be read (no order of the batch is sent)
+*/
+const Params* OrderValidator::validate_batch_orders(const Params* params_ptr) const
+{
+	static thread_local Params normalized_params{};
+	static thread_local simdjson::dom::parser batch_parser{};
+	static thread_local std::string decoded_batch{};
+	static thread_local std::string normalized_batch{};
+	static thread_local std::string encoded_batch{};
+
+	std::shared_ptr<const SymbolTable> table = this->_index->table();
+	const std::string* batch_orders = params_ptr ? params_ptr->get_param("batchOrders") : nullptr;
+	if (!table->size() || !batch_orders) return params_ptr; // a missing param is rejected by the exchange
+
+	url_decode(*batch_orders, decoded_batch); // sent url encoded (i.e: by 'batch_new_orders()'), or as raw json
+	simdjson::dom::array orders;
+	if (batch_parser.parse(decoded_batch).get_array().get(orders))
+	{
+		OrderRejected e{ "invalid_batch" };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+
+	const bool normalize = (this->_policy == OrderValidationPolicy::normalize);
+	normalized_batch.assign(1, '[');
+	for (simdjson::dom::element order_element : orders)
+	{
+		simdjson::dom::object order_object;
+		OrderFields order{};
+		if (order_element.get_object().get(order_object) || !OrderValidator::_read_order(order_object, order))
+		{
+			OrderRejected e{ "invalid_batch" };
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		const char* failed_filter = this->_check_order(*table, order);
+		if (failed_filter)
+		{
+			OrderRejected e{ failed_filter };
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+		if (!normalize) continue;
+
+		char number_buffer[Decimal::MAX_FORMAT_SIZE];
+		normalized_batch.append(normalized_batch.size() > 1 ? ",{" : "{");
+		for (simdjson::dom::key_value_pair field : order_object)
+		{
+			const Decimal* value = (field.key == "price") ? &order.price : (field.key == "stopPrice") ? &order.stop_price : (field.key == "quantity") ? &order.quantity : nullptr;
+
+			if (normalized_batch.back() != '{') normalized_batch.push_back(',');
+			normalized_batch.append(1, '"').append(field.key).append("\":");
+			if (value && !value->is_zero()) normalized_batch.append(1, '"').append(number_buffer, value->format(number_buffer)).append(1, '"');
+			else normalized_batch.append(simdjson::minify(field.value));
+		}
+		normalized_batch.push_back('}');
+	}
+	if (!normalize) return params_ptr;
+
+	normalized_batch.push_back(']');
+	encoded_batch.clear();
+	url_encode(normalized_batch, encoded_batch);
+
+	normalized_params = *params_ptr;
+	normalized_params.set_param<std::string>("batchOrders", encoded_batch);
+	return &normalized_params;
+}
+
+/**
+	Check an order against the filters of its symbol - with the normalize policy, its prices and quantity are rounded
+	@param table - the table of the filters
+	@param order - the fields of the order
+	@return the reason of the rejection, nullptr if the order passed
+*/
+const char* OrderValidator::_check_order(const SymbolTable& table, OrderFields& order) const
+{
+	const uint32_t symbol_id = table.id(order.symbol);
+	if (symbol_id == SymbolTable::NOT_FOUND) return "unknown_symbol";
+	if (!table.trading(symbol_id)) return "symbol_not_trading";
+
+	const SymbolFilters filters = table.filters(symbol_id);
+	const char* failed_filter = nullptr;
+
+	if (!order.price.is_zero()) failed_filter = this->_check_price(filters, order.buy, order.price);
+	if (!failed_filter && !order.stop_price.is_zero()) failed_filter = this->_check_price(filters, order.buy, order.stop_price);
+	if (!failed_filter && !order.stop_limit_price.is_zero()) failed_filter = this->_check_price(filters, order.buy, order.stop_limit_price);
+	if (!failed_filter && !order.quantity.is_zero()) failed_filter = this->_check_quantity(filters, order.quantity);
+	if (failed_filter) return failed_filter;
+
+	if (!order.quantity.is_zero() && !filters.min_notional.is_zero())
+	{
+		if (!order.price.is_zero())
+		{
+			if (OrderValidator::_below_notional(order.price, order.quantity, filters.min_notional)) return "min_notional";
+		}
+		else if (symbol_id < this->_max_symbols) // market orders - at the reference price, if set
+		{
+			const int64_t reference_units = this->_reference_prices[symbol_id].load(std::memory_order_relaxed);
+			if (reference_units > 0 && OrderValidator::_below_notional(Decimal{ reference_units, OrderValidator::REFERENCE_SCALE }, order.quantity, filters.min_notional)) return "min_notional";
+		}
+	}
+
+	if (!order.price.is_zero()) failed_filter = this->_check_percent_price(symbol_id, filters, order.buy, order.price);
+	if (!failed_filter && !order.stop_limit_price.is_zero()) failed_filter = this->_check_percent_price(symbol_id, filters, order.buy, order.stop_limit_price);
+	return failed_filter;
+}
+
+/**
+	PRICE_FILTER - (price - minPrice) % tickSize == 0, minPrice <= price <= maxPrice (0 for no bound)
+	@param filters - the filters of the symbol
+	@param buy - the side of the order - prices are normalized down for buys and up for sells
+	@param price - the price, set to the normalized price
+	@return the reason of the rejection, nullptr if the price passed
+*/
+const char* OrderValidator::_check_price(const SymbolFilters& filters, const bool buy, Decimal& price) const
+{
+	const bool normalize = (this->_policy == OrderValidationPolicy::normalize);
+
+	if (!filters.tick_size.is_zero())
+	{
+		Decimal scaled_price = OrderValidator::_round(price, filters.price_scale, !buy);
+		if (!normalize && scaled_price != price) return "price_filter"; // more decimals than the tick size
+
+		const int64_t tick = filters.tick_size.units();
+		const int64_t offset = ((scaled_price.units() - filters.min_price.units()) % tick + tick) % tick;
+		if (offset && !normalize) return "price_filter";
+		if (offset) scaled_price = Decimal{ buy ? scaled_price.units() - offset : scaled_price.units() + (tick - offset), filters.price_scale };
+
+		price = scaled_price;
+	}
+
+	if ((!filters.min_price.is_zero() && price < filters.min_price) || (!filters.max_price.is_zero() && price > filters.max_price)) return "price_filter";
+	return nullptr;
+}
+
+/**
+	LOT_SIZE - (quantity - minQty) % stepSize == 0, minQty <= quantity <= maxQty
+	@param filters - the filters of the symbol
+	@param quantity - the quantity, set to the normalized quantity (rounded down)
+	@return the reason of the rejection, nullptr if the quantity passed
+*/
+const char* OrderValidator::_check_quantity(const SymbolFilters& filters, Decimal& quantity) const
+{
+	const bool normalize = (this->_policy == OrderValidationPolicy::normalize);
+
+	if (!filters.step_size.is_zero())
+	{
+		Decimal scaled_quantity = OrderValidator::_round(quantity, filters.quantity_scale, 0);
+		if (!normalize && scaled_quantity != quantity) return "lot_size"; // more decimals than the step size
+
+		const int64_t step = filters.step_size.units();
+		const int64_t offset = ((scaled_quantity.units() - filters.min_quantity.units()) % step + step) % step;
+		if (offset && !normalize) return "lot_size";
+		if (offset) scaled_quantity = Decimal{ scaled_quantity.units() - offset, filters.quantity_scale };
+
+		quantity = scaled_quantity;
+	}
+
+	if ((!filters.min_quantity.is_zero() && quantity < filters.min_quantity) || (!filters.max_quantity.is_zero() && quantity > filters.max_quantity)) return "lot_size";
+	return nullptr;
+}
+
+/**
+	PERCENT_PRICE - the price must be within the multipliers of the reference price, if one was set - compared exactly
+	@param symbol_id - the id of the symbol
+	@param filters - the filters of the symbol
+	@param buy - the side of the order (bid or ask multipliers)
+	@param price - the price
+	@return the reason of the rejection, nullptr if the price passed
+*/
+const char* OrderValidator::_check_percent_price(const uint32_t symbol_id, const SymbolFilters& filters, const bool buy, const Decimal& price) const
+{
+	const int64_t reference_units = symbol_id < this->_max_symbols ? this->_reference_prices[symbol_id].load(std::memory_order_relaxed) : 0;
+	if (reference_units <= 0) return nullptr;
+
+	const Decimal& multiplier_up = buy ? filters.bid_multiplier_up : filters.ask_multiplier_up;
+	const Decimal& multiplier_down = buy ? filters.bid_multiplier_down : filters.ask_multiplier_down;
+
+#ifdef __SIZEOF_INT128__
+	const unsigned int bound_scale = OrderValidator::REFERENCE_SCALE + SymbolTable::MULTIPLIER_SCALE; // the multipliers are at MULTIPLIER_SCALE
+	if (!multiplier_up.is_zero() && OrderValidator::_compare_scaled(price.units(), price.scale(), static_cast<__int128>(reference_units) * multiplier_up.rescale(SymbolTable::MULTIPLIER_SCALE).units(), bound_scale) > 0) return "percent_price";
+	if (!multiplier_down.is_zero() && OrderValidator::_compare_scaled(price.units(), price.scale(), static_cast<__int128>(reference_units) * multiplier_down.rescale(SymbolTable::MULTIPLIER_SCALE).units(), bound_scale) < 0) return "percent_price";
+#else
+	const double reference_price = Decimal{ reference_units, OrderValidator::REFERENCE_SCALE }.to_double();
+	const double order_price = price.to_double();
+	if (!multiplier_up.is_zero() && order_price > reference_price * multiplier_up.to_double()) return "percent_price";
+	if (!multiplier_down.is_zero() && order_price < reference_price * multiplier_down.to_double()) return "percent_price";
+#endif
+	return nullptr;
+}
+
+/**
+	Read the fields of an order from its params
+	@param params_ptr - a pointer to the request Params object
+	@param order - the fields to set - values that are not set (or not numbers) are 0
+	@return a bool for whether the order has a symbol
+*/
+bool OrderValidator::_read_order(const Params* params_ptr, OrderFields& order)
+{
+	const std::string* symbol = params_ptr ? params_ptr->get_param("symbol") : nullptr;
+	if (!symbol) return 0;
+
+	const std::string* side = params_ptr->get_param("side");
+	const std::string* price = params_ptr->get_param("price");
+	const std::string* stop_price = params_ptr->get_param("stopPrice");
+	const std::string* stop_limit_price = params_ptr->get_param("stopLimitPrice");
+	const std::string* quantity = params_ptr->get_param("quantity");
+
+	order.symbol = *symbol;
+	order.buy = side && *side == "BUY";
+	if (price) Decimal::parse(*price, order.price);
+	if (stop_price) Decimal::parse(*stop_price, order.stop_price);
+	if (stop_limit_price) Decimal::parse(*stop_limit_price, order.stop_limit_price);
+	if (quantity) Decimal::parse(*quantity, order.quantity);
+	return 1;
+}
+
+/**
+	Read the fields of an order of batch_orders
+	@param order_object - the order, with string values
+	@param order - the fields to set - values that are not set (or not numbers) are 0
+	@return a bool for whether the order has a symbol
+*/
+bool OrderValidator::_read_order(simdjson::dom::object order_object, OrderFields& order)
+{
+	std::string_view side;
+	std::string_view value;
+	if (order_object["symbol"].get_string().get(order.symbol)) return 0;
+
+	order.buy = !order_object["side"].get_string().get(side) && side == "BUY";
+	if (!order_object["price"].get_string().get(value)) Decimal::parse(value, order.price);
+	if (!order_object["stopPrice"].get_string().get(value)) Decimal::parse(value, order.stop_price);
+	if (!order_object["quantity"].get_string().get(value)) Decimal::parse(value, order.quantity);
+	return 1;
+}
+
+/**
+	Round a value to a scale
+	@param value - the value
+	@param scale - number of decimals
+	@param up - round up if true, down if false
+	@return the rounded value
+*/
+Decimal OrderValidator::_round(const Decimal& value, const unsigned int scale, const bool up)
+{
+	Decimal rounded = value.rescale(scale); // half away from zero
+	if (up && rounded < value) rounded = Decimal{ rounded.units() + 1, scale };
+	else if (!up && rounded > value) rounded = Decimal{ rounded.units() - 1, scale };
+	return rounded;
+}
+
+/**
+	MIN_NOTIONAL - compare price * quantity with the minimum, exactly
+	@param price - the price
+	@param quantity - the quantity
+	@param min_notional - the minimum notional
+	@return a bool for whether price * quantity < min_notional
+*/
+bool OrderValidator::_below_notional(const Decimal& price, const Decimal& quantity, const Decimal& min_notional)
+{
+#ifdef __SIZEOF_INT128__
+	const __int128 notional = static_cast<__int128>(price.units()) * quantity.units(); // at the scale of price + quantity
+	return OrderValidator::_compare_scaled(notional, price.scale() + quantity.scale(), min_notional.units(), min_notional.scale()) < 0;
+#else
+	return price.to_double() * quantity.to_double() < min_notional.to_double();
+#endif
+}
+
+#ifdef __SIZEOF_INT128__
+/**
+	Compare two non negative fixed-point values of any scales, exactly
+	the value of lower scale is scaled up - if it would overflow, it is the greater one
+	@param left - units of the left value
+	@param left_scale - decimals of the left value
+	@param right - units of the right value
+	@param right_scale - decimals of the right value
+	@return -1, 0 or 1 if left is less than, equal to or greater than right
+*/
+int OrderValidator::_compare_scaled(__int128 left, unsigned int left_scale, __int128 right, unsigned int right_scale)
+{
+	const __int128 scale_limit = static_cast<__int128>(~static_cast<unsigned __int128>(0) >> 1) / 10;
+
+	for (; left_scale < right_scale; left_scale++)
+	{
+		if (left > scale_limit) return 1;
+		left *= 10;
+	}
+	for (; right_scale < left_scale; right_scale++)
+	{
+		if (right > scale_limit) return -1;
+		right *= 10;
+	}
+	return (left > right) - (left < right);
+}
+#endif
+
+//  ------------------------------ End | OrderValidator methods
@@ -0,0 +1,234 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | LatencyHistogram methods
+
+/**
+	Constructor
+*/
+LatencyHistogram::LatencyHistogram()
+{
+	this->reset();
+}
+
+/**
+	The bucket of a value - values below SUB_BUCKET_COUNT have their own bucket,
+	above it each power of 2 is split into SUB_BUCKET_COUNT buckets
+	@param value - the value, below 2^MAX_VALUE_BITS
+	@return the index of the bucket
+*/
+unsigned int LatencyHistogram::_bucket_of(const uint64_t value)
+{
+	if (value < SUB_BUCKET_COUNT) return static_cast<unsigned int>(value);
+
+	unsigned int msb = 0; // position of the highest set bit
+	for (unsigned int step = 32; step; step >>= 1)
+	{
+		if (value >> (msb + step)) msb += step;
+	}
+
+	const unsigned int shift = msb - SUB_BUCKET_BITS;
+	return (shift + 1) * SUB_BUCKET_COUNT + static_cast<unsigned int>((value >> shift) - SUB_BUCKET_COUNT);
+}
+
+/**
+	The highest value of a bucket
+	@param bucket - the index of the bucket
+	@return the value
+*/
+uint64_t LatencyHistogram::_highest_value_of(const unsigned int bucket)
+{
+	if (bucket < SUB_BUCKET_COUNT) return bucket;
+
+	const unsigned int shift = bucket / SUB_BUCKET_COUNT - 1;
+	const uint64_t sub_bucket = SUB_BUCKET_COUNT + bucket % SUB_BUCKET_COUNT;
+	return ((sub_bucket + 1) << shift) - 1;
+}
+
+/**
+	Record a value - from any thread
+	@param value - the value, clamped to 2^MAX_VALUE_BITS - 1
+*/
+void LatencyHistogram::record(const uint64_t value)
+{
+	const uint64_t clamped_value = std::min<uint64_t>(value, (uint64_t{ 1 } << MAX_VALUE_BITS) - 1);
+
+	this->_counts[LatencyHistogram::_bucket_of(clamped_value)].fetch_add(1, std::memory_order_relaxed);
+	this->_sum.fetch_add(clamped_value, std::memory_order_relaxed);
+
+	uint64_t current = this->_min.load(std::memory_order_relaxed);
+	while (clamped_value < current && !this->_min.compare_exchange_weak(current, clamped_value, std::memory_order_relaxed));
+	current = this->_max.load(std::memory_order_relaxed);
+	while (clamped_value > current && !this->_max.compare_exchange_weak(current, clamped_value, std::memory_order_relaxed));
+
+	this->_total.fetch_add(1, std::memory_order_release);
+}
+
+/**
+	Clear all values - values recorded during the reset may be partially kept
+*/
+void LatencyHistogram::reset()
+{
+	for (std::atomic<uint64_t>& count : this->_counts)
+	{
+		count.store(0, std::memory_order_relaxed);
+	}
+	this->_sum.store(0, std::memory_order_relaxed);
+	this->_min.store(UINT64_MAX, std::memory_order_relaxed);
+	this->_max.store(0, std::memory_order_relaxed);
+	this->_total.store(0, std::memory_order_release);
+}
+
+/**
+	@return the number of recorded values
+*/
+uint64_t LatencyHistogram::count() const
+{
+	return this->_total.load(std::memory_order_acquire);
+}
+
+/**
+	@return the lowest recorded value, 0 if none
+*/
+uint64_t LatencyHistogram::min() const
+{
+	const uint64_t min_value = this->_min.load(std::memory_order_relaxed);
+	return min_value == UINT64_MAX ? 0 : min_value;
+}
+
+/**
+	@return the highest recorded value, 0 if none
+*/
+uint64_t LatencyHistogram::max() const
+{
+	return this->_max.load(std::memory_order_relaxed);
+}
+
+/**
+	@return the mean of the recorded values, 0 if none
+*/
+double LatencyHistogram::mean() const
+{
+	const uint64_t total = this->count();
+	return total ? static_cast<double>(this->_sum.load(std::memory_order_relaxed)) / total : 0;
+}
+
+/**
+	The value below which a percentage of the recorded values are - the highest value of its bucket (at most 'max()')
+	@param percentile - the percentage, 0 to 100
+	@return the value, 0 if none
+*/
+uint64_t LatencyHistogram::percentile(const double percentile) const
+{
+	const uint64_t total = this->count();
+	if (!total) return 0;
+
+	const double clamped_percentile = std::min(std::max(percentile, 0.0), 100.0);
+	const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(clamped_percentile / 100 * total)));
+	const uint64_t max_value = this->max();
+
+	uint64_t cumulative = 0;
+	for (unsigned int bucket = 0; bucket < BUCKET_COUNT; bucket++)
+	{
+		cumulative += this->_counts[bucket].load(std::memory_order_relaxed);
+		if (cumulative >= target) return std::min(LatencyHistogram::_highest_value_of(bucket), max_value);
+	}
+	return max_value; // values recorded while counting
+}
+
+/**
+	@return the count, mean, percentiles (50, 90, 99, 99.9) and max
+*/
+LatencySnapshot LatencyHistogram::snapshot() const
+{
+	return LatencySnapshot{ this->count(), this->min(), this->mean(),
+		this->percentile(50), this->percentile(90), this->percentile(99), this->percentile(99.9), this->max() };
+}
+
+/**
+	@return the count, mean, percentiles (50, 90, 99, 99.9) and max, as text
+*/
+std::string LatencyHistogram::summary() const
+{
+	const LatencySnapshot snapshot = this->snapshot();
+	return "count=" + std::to_string(snapshot.count) +
+		" mean=" + std::to_string(static_cast<uint64_t>(snapshot.mean)) +
+		" p50=" + std::to_string(snapshot.p50) +
+		" p90=" + std::to_string(snapshot.p90) +
+		" p99=" + std::to_string(snapshot.p99) +
+		" p99.9=" + std::to_string(snapshot.p999) +
+		" max=" + std::to_string(snapshot.max);
+}
+
+//  ------------------------------ End | LatencyHistogram methods
+
+
+//  ------------------------------ Start | StreamLatency methods
+
+/**
+	Record the latency of a message from the exchange - right after it is read
+	the clock of the exchange may be ahead - negative latencies are recorded as 0
+	@param message - the message, messages without an event time are skipped
+*/
+void StreamLatency::record_receive(std::string_view message)
+{
+	const int64_t received_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	const uint64_t event_time = StreamLatency::event_time(message);
+	if (!event_time) return;
+
+	const int64_t latency = received_time - static_cast<int64_t>(event_time) * 1000;
+	this->exchange_to_receive.record(latency > 0 ? static_cast<uint64_t>(latency) : 0);
+}
+
+/**
+	Record the time from the read of a message to its callback, and the duration of the callback
+	@param received - after the message was read
+	@param callback_start - before the functor was called
+	@param callback_end - after the functor returned
+*/
+void StreamLatency::record_callback(const std::chrono::steady_clock::time_point received, const std::chrono::steady_clock::time_point callback_start,
+	const std::chrono::steady_clock::time_point callback_end)
+{
+	this->receive_to_callback.record(std::chrono::duration_cast<std::chrono::microseconds>(callback_start - received).count());
+	this->callback.record(std::chrono::duration_cast<std::chrono::microseconds>(callback_end - callback_start).count());
+}
+
+/**
+	Clear all histograms
+*/
+void StreamLatency::reset()
+{
+	this->exchange_to_receive.reset();
+	this->receive_to_callback.reset();
+	this->callback.reset();
+}
+
+/**
+	@return the summary of each histogram, one per line
+*/
+std::string StreamLatency::report() const
+{
+	return "exchange_to_receive_us: " + this->exchange_to_receive.summary() + "\n" +
+		"receive_to_callback_us: " + this->receive_to_callback.summary() + "\n" +
+		"callback_us: " + this->callback.summary() + "\n";
+}
+
+/**
+	Find the event time of a message without parsing it - the first "E" key, also inside the payload of a combined stream
+	@param message - the message
+	@return the event time in ms, 0 if none
+*/
+uint64_t StreamLatency::event_time(std::string_view message)
+{
+	const size_t key_pos = message.find("\"E\":");
+	if (key_pos == std::string_view::npos) return 0;
+
+	const char* first = message.data() + key_pos + 4;
+	const char* last = message.data() + message.size();
+	while (first != last && *first == ' ') first++;
+
+	uint64_t event_time = 0;
+	std::from_chars(first, last, event_time);
+	return event_time;
+}
+
+//  ------------------------------ End | StreamLatency methods
@@ -0,0 +1,297 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | BookSide methods
+
+/**
+	Constructor
+	@param bids - true for the bid side, false for the ask side
+*/
+BookSide::BookSide(const bool bids)
+	: _bids{ bids }
+{}
+
+/**
+	Set the quantity of a price level
+	@param price - the price of the level
+	@param quantity - the new quantity, 0 removes the level
+*/
+void BookSide::update(const Decimal& price, const Decimal& quantity)
+{
+	std::vector<PriceLevel>::iterator level_itr = this->_bids ?
+		std::lower_bound(this->_levels.begin(), this->_levels.end(), price, [](const PriceLevel& level, const Decimal& level_price) { return level.price < level_price; }) :
+		std::lower_bound(this->_levels.begin(), this->_levels.end(), price, [](const PriceLevel& level, const Decimal& level_price) { return level.price > level_price; });
+
+	if (level_itr != this->_levels.end() && level_itr->price == price) // exact
+	{
+		if (quantity.is_zero()) this->_levels.erase(level_itr);
+		else level_itr->quantity = quantity;
+	}
+	else if (!quantity.is_zero())
+	{
+		this->_levels.insert(level_itr, PriceLevel{ price, quantity });
+	}
+}
+
+/**
+	Replace all levels - used for snapshots, which are sorted best first
+	@param levels - the levels, in any order (levels with a quantity of 0 are skipped) - reordered
+*/
+void BookSide::assign(std::vector<PriceLevel>& levels)
+{
+	if (this->_bids) std::sort(levels.begin(), levels.end(), [](const PriceLevel& first, const PriceLevel& second) { return first.price < second.price; });
+	else std::sort(levels.begin(), levels.end(), [](const PriceLevel& first, const PriceLevel& second) { return first.price > second.price; });
+
+	this->_levels.clear();
+	for (const PriceLevel& level : levels)
+	{
+		if (!level.quantity.is_zero()) this->_levels.push_back(level);
+	}
+}
+
+/**
+	Remove all levels - the capacity is kept
+*/
+void BookSide::clear()
+{
+	this->_levels.clear();
+}
+
+/**
+	@return the number of levels
+*/
+size_t BookSide::size() const
+{
+	return this->_levels.size();
+}
+
+/**
+	@return the best level, zeros if the side is empty
+*/
+PriceLevel BookSide::best() const
+{
+	return this->_levels.empty() ? PriceLevel{} : this->_levels.back();
+}
+
+/**
+	Copy the best levels
+	@param depth - max number of levels
+	@param levels - the vector to fill, best level first
+*/
+void BookSide::top(const size_t depth, std::vector<PriceLevel>& levels) const
+{
+	levels.clear();
+	std::vector<PriceLevel>::const_reverse_iterator level_itr = this->_levels.rbegin();
+	for (size_t level_index = 0; level_index < depth && level_itr != this->_levels.rend(); level_index++, level_itr++)
+	{
+		levels.push_back(*level_itr);
+	}
+}
+
+//  ------------------------------ End | BookSide methods
+
+
+//  ------------------------------ Start | L2Book methods
+
+/**
+	Constructor
+	@param futures - true for the update ids of futures (U / u / pu), false for spot (U / u)
+*/
+L2Book::L2Book(const bool futures)
+	: _bids{ true }, _asks{ false }, _futures{ futures }, _last_update_id{ 0 }, _first_update{ 1 },
+	_sequence{ 0 }, _best_units{}, _best_scales{}, _update_id{ 0 }
+{}
+
+/**
+	Publish the best bid / ask (seqlock write) - called by the writing thread, under the book lock
+*/
+void L2Book::_publish()
+{
+	const PriceLevel best_bid = this->_bids.best();
+	const PriceLevel best_ask = this->_asks.best();
+
+	const uint64_t sequence = this->_sequence.load(std::memory_order_relaxed);
+	this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	const Decimal* best_values[4] = { &best_bid.price, &best_bid.quantity, &best_ask.price, &best_ask.quantity };
+	for (unsigned int value_index = 0; value_index < 4; value_index++)
+	{
+		this->_best_units[value_index].store(best_values[value_index]->units(), std::memory_order_relaxed);
+		this->_best_scales[value_index].store(best_values[value_index]->scale(), std::memory_order_relaxed);
+	}
+	this->_update_id.store(this->_last_update_id, std::memory_order_relaxed);
+
+	this->_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+/**
+	Read the levels of a snapshot side
+	@param levels - the array of [price, quantity] levels (as strings)
+	@param side - the side to fill
+	@return a bool for whether the levels were read
+*/
+bool L2Book::_load_levels(simdjson::dom::element levels, BookSide& side)
+{
+	simdjson::dom::array levels_array;
+	if (levels.get_array().get(levels_array)) return 0;
+
+	std::vector<PriceLevel> snapshot_levels{};
+	snapshot_levels.reserve(levels_array.size());
+	for (simdjson::dom::element level : levels_array)
+	{
+		std::string_view price;
+		std::string_view quantity;
+		if (level.at(0).get_string().get(price) || level.at(1).get_string().get(quantity)) return 0;
+
+		PriceLevel snapshot_level{};
+		if (!Decimal::parse(price, snapshot_level.price) || !Decimal::parse(quantity, snapshot_level.quantity)) return 0;
+		snapshot_levels.push_back(snapshot_level);
+	}
+
+	side.assign(snapshot_levels);
+	return 1;
+}
+
+/**
+	Replace the book with a depth snapshot ('order_book()')
+	@param snapshot - the response of the snapshot
+	@return a bool for whether the snapshot was loaded - false for error responses, the book is then empty
+*/
+bool L2Book::load_snapshot(const RestResponse& snapshot)
+{
+	uint64_t last_update_id;
+	simdjson::dom::element bids;
+	simdjson::dom::element asks;
+	const bool valid_snapshot = !snapshot.empty() &&
+		!snapshot["lastUpdateId"].get_uint64().get(last_update_id) && !snapshot["bids"].get(bids) && !snapshot["asks"].get(asks);
+
+	std::lock_guard<std::mutex> book_guard(this->_book_lock);
+	if (!valid_snapshot || !L2Book::_load_levels(bids, this->_bids) || !L2Book::_load_levels(asks, this->_asks))
+	{
+		this->_bids.clear();
+		this->_asks.clear();
+		this->_last_update_id = 0;
+		this->_publish();
+		return 0;
+	}
+
+	this->_last_update_id = last_update_id;
+	this->_first_update = 1;
+	this->_publish();
+	return 1;
+}
+
+/**
+	Apply a diff depth event, if it follows the book
+	spot: skipped if u <= the book id, a gap if U > the book id + 1
+	futures: the first event after the snapshot is skipped if u < the book id, a gap if U > the book id -
+	then each event is a gap if its pu != u of the previous event
+	@param depth_update - the event
+	@return whether the event was applied, skipped (stale) or not applied because of a gap
+*/
+BookUpdateResult L2Book::apply(const DepthUpdateEvent& depth_update)
+{
+	std::lock_guard<std::mutex> book_guard(this->_book_lock);
+
+	if (this->_futures && this->_first_update)
+	{
+		if (depth_update.final_update_id < this->_last_update_id) return BookUpdateResult::stale;
+		if (depth_update.first_update_id > this->_last_update_id) return BookUpdateResult::gap;
+	}
+	else if (this->_futures)
+	{
+		if (depth_update.final_update_id <= this->_last_update_id) return BookUpdateResult::stale;
+		if (depth_update.previous_final_update_id != this->_last_update_id) return BookUpdateResult::gap;
+	}
+	else
+	{
+		if (depth_update.final_update_id <= this->_last_update_id) return BookUpdateResult::stale;
+		if (depth_update.first_update_id > this->_last_update_id + 1) return BookUpdateResult::gap;
+	}
+
+	for (const PriceLevel& level : depth_update.bids)
+	{
+		this->_bids.update(level.price, level.quantity);
+	}
+	for (const PriceLevel& level : depth_update.asks)
+	{
+		this->_asks.update(level.price, level.quantity);
+	}
+
+	this->_last_update_id = depth_update.final_update_id;
+	this->_first_update = 0;
+	this->_publish();
+	return BookUpdateResult::applied;
+}
+
+/**
+	Remove all levels - a snapshot must be loaded before applying events again
+*/
+void L2Book::clear()
+{
+	std::lock_guard<std::mutex> book_guard(this->_book_lock);
+	this->_bids.clear();
+	this->_asks.clear();
+	this->_last_update_id = 0;
+	this->_first_update = 1;
+	this->_publish();
+}
+
+/**
+	Get the best bid and ask, without a lock (seqlock read) - from any thread
+	@return the best bid and ask of the same update
+*/
+BestBidAsk L2Book::best_bid_ask() const
+{
+	BestBidAsk best_bid_ask{};
+	uint64_t sequence_before;
+	uint64_t sequence_after;
+	do
+	{
+		sequence_before = this->_sequence.load(std::memory_order_acquire);
+
+		Decimal* best_values[4] = { &best_bid_ask.bid_price, &best_bid_ask.bid_quantity, &best_bid_ask.ask_price, &best_bid_ask.ask_quantity };
+		for (unsigned int value_index = 0; value_index < 4; value_index++)
+		{
+			*best_values[value_index] = Decimal{ this->_best_units[value_index].load(std::memory_order_relaxed), this->_best_scales[value_index].load(std::memory_order_relaxed) };
+		}
+		best_bid_ask.update_id = this->_update_id.load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		sequence_after = this->_sequence.load(std::memory_order_relaxed);
+	} while ((sequence_before & 1) || sequence_before != sequence_after); // written meanwhile
+
+	return best_bid_ask;
+}
+
+/**
+	Copy the best bids - from any thread (locks the book)
+	@param depth - max number of levels
+	@param levels - the vector to fill, best bid first
+*/
+void L2Book::bids(const size_t depth, std::vector<PriceLevel>& levels) const
+{
+	std::lock_guard<std::mutex> book_guard(this->_book_lock);
+	this->_bids.top(depth, levels);
+}
+
+/**
+	Copy the best asks - from any thread (locks the book)
+	@param depth - max number of levels
+	@param levels - the vector to fill, best ask first
+*/
+void L2Book::asks(const size_t depth, std::vector<PriceLevel>& levels) const
+{
+	std::lock_guard<std::mutex> book_guard(this->_book_lock);
+	this->_asks.top(depth, levels);
+}
+
+/**
+	@return the final update id of the last applied event (or of the snapshot)
+*/
+uint64_t L2Book::last_update_id() const
+{
+	return this->_update_id.load(std::memory_order_acquire);
+}
+
+//  ------------------------------ End | L2Book methods
@@ -4,6 +4,9 @@
 
 static long _IDLE_TIME_TCP = 120L;
 static long _INTVL_TIME_TCP = 60L;
+static int _EVENT_LOOP_POLL_MS = 1000; // max wait of the event loop when idle (woken up on new requests)
+static unsigned int _DEFAULT_RECV_WINDOW_MS = 5000; // of the exchange, for signed requests without a recvWindow param
+
 
 /**
 	Request callback method (REST)
@@ -20,12 +23,201 @@ unsigned int _REQ_CALLBACK(void* contents, unsigned int size, unsigned int nmemb
 	return size * nmemb;
 };
 
+/**
+	Header callback method (REST)
+	@param buffer - a header line (not null terminated)
+	@param size - always 1
+	@param nitems - length of the header line
+	@param req - RestSession object of the request
+	@return number of bytes handled
+*/
+size_t _HEADER_CALLBACK(char* buffer, size_t size, size_t nitems, RestSession::RequestHandler* req)
+{
+	req->session->_rate_limiter.update_from_header(std::string_view{ buffer, size * nitems });
+
+	return size * nitems;
+}
+
+/**
+	Lock callback for the shared DNS and TLS session caches
+	@param handle - the easy handle using the cache
+	@param data - the type of data being locked
+	@param access - shared / single access (ignored)
+	@param session - the RestSession object owning the cache
+*/
+void _SHARE_LOCK_CALLBACK(CURL* /*handle*/, curl_lock_data data, curl_lock_access /*access*/, void* session)
+{
+	static_cast<RestSession*>(session)->_share_locks[data].lock();
+}
+
+/**
+	Unlock callback for the shared DNS and TLS session caches
+	@param handle - the easy handle using the cache
+	@param data - the type of data being unlocked
+	@param session - the RestSession object owning the cache
+*/
+void _SHARE_UNLOCK_CALLBACK(CURL* /*handle*/, curl_lock_data data, void* session)
+{
+	static_cast<RestSession*>(session)->_share_locks[data].unlock();
+}
+
+/**
+	Constructor
+	@param template_handle - the handle from which new handles are duplicated
+	@param share_handle - the cache shared by the handles
+	@param max_size - max number of handles, 0 for unlimited
+*/
+CurlHandlePool::CurlHandlePool(CURL* template_handle, CURLSH* share_handle, const unsigned int max_size)
+	: _template_handle{ template_handle }, _share_handle{ share_handle }, _options_version{ 0 }, _max_size{ max_size }
+{}
+
+/**
+	Take a handle out of the pool
+	a new handle is duplicated from the template if none is idle,
+	unless the pool is at its max size - then waits for a handle to be returned
+	@return the handle - must be returned by 'checkin()'
+*/
+CURL* CurlHandlePool::checkout()
+{
+	std::unique_lock<std::mutex> pool_guard(this->_pool_lock);
+
+	this->_handle_returned.wait(pool_guard, [this]()
+		{
+			return !this->_idle_handles.empty() || !this->_max_size || this->_handles.size() < this->_max_size;
+		});
+
+	if (!this->_idle_handles.empty())
+	{
+		CURL* handle = this->_idle_handles.back();
+		this->_idle_handles.pop_back();
+		return this->_refresh_handle(handle);
+	}
+
+	CURL* handle = this->_duplicate_template();
+	this->_handles.push_back(handle);
+
+	return handle;
+}
+
+/**
+	Return a handle to the pool
+	the handle keeps its own connection alive - it is duplicated again (on a new connection) if options were set while it was checked out
+	@param handle - a handle taken by 'checkout()'
+*/
+void CurlHandlePool::checkin(CURL* handle)
+{
+	{
+		std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+		try
+		{
+			handle = this->_refresh_handle(handle);
+		}
+		catch (ClientException&) // the stale handle is kept
+		{}
+		this->_idle_handles.push_back(handle);
+	}
+	this->_handle_returned.notify_one();
+}
+
+/**
+	Duplicate a new handle from the template - '_pool_lock' must be held
+	@return the handle, at the current options version
+*/
+CURL* CurlHandlePool::_duplicate_template()
+{
+	CURL* handle = curl_easy_duphandle(this->_template_handle);
+	if (!handle)
+	{
+		BadSetupSessionREST e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+	curl_easy_setopt(handle, CURLOPT_SHARE, this->_share_handle);
+	this->_handle_versions[handle] = this->_options_version;
+
+	return handle;
+}
+
+/**
+	Replace a handle that missed options set while it was checked out - '_pool_lock' must be held
+	@param handle - a handle of the pool, not in use
+	@return the handle, or its replacement duplicated from the template
+*/
+CURL* CurlHandlePool::_refresh_handle(CURL* handle)
+{
+	if (this->_handle_versions[handle] == this->_options_version) return handle;
+
+	CURL* new_handle = this->_duplicate_template();
+	std::replace(this->_handles.begin(), this->_handles.end(), handle, new_handle);
+	this->_handle_versions.erase(handle);
+	curl_easy_cleanup(handle); // closes its connection
+
+	return new_handle;
+}
+
+/**
+	Get the number of handles created by the pool
+	@return the number of handles
+*/
+unsigned int CurlHandlePool::size()
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+	return this->_handles.size();
+}
+
+/**
+	Set the max number of handles of the pool
+	handles above a lowered max are kept, but no new handles are created until below it
+	@param max_size - the new max size, 0 for unlimited
+*/
+void CurlHandlePool::set_max_size(const unsigned int max_size)
+{
+	{
+		std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+		this->_max_size = max_size;
+	}
+	this->_handle_returned.notify_all();
+}
+
+/**
+	Cleanup all handles of the pool
+	the template handle is not owned by the pool and is not cleaned
+*/
+void CurlHandlePool::cleanup()
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+
+	for (CURL* handle : this->_handles)
+	{
+		curl_easy_cleanup(handle);
+	}
+	this->_handles.clear();
+	this->_idle_handles.clear();
+	this->_handle_versions.clear();
+}
+
+/**
+	Destructor
+*/
+CurlHandlePool::~CurlHandlePool()
+{
+	this->cleanup();
+}
+
 /**
 	Default Constructor
 	Set all CURL handles (GET, POST, PUT, DELETE)
 */
 RestSession::RestSession() // except handles in rest_init exchange client level
+	: _event_loop_id{ std::thread::id{} }, _event_loop_running{ 0 }, _http2_mode{ 0 }, _http2_multi_options{ 0 }
 {
+	_share_handle = curl_share_init();
+	curl_share_setopt(this->_share_handle, CURLSHOPT_LOCKFUNC, _SHARE_LOCK_CALLBACK);
+	curl_share_setopt(this->_share_handle, CURLSHOPT_UNLOCKFUNC, _SHARE_UNLOCK_CALLBACK);
+	curl_share_setopt(this->_share_handle, CURLSHOPT_USERDATA, this);
+	curl_share_setopt(this->_share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS); // not the connection cache - it must not be used by concurrent threads
+	curl_share_setopt(this->_share_handle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
 	_get_handle = curl_easy_init();
 	curl_easy_setopt(this->_get_handle, CURLOPT_HTTPGET, 1L);
 	curl_easy_setopt(this->_get_handle, CURLOPT_FOLLOWLOCATION, 1L);
@@ -55,11 +247,29 @@ RestSession::RestSession() // except handles in rest_init exchange client level
 	curl_easy_setopt(this->_delete_handle, CURLOPT_FAILONERROR, 0);
 
 
+	if (!(this->_share_handle)) throw("exc"); // handle exc
 	if (!(this->_get_handle)) throw("exc"); // handle exc
 	if (!(this->_post_handle)) throw("exc"); // handle exc
 	if (!(this->_put_handle)) throw("exc"); // handle exc
 	if (!(this->_delete_handle)) throw("exc"); // handle exc
 
+	for (CURL* handle : { this->_get_handle, this->_post_handle, this->_put_handle, this->_delete_handle })
+	{
+		curl_easy_setopt(handle, CURLOPT_SHARE, this->_share_handle);
+		curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, _HEADER_CALLBACK);
+		curl_easy_setopt(handle, CURLOPT_TCP_KEEPALIVE, 1L);
+		curl_easy_setopt(handle, CURLOPT_TCP_KEEPIDLE, _IDLE_TIME_TCP);
+		curl_easy_setopt(handle, CURLOPT_TCP_KEEPINTVL, _INTVL_TIME_TCP);
+	}
+
+	_get_pool = new CurlHandlePool{ this->_get_handle, this->_share_handle };
+	_post_pool = new CurlHandlePool{ this->_post_handle, this->_share_handle };
+	_put_pool = new CurlHandlePool{ this->_put_handle, this->_share_handle };
+	_delete_pool = new CurlHandlePool{ this->_delete_handle, this->_share_handle };
+
+	_multi_handle = curl_multi_init();
+	if (!(this->_multi_handle)) throw("exc"); // handle exc
+	curl_multi_setopt(this->_multi_handle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX); // used by HTTP/2 handles only
 
 	this->status = 1;
 }
@@ -70,201 +280,1530 @@ RestSession::RestSession() // except handles in rest_init exchange client level
 */
 void RestSession::set_verbose(const long int state)
 {
-	curl_easy_setopt(this->_get_handle, CURLOPT_VERBOSE, state);
-	curl_easy_setopt(this->_post_handle, CURLOPT_VERBOSE, state);
-	curl_easy_setopt(this->_put_handle, CURLOPT_VERBOSE, state);
-	curl_easy_setopt(this->_delete_handle, CURLOPT_VERBOSE, state);
+	this->_get_pool->set_option(CURLOPT_VERBOSE, state);
+	this->_post_pool->set_option(CURLOPT_VERBOSE, state);
+	this->_put_pool->set_option(CURLOPT_VERBOSE, state);
+	this->_delete_pool->set_option(CURLOPT_VERBOSE, state);
 
 }
 
 /**
-	Make a GET request
-	@param full_path - the full path of the request
-	@return a JSON value returned by the request response
+	Set headers for all handles of the session
+	@param headers - the list of headers (must outlive the session)
 */
-simdjson::dom::element RestSession::_getreq(std::string full_path)
+void RestSession::set_headers(struct curl_slist* headers)
 {
-	RequestHandler request{};
-	try
+	this->_get_pool->set_option(CURLOPT_HTTPHEADER, headers);
+	this->_post_pool->set_option(CURLOPT_HTTPHEADER, headers);
+	this->_put_pool->set_option(CURLOPT_HTTPHEADER, headers);
+	this->_delete_pool->set_option(CURLOPT_HTTPHEADER, headers);
+}
+
+/**
+	Set the max number of concurrent requests of each request type
+	requests above the max wait for a handle of their type to be returned
+	@param max_connections - max handles per request type, 0 for unlimited (1 serializes each type)
+*/
+void RestSession::set_max_connections(const unsigned int max_connections)
+{
+	this->_get_pool->set_max_size(max_connections);
+	this->_post_pool->set_max_size(max_connections);
+	this->_put_pool->set_max_size(max_connections);
+	this->_delete_pool->set_max_size(max_connections);
+}
+
+/**
+	Set HTTP/2 mode - one connection per host, with all requests multiplexed over it
+	requests (including sync requests) are sent from the event loop, and waited for by the calling thread.
+	should be set before sending requests, since handles in use are not updated safely
+	@param state - 1 to enable, 0 to go back to HTTP/1.1
+	@return 1 if set, 0 if curl is built without HTTP/2 support
+*/
+bool RestSession::set_http2(const bool state)
+{
+	if (state && !(curl_version_info(CURLVERSION_NOW)->features & CURL_VERSION_HTTP2)) return 0;
+
+	long http_version = state ? CURL_HTTP_VERSION_2TLS : CURL_HTTP_VERSION_1_1;
+	long pipe_wait = state ? 1L : 0L; // wait for a connection that can be multiplexed, instead of opening a new one
+
+	for (CurlHandlePool* pool : { this->_get_pool, this->_post_pool, this->_put_pool, this->_delete_pool })
 	{
-		request.session = this;
+		pool->set_option(CURLOPT_HTTP_VERSION, http_version);
+		pool->set_option(CURLOPT_PIPEWAIT, pipe_wait);
+	}
 
-		CURL* curl;
-		curl = curl_easy_init();
+	this->_http2_mode = state;
+	curl_multi_wakeup(this->_multi_handle); // options of the multi handle are set by the event loop
 
-		curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
-		curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
-		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, _REQ_CALLBACK);
-		curl_easy_setopt(curl, CURLOPT_FAILONERROR, 0);
+	return 1;
+}
 
-		curl_easy_setopt(curl, CURLOPT_URL, full_path.c_str());
-		curl_easy_setopt(curl, CURLOPT_WRITEDATA, &request);
+/**
+	Make a request on a pooled handle - admitted by the rate limiter first
+	@param full_path - the full path of the request
+	@param request_type - the type of the request
+	@return a JSON value returned by the request response
+	@throw CustomException - if called from the event loop thread (an async callback)
+*/
+RestResponse RestSession::_perform(const std::string& full_path, const RestRequestType request_type)
+{
+	if (std::this_thread::get_id() == this->_event_loop_id.load()) // from an async callback - would wait for the event loop it blocks
+	{
+		CustomException e{ "sync_request_from_event_loop" };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
 
-		request.req_status = curl_easy_perform(curl);
-		
-		curl_easy_cleanup(curl);
+	RequestHandler request{};
+	CurlHandlePool* pool = this->_pool_of(request_type);
+	CURL* handle{ nullptr };
+	try
+	{
+		this->_rate_limiter.acquire(full_path, request_type);
+		if (this->_http2_mode) return this->_submit_future(full_path, request_type).get();
 
-		/*Json::CharReader* _J_READER = _J_BUILDER.newCharReader();
+		request.session = this;
 
-		std::string parse_errors{};		
-		bool parse_status = _J_READER->parse(request.req_raw.c_str(),
-										request.req_raw.c_str() + request.req_raw.size(),
-										&request.req_json,
-										&parse_errors);*/
+		handle = pool->checkout(); // warm handle, its connection is kept alive - concurrent requests use separate handles, each on its own connection
 
-		simdjson::dom::parser* parser = new simdjson::dom::parser();
-		request.req_json = parser->parse(request.req_raw);
+		curl_easy_setopt(handle, CURLOPT_URL, full_path.c_str());
+		curl_easy_setopt(handle, CURLOPT_WRITEDATA, &request);
+		curl_easy_setopt(handle, CURLOPT_HEADERDATA, &request);
 
-		/*if (request.req_status != CURLE_OK || request.req_status == CURLE_HTTP_RETURNED_ERROR)
-		{
-			request.req_json = request.req_raw;
-		}
-		else if (!parse_status)
-		{
-			request.req_json["parse_status"] = parse_errors;
-		}
+		request.req_status = curl_easy_perform(handle);
+		this->_stats.record(handle, request_type, request.req_status, request.req_raw);
 
-		request.req_json["request_status"] = 1;*/
+		pool->checkin(handle);
+		handle = nullptr;
 
-		return request.req_json;
+		return RestResponse{ &this->_parser_pool, request.req_raw };
+	}
+	catch (RateLimitExceeded& e) // before the handle is taken
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
 	}
 	catch (...)
 	{
+		if (handle) pool->checkin(handle);
+
 		BadRequestREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
 		throw(e);
 	}
 };
 
+/**
+	Make a GET request
+	@param full_path - the full path of the request
+	@return a JSON value returned by the request response
+*/
+RestResponse RestSession::_getreq(const std::string& full_path)
+{
+	return this->_perform(full_path, RestRequestType::get_request);
+};
+
 /**
 	Make a POST request
 	@param full_path - the full path of the request
 	@return a JSON value returned by the request response
 */
-simdjson::dom::element RestSession::_postreq(std::string full_path)
+RestResponse RestSession::_postreq(const std::string& full_path)
 {
-	try
-	{
-		RequestHandler request{};
+	return this->_perform(full_path, RestRequestType::post_request);
+};
+
+/**
+	Make a PUT request
+	@param full_path - the full path of the request
+	@return a JSON value returned by the request response
+*/
+RestResponse RestSession::_putreq(const std::string& full_path)
+{
+	return this->_perform(full_path, RestRequestType::put_request);
+};
 
-		std::unique_lock<std::mutex> req_lock(this->_post_lock); // will be unlocked in callback
-		request.locker = &req_lock;
+/**
+	Make a DELETE request
+	@param full_path - the full path of the request
+	@return a JSON value returned by the request response
+*/
+RestResponse RestSession::_deletereq(const std::string& full_path)
+{
+	return this->_perform(full_path, RestRequestType::delete_request);
+};
 
-		curl_easy_setopt(this->_post_handle, CURLOPT_URL, full_path.c_str());
-		curl_easy_setopt(this->_post_handle, CURLOPT_WRITEDATA, &request);
 
-		request.req_status = curl_easy_perform(this->_post_handle);
+/**
+	Send a request asynchronously
+	the calling thread never waits for the rate limiter - a request that does not fit is admitted by the event loop
+	@param full_path - the full path of the request
+	@param request_type - the type of the request
+	@return a future of the response - holds BadRequestREST if the request failed
+	@throw RateLimitExceeded - if the request does not fit under the reject policy
+*/
+std::future<RestResponse> RestSession::_asyncreq(const std::string& full_path, const RestRequestType request_type)
+{
+	try
+	{
+		AsyncRequest* async_request = this->_new_admitted_request(full_path, request_type);
+		std::future<RestResponse> response_future = async_request->response_promise.get_future();
+		this->_submit_async_request(async_request);
 
-		return request.req_json;
+		return response_future;
 	}
-	catch (...)
+	catch (ClientException& e)
 	{
-		BadRequestREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		throw;
 	}
-};
+}
 
 /**
-	Make a PUT request
+	Send a request asynchronously
+	the calling thread never waits for the rate limiter - a request that does not fit is admitted by the event loop
 	@param full_path - the full path of the request
-	@return a JSON value returned by the request response
+	@param request_type - the type of the request
+	@param callback - called on the event loop thread with the response (empty if the request failed)
+	@throw RateLimitExceeded - if the request does not fit under the reject policy
 */
-simdjson::dom::element RestSession::_putreq(std::string full_path)
+void RestSession::_asyncreq(const std::string& full_path, const RestRequestType request_type, std::function<void(RestResponse&)> callback)
 {
 	try
 	{
-		RequestHandler request{};
-
-		std::unique_lock<std::mutex> req_lock(this->_put_lock); // will be unlocked in callback
-		request.locker = &req_lock;
+		AsyncRequest* async_request = this->_new_admitted_request(full_path, request_type);
+		async_request->callback = std::move(callback);
+		this->_submit_async_request(async_request);
+	}
+	catch (ClientException& e)
+	{
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+}
 
-		curl_easy_setopt(this->_put_handle, CURLOPT_URL, full_path.c_str());
-		curl_easy_setopt(this->_put_handle, CURLOPT_WRITEDATA, &request);
+/**
+	Queue a request on the event loop, without admission by the rate limiter
+	@param full_path - the full path of the request
+	@param request_type - the type of the request
+	@return a future of the response
+*/
+std::future<RestResponse> RestSession::_submit_future(const std::string& full_path, const RestRequestType request_type)
+{
+	AsyncRequest* async_request = this->_new_async_request(full_path, request_type);
+	std::future<RestResponse> response_future = async_request->response_promise.get_future();
+	this->_submit_async_request(async_request);
 
-		request.req_status = curl_easy_perform(this->_put_handle);
+	return response_future;
+}
 
-		return request.req_json;
+/**
+	Get the handle pool of a request type
+	@param request_type - the type of the request
+	@return the pool
+*/
+CurlHandlePool* RestSession::_pool_of(const RestRequestType request_type)
+{
+	switch (request_type)
+	{
+	case RestRequestType::post_request: return this->_post_pool;
+	case RestRequestType::put_request: return this->_put_pool;
+	case RestRequestType::delete_request: return this->_delete_pool;
+	default: return this->_get_pool;
 	}
-	catch (...)
+}
+
+/**
+	Prepare a request for the event loop
+	@param full_path - the full path of the request
+	@param request_type - the type of the request
+	@return the request - owned by the event loop once submitted
+*/
+RestSession::AsyncRequest* RestSession::_new_async_request(const std::string& full_path, const RestRequestType request_type)
+{
+	if (!this->status)
 	{
 		BadRequestREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
 		throw(e);
 	}
-};
+
+	AsyncRequest* async_request = new AsyncRequest{};
+	async_request->request.session = this;
+	async_request->pool = this->_pool_of(request_type);
+	async_request->request_type = request_type;
+
+	try
+	{
+		async_request->handle = async_request->pool->checkout();
+	}
+	catch (ClientException& e)
+	{
+		delete async_request;
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+
+	curl_easy_setopt(async_request->handle, CURLOPT_URL, full_path.c_str());
+	curl_easy_setopt(async_request->handle, CURLOPT_WRITEDATA, &async_request->request);
+	curl_easy_setopt(async_request->handle, CURLOPT_HEADERDATA, &async_request->request);
+	curl_easy_setopt(async_request->handle, CURLOPT_PRIVATE, async_request);
+	async_request->admitted = 1;
+
+	return async_request;
+}
 
 /**
-	Make a DELETE request
+	Prepare a request for the event loop, admitted by the rate limiter if it fits - without waiting
 	@param full_path - the full path of the request
-	@return a JSON value returned by the request response
+	@param request_type - the type of the request
+	@return the request - admitted later by the event loop if it does not fit yet
+	@throw RateLimitExceeded - if the request does not fit under the reject policy
 */
-simdjson::dom::element RestSession::_deletereq(std::string full_path)
+RestSession::AsyncRequest* RestSession::_new_admitted_request(const std::string& full_path, const RestRequestType request_type)
 {
+	bool waiting{ 0 };
+	std::chrono::milliseconds wait_time{};
+	std::chrono::steady_clock::time_point deadline = RateLimiter::deadline_of(full_path, std::chrono::steady_clock::now());
+	bool admitted = this->_rate_limiter.try_acquire(full_path, request_type, deadline, waiting, wait_time);
+
+	AsyncRequest* async_request{ nullptr };
 	try
 	{
-		RequestHandler request{};
+		async_request = this->_new_async_request(full_path, request_type);
+	}
+	catch (ClientException& e)
+	{
+		if (waiting) this->_rate_limiter.cancel_wait(request_type);
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
 
-		std::unique_lock<std::mutex> req_lock(this->_delete_lock); // will be unlocked in callback
-		request.locker = &req_lock;
+	async_request->admitted = admitted;
+	async_request->waiting = waiting;
+	async_request->deadline = deadline;
+	if (!admitted) async_request->full_path = full_path;
 
-		curl_easy_setopt(this->_delete_handle, CURLOPT_URL, full_path.c_str());
-		curl_easy_setopt(this->_delete_handle, CURLOPT_WRITEDATA, &request);
+	return async_request;
+}
 
-		request.req_status = curl_easy_perform(this->_delete_handle);
+/**
+	Queue a request on the event loop
+	the event loop thread is started on the first request
+	@param async_request - the request - deleted if the session is closing
+	@throw BadRequestREST - if the session is closing
+*/
+void RestSession::_submit_async_request(AsyncRequest* async_request)
+{
+	std::lock_guard<std::mutex> async_guard(this->_async_lock);
 
-		return request.req_json;
-	}
-	catch (...)
+	if (this->_closing)
 	{
+		if (async_request->waiting) this->_rate_limiter.cancel_wait(async_request->request_type);
+		async_request->pool->checkin(async_request->handle);
+		delete async_request;
+
 		BadRequestREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
 		throw(e);
 	}
-};
 
+	this->_async_queue.push_back(async_request);
+	if (!this->_event_loop_thread)
+	{
+		this->_event_loop_running = 1;
+		this->_event_loop_thread = new std::thread(&RestSession::_event_loop, this);
+	}
+	curl_multi_wakeup(this->_multi_handle);
+}
 
 /**
-	Close the current session
-	@return a boolean value representing success for closing the session
+	Complete a finished request
+	fulfills the promise or invokes the callback, then deletes the request
+	@param async_request - the request
+	@param result - the transfer result
 */
-bool RestSession::close()
+void RestSession::_complete_async_request(AsyncRequest* async_request, const CURLcode result)
 {
-	try
+	if (async_request->waiting) this->_rate_limiter.cancel_wait(async_request->request_type); // never admitted
+	this->_stats.record(async_request->handle, async_request->request_type, result, async_request->request.req_raw);
+	async_request->pool->checkin(async_request->handle);
+
+	RestResponse response{};
+	bool request_failed = (result != CURLE_OK);
+	if (!request_failed)
 	{
-		if (this->status)
+		try
 		{
-			curl_easy_cleanup(this->_post_handle);
-			curl_easy_cleanup(this->_get_handle);
-			curl_easy_cleanup(this->_put_handle);
-			curl_easy_cleanup(this->_delete_handle);
+			response = RestResponse{ &this->_parser_pool, async_request->request.req_raw };
 		}
+		catch (...)
+		{
+			request_failed = 1;
+		}
+	}
 
-		this->status = 0;
-		return 1;
+	if (async_request->callback)
+	{
+		try
+		{
+			async_request->callback(response);
+		}
+		catch (...) {} // must not break the event loop
 	}
-	catch (...)
+	else if (request_failed)
 	{
-		BadCleanupREST e{};
+		BadRequestREST e{};
 		e.append_to_traceback(std::string(__FUNCTION__));
-		throw(e);
+		async_request->response_promise.set_exception(std::make_exception_ptr(e));
 	}
-};
+	else
+	{
+		async_request->response_promise.set_value(std::move(response));
+	}
+
+	delete async_request;
+}
 
 /**
-	Default constructor
-	this class is used to handle request responses
+	The event loop - drives all asynchronous requests on one thread
+	requests that did not fit the rate limits when submitted are admitted here, and sent in order once they fit
+	runs until '_stop_event_loop()' is called; unfinished requests fail on exit
 */
-RestSession::RequestHandler::RequestHandler()
-	: req_raw{ "" }, req_json{ simdjson::dom::element{} }, req_status{ CURLcode{} }, locker { nullptr }
+void RestSession::_event_loop()
 {
-};
+	std::vector<AsyncRequest*> new_requests;
+	std::vector<AsyncRequest*> waiting_requests; // not admitted by the rate limiter yet, in order of submission
+	std::vector<AsyncRequest*> requests_in_flight;
+	int running_handles{ 0 };
+	int messages_left{ 0 };
+	int poll_ms{ _EVENT_LOOP_POLL_MS };
+	CURLMsg* message;
 
-/**
-	Destructor
-	close the session upon deletion
+	this->_event_loop_id = std::this_thread::get_id(); // before any callback runs
+
+	while (this->_event_loop_running)
+	{
+		if (this->_http2_multi_options != this->_http2_mode) this->_set_multi_options();
+
+		{
+			std::lock_guard<std::mutex> async_guard(this->_async_lock);
+			new_requests.swap(this->_async_queue);
+		}
+		waiting_requests.insert(waiting_requests.end(), new_requests.begin(), new_requests.end());
+		new_requests.clear();
+
+		poll_ms = _EVENT_LOOP_POLL_MS;
+		for (auto request_itr = waiting_requests.begin(); request_itr != waiting_requests.end();)
+		{
+			AsyncRequest* async_request = *request_itr;
+			if (!async_request->admitted)
+			{
+				std::chrono::milliseconds wait_time{};
+				try
+				{
+					async_request->admitted = this->_rate_limiter.try_acquire(async_request->full_path, async_request->request_type, async_request->deadline, async_request->waiting, wait_time);
+				}
+				catch (ClientException&) // past its recvWindow, or the policy was set to reject while waiting
+				{
+					request_itr = waiting_requests.erase(request_itr);
+					this->_complete_async_request(async_request, CURLE_ABORTED_BY_CALLBACK);
+					continue;
+				}
+
+				if (!async_request->admitted)
+				{
+					poll_ms = std::min(poll_ms, static_cast<int>(wait_time.count()));
+					request_itr++;
+					continue;
+				}
+			}
+
+			request_itr = waiting_requests.erase(request_itr);
+			curl_multi_add_handle(this->_multi_handle, async_request->handle);
+			requests_in_flight.push_back(async_request);
+		}
+
+		curl_multi_perform(this->_multi_handle, &running_handles);
+
+		while ((message = curl_multi_info_read(this->_multi_handle, &messages_left)))
+		{
+			if (message->msg != CURLMSG_DONE) continue;
+
+			AsyncRequest* async_request{ nullptr };
+			CURLcode result = message->data.result;
+			curl_easy_getinfo(message->easy_handle, CURLINFO_PRIVATE, &async_request);
+			curl_multi_remove_handle(this->_multi_handle, message->easy_handle);
+
+			requests_in_flight.erase(std::find(requests_in_flight.begin(), requests_in_flight.end(), async_request));
+			this->_complete_async_request(async_request, result);
+		}
+
+		curl_multi_poll(this->_multi_handle, nullptr, 0, poll_ms, nullptr);
+	}
+
+	{
+		std::lock_guard<std::mutex> async_guard(this->_async_lock);
+		new_requests.swap(this->_async_queue);
+	}
+	new_requests.insert(new_requests.end(), waiting_requests.begin(), waiting_requests.end());
+	for (AsyncRequest* async_request : requests_in_flight)
+	{
+		curl_multi_remove_handle(this->_multi_handle, async_request->handle);
+		this->_complete_async_request(async_request, CURLE_ABORTED_BY_CALLBACK);
+	}
+	for (AsyncRequest* async_request : new_requests)
+	{
+		this->_complete_async_request(async_request, CURLE_ABORTED_BY_CALLBACK);
+	}
+}
+
+/**
+	Set the options of the multi handle for the current mode
+	called from the event loop thread only
+*/
+void RestSession::_set_multi_options()
+{
+	bool http2_mode = this->_http2_mode;
+
+	curl_multi_setopt(this->_multi_handle, CURLMOPT_MAX_HOST_CONNECTIONS, http2_mode ? 1L : 0L); // one connection per base URL
+
+	this->_http2_multi_options = http2_mode;
+}
+
+/**
+	Stop the event loop and wait for its thread
+	requests submitted after it are rejected, so the loop is not restarted on a multi handle being cleaned up
+*/
+void RestSession::_stop_event_loop()
+{
+	std::thread* event_loop_thread{ nullptr };
+	{
+		std::lock_guard<std::mutex> async_guard(this->_async_lock);
+		this->_closing = 1;
+		event_loop_thread = this->_event_loop_thread;
+		this->_event_loop_thread = nullptr;
+		this->_event_loop_running = 0;
+		curl_multi_wakeup(this->_multi_handle);
+	}
+
+	if (event_loop_thread)
+	{
+		event_loop_thread->join();
+		delete event_loop_thread;
+	}
+}
+
+/**
+	Close the current session
+	@return a boolean value representing success for closing the session
+*/
+bool RestSession::close()
+{
+	try
+	{
+		if (this->status)
+		{
+			this->_stop_event_loop();
+			curl_multi_cleanup(this->_multi_handle);
+
+			delete this->_get_pool;
+			delete this->_post_pool;
+			delete this->_put_pool;
+			delete this->_delete_pool;
+			this->_get_pool = nullptr;
+			this->_post_pool = nullptr;
+			this->_put_pool = nullptr;
+			this->_delete_pool = nullptr;
+
+			curl_easy_cleanup(this->_post_handle);
+			curl_easy_cleanup(this->_get_handle);
+			curl_easy_cleanup(this->_put_handle);
+			curl_easy_cleanup(this->_delete_handle);
+			curl_share_cleanup(this->_share_handle); // only after all handles using it are gone
+		}
+
+		this->status = 0;
+		return 1;
+	}
+	catch (...)
+	{
+		BadCleanupREST e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+};
+
+/**
+	Default constructor
+	this class is used to handle request responses
+*/
+RestSession::RequestHandler::RequestHandler()
+	: req_raw{ "" }, req_status{ CURLcode{} }, session{ nullptr }
+{
+};
+
+/**
+	Constructor
+	@param capacity - max number of idle parsers kept by the pool
+*/
+ParserPool::ParserPool(const unsigned int capacity)
+	: _capacity{ capacity }, _leased{ 0 }, _high_water_mark{ 0 }
+{}
+
+/**
+	Take a parser out of the pool
+	a new parser is allocated if none is idle
+	@return the parser - must be returned by 'release()'
+*/
+simdjson::dom::parser* ParserPool::acquire()
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+
+	this->_leased++;
+	if (this->_leased > this->_high_water_mark) this->_high_water_mark = this->_leased;
+
+	if (!this->_idle_parsers.empty())
+	{
+		simdjson::dom::parser* parser = this->_idle_parsers.back();
+		this->_idle_parsers.pop_back();
+		return parser;
+	}
+
+	return new simdjson::dom::parser();
+}
+
+/**
+	Return a parser to the pool
+	the parser is deleted if the pool is full
+	@param parser - a parser taken by 'acquire()'
+*/
+void ParserPool::release(simdjson::dom::parser* parser)
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+
+	this->_leased--;
+	if (this->_idle_parsers.size() < this->_capacity)
+	{
+		this->_idle_parsers.push_back(parser); // keeps its buffers for the next response
+	}
+	else
+	{
+		delete parser;
+	}
+}
+
+/**
+	Set the max number of idle parsers kept by the pool
+	@param capacity - the new capacity
+*/
+void ParserPool::set_capacity(const unsigned int capacity)
+{
+	std::lock_guard<std::mutex> pool_guard(this->_pool_lock);
+
+	this->_capacity = capacity;
+	while (this->_idle_parsers.size() > this->_capacity)
+	{
+		delete this->_idle_parsers.back();
+		this->_idle_parsers.pop_back();
+	}
+}
+
+/**
+	Destructor
+	all responses of the pool must be destroyed before the pool
+*/
+ParserPool::~ParserPool()
+{
+	for (simdjson::dom::parser* parser : this->_idle_parsers)
+	{
+		delete parser;
+	}
+}
+
+/**
+	Default constructor
+	an empty response, holding no document
+*/
+RestResponse::RestResponse()
+	: _parser{ nullptr }, _pool{ nullptr }, _json{}
+{}
+
+/**
+	Constructor
+	parses the response with a parser leased from the pool
+	@param pool - the pool to lease the parser from
+	@param raw_response - the response body
+*/
+RestResponse::RestResponse(ParserPool* pool, const std::string& raw_response)
+	: _parser{ pool->acquire() }, _pool{ pool }, _json{}
+{
+	try
+	{
+		this->_json = this->_parser->parse(raw_response);
+	}
+	catch (...)
+	{
+		this->_release();
+		throw;
+	}
+}
+
+/**
+	Move constructor
+*/
+RestResponse::RestResponse(RestResponse&& response_obj) noexcept
+	: _parser{ response_obj._parser }, _pool{ response_obj._pool }, _json{ response_obj._json }
+{
+	response_obj._parser = nullptr;
+	response_obj._pool = nullptr;
+}
+
+/**
+	Move assignment
+*/
+RestResponse& RestResponse::operator=(RestResponse&& response_obj) noexcept
+{
+	if (this != &response_obj)
+	{
+		this->_release();
+		this->_parser = response_obj._parser;
+		this->_pool = response_obj._pool;
+		this->_json = response_obj._json;
+
+		response_obj._parser = nullptr;
+		response_obj._pool = nullptr;
+	}
+
+	return *this;
+}
+
+/**
+	Return the parser to its pool
+*/
+void RestResponse::_release()
+{
+	if (this->_parser) this->_pool->release(this->_parser);
+	this->_parser = nullptr;
+	this->_pool = nullptr;
+}
+
+/**
+	Print the response
+	@param out - the output stream
+	@param response - the response to print
+	@return the output stream
+*/
+std::ostream& operator<<(std::ostream& out, const RestResponse& response)
+{
+	if (response.empty()) return out << "null";
+	return out << response._json;
+}
+
+/**
+	Destructor
+	the parser is returned to the pool, invalidating all elements taken from this response
+*/
+RestResponse::~RestResponse()
+{
+	this->_release();
+}
+
+/**
+	Destructor
+	close the session upon deletion
 */
 RestSession::~RestSession()
 {
 	this->close();
 }
+
+/**
+	Constructor
+	@param capacity - max number of tokens (the limit)
+	@param interval_ms - the interval of the limit, in which the bucket refills from empty to full
+*/
+TokenBucket::TokenBucket(const unsigned int capacity, const unsigned int interval_ms)
+	: _capacity{ 0 }, _tokens{ 0 }, _refill_per_ms{ 0 }, _last_refill{ std::chrono::steady_clock::now() }
+{
+	this->set_limit(capacity, interval_ms);
+	this->_tokens = this->_capacity;
+}
+
+/**
+	Set the limit of the bucket
+	@param capacity - max number of tokens (the limit)
+	@param interval_ms - the interval of the limit
+*/
+void TokenBucket::set_limit(const unsigned int capacity, const unsigned int interval_ms)
+{
+	this->_capacity = capacity;
+	this->_refill_per_ms = interval_ms ? static_cast<double>(capacity) / interval_ms : capacity;
+	if (this->_tokens > this->_capacity) this->_tokens = this->_capacity;
+}
+
+/**
+	Add the tokens refilled since the last refill
+	@param now - the current time
+*/
+void TokenBucket::refill(const std::chrono::steady_clock::time_point now)
+{
+	double elapsed_ms = std::chrono::duration<double, std::milli>(now - this->_last_refill).count();
+	this->_tokens = std::min(this->_capacity, this->_tokens + elapsed_ms * this->_refill_per_ms);
+	this->_last_refill = now;
+}
+
+/**
+	Check whether there are enough tokens
+	amounts above the capacity are capped, so that they are sent once the bucket is full
+	@param amount - the number of tokens
+	@return 1 if available, 0 if not
+*/
+bool TokenBucket::available(double amount) const
+{
+	return this->_tokens >= std::min(amount, this->_capacity);
+}
+
+/**
+	Take tokens out of the bucket
+	@param amount - the number of tokens
+*/
+void TokenBucket::consume(double amount)
+{
+	this->_tokens -= std::min(amount, this->_capacity);
+}
+
+/**
+	Sync the bucket with the usage reported by the exchange
+	the bucket never holds more than what is left of the limit
+	@param used - the usage reported
+*/
+void TokenBucket::reconcile(const unsigned int used)
+{
+	double left = used < this->_capacity ? this->_capacity - used : 0;
+	if (this->_tokens > left) this->_tokens = left;
+}
+
+/**
+	Get the time until there are enough tokens
+	@param amount - the number of tokens
+	@return the time to wait, 0 if available
+*/
+std::chrono::milliseconds TokenBucket::wait_time(double amount) const
+{
+	double missing = std::min(amount, this->_capacity) - this->_tokens;
+	if (missing <= 0 || this->_refill_per_ms <= 0) return std::chrono::milliseconds{ 0 };
+
+	return std::chrono::milliseconds{ static_cast<long long>(missing / this->_refill_per_ms) + 1 };
+}
+
+/**
+	Weights of endpoints by "METHOD /path", for endpoints not listed the weight is 1
+	weights change over time - the used weight reported by the exchange corrects the estimate
+*/
+const std::unordered_map<std::string, RateLimiter::EndpointWeight> RateLimiter::_ENDPOINT_WEIGHTS
+{
+	// Spot
+	{ "GET /api/v3/exchangeInfo", { 20, 20, 0 } },
+	{ "GET /api/v3/trades", { 25, 25, 0 } },
+	{ "GET /api/v3/historicalTrades", { 25, 25, 0 } },
+	{ "GET /api/v3/aggTrades", { 2, 2, 0 } },
+	{ "GET /api/v3/klines", { 2, 2, 0 } },
+	{ "GET /api/v3/avgPrice", { 2, 2, 0 } },
+	{ "GET /api/v3/ticker/24hr", { 2, 80, 0 } },
+	{ "GET /api/v3/ticker/price", { 2, 4, 0 } },
+	{ "GET /api/v3/ticker/bookTicker", { 2, 4, 0 } },
+	{ "POST /api/v3/order", { 1, 1, 1 } },
+	{ "POST /api/v3/order/test", { 1, 1, 0 } },
+	{ "POST /api/v3/order/oco", { 1, 1, 1 } },
+	{ "GET /api/v3/order", { 4, 4, 0 } },
+	{ "GET /api/v3/openOrders", { 6, 80, 0 } },
+	{ "GET /api/v3/allOrders", { 20, 20, 0 } },
+	{ "GET /api/v3/orderList", { 4, 4, 0 } },
+	{ "GET /api/v3/allOrderList", { 20, 20, 0 } },
+	{ "GET /api/v3/openOrderList", { 6, 6, 0 } },
+	{ "GET /api/v3/account", { 20, 20, 0 } },
+	{ "GET /api/v3/myTrades", { 20, 20, 0 } },
+	{ "POST /api/v3/userDataStream", { 2, 2, 0 } },
+	{ "PUT /api/v3/userDataStream", { 2, 2, 0 } },
+	{ "DELETE /api/v3/userDataStream", { 2, 2, 0 } },
+
+	// USDT futures
+	{ "GET /fapi/v1/trades", { 5, 5, 0 } },
+	{ "GET /fapi/v1/historicalTrades", { 20, 20, 0 } },
+	{ "GET /fapi/v1/aggTrades", { 20, 20, 0 } },
+	{ "GET /fapi/v1/klines", { 5, 5, 0 } },
+	{ "GET /fapi/v1/ticker/24hr", { 1, 40, 0 } },
+	{ "GET /fapi/v1/ticker/price", { 1, 2, 0 } },
+	{ "GET /fapi/v1/ticker/bookTicker", { 1, 2, 0 } },
+	{ "POST /fapi/v1/order", { 1, 1, 1 } },
+	{ "POST /fapi/v1/batchOrders", { 5, 5, 1 } },
+	{ "GET /fapi/v1/openOrders", { 1, 40, 0 } },
+	{ "GET /fapi/v1/allOrders", { 5, 5, 0 } },
+	{ "GET /fapi/v2/account", { 5, 5, 0 } },
+	{ "GET /fapi/v2/balance", { 5, 5, 0 } },
+	{ "GET /fapi/v2/positionRisk", { 5, 5, 0 } },
+	{ "GET /fapi/v1/userTrades", { 5, 5, 0 } },
+	{ "GET /fapi/v1/income", { 30, 30, 0 } },
+
+	// Coin futures
+	{ "GET /dapi/v1/trades", { 5, 5, 0 } },
+	{ "GET /dapi/v1/historicalTrades", { 20, 20, 0 } },
+	{ "GET /dapi/v1/aggTrades", { 20, 20, 0 } },
+	{ "GET /dapi/v1/klines", { 5, 5, 0 } },
+	{ "GET /dapi/v1/ticker/24hr", { 1, 40, 0 } },
+	{ "GET /dapi/v1/ticker/price", { 1, 2, 0 } },
+	{ "GET /dapi/v1/ticker/bookTicker", { 1, 2, 0 } },
+	{ "POST /dapi/v1/order", { 1, 1, 1 } },
+	{ "POST /dapi/v1/batchOrders", { 5, 5, 1 } },
+	{ "GET /dapi/v1/openOrders", { 1, 40, 0 } },
+	{ "GET /dapi/v1/allOrders", { 20, 40, 0 } },
+	{ "GET /dapi/v1/account", { 5, 5, 0 } },
+	{ "GET /dapi/v1/balance", { 1, 1, 0 } },
+	{ "GET /dapi/v1/positionRisk", { 1, 1, 0 } },
+	{ "GET /dapi/v1/userTrades", { 20, 40, 0 } },
+	{ "GET /dapi/v1/income", { 20, 20, 0 } }
+};
+
+/**
+	Default constructor
+	limits default to 1200 weight per minute and 50 orders per 10 seconds, with no client-side limiting
+*/
+RateLimiter::RateLimiter()
+	: _policy{ RateLimitPolicy::none }, _weight_bucket{ 1200, 60000 }, _order_bucket{ 50, 10000 }, _banned_until{}, _waiting{ 0, 0, 0 }
+{}
+
+/**
+	Set the policy for requests that do not fit the limits
+	@param policy - the policy
+*/
+void RateLimiter::set_policy(const RateLimitPolicy policy)
+{
+	{
+		std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+		this->_policy = policy;
+	}
+	this->_limiter_cv.notify_all();
+}
+
+/**
+	Set the limits of the account
+	@param weight_per_minute - request weight per minute
+	@param orders_per_10s - orders per 10 seconds
+*/
+void RateLimiter::set_limits(const unsigned int weight_per_minute, const unsigned int orders_per_10s)
+{
+	{
+		std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+		this->_weight_bucket.set_limit(weight_per_minute, 60000);
+		this->_order_bucket.set_limit(orders_per_10s, 10000);
+	}
+	this->_limiter_cv.notify_all();
+}
+
+/**
+	Get the priority of a request type
+	@param request_type - the type of the request
+	@return 2 for cancels, 1 for orders, 0 for the rest
+*/
+unsigned int RateLimiter::_priority_of(const RestRequestType request_type)
+{
+	switch (request_type)
+	{
+	case RestRequestType::delete_request: return 2;
+	case RestRequestType::post_request:
+	case RestRequestType::put_request: return 1;
+	default: return 0;
+	}
+}
+
+/**
+	Get the weight of a request
+	@param full_path - the full path of the request, including the query
+	@param request_type - the type of the request
+	@param is_order - set to whether the request counts towards the order limits
+	@return the weight
+*/
+unsigned int RateLimiter::endpoint_weight(std::string_view full_path, const RestRequestType request_type, bool& is_order)
+{
+	is_order = 0;
+
+	size_t path_start = full_path.find("://");
+	path_start = full_path.find('/', path_start == std::string_view::npos ? 0 : path_start + 3);
+	if (path_start == std::string_view::npos) return 1;
+
+	size_t query_start = full_path.find('?', path_start);
+	std::string_view path = full_path.substr(path_start, query_start - path_start);
+	std::string_view query = query_start == std::string_view::npos ? std::string_view{} : full_path.substr(query_start);
+
+	if (path.size() > 6 && path.substr(path.size() - 6) == "/depth") // weight by limit
+	{
+		size_t limit_pos = query.find("limit=");
+		unsigned int limit = limit_pos == std::string_view::npos ? 100 : std::atoi(query.data() + limit_pos + 6);
+
+		if (path.substr(0, 4) == "/api") return limit <= 100 ? 5 : limit <= 500 ? 25 : limit <= 1000 ? 50 : 250;
+		return limit <= 50 ? 2 : limit <= 100 ? 5 : limit <= 500 ? 10 : 20;
+	}
+
+	std::string key{};
+	switch (request_type)
+	{
+	case RestRequestType::post_request: key = "POST "; break;
+	case RestRequestType::put_request: key = "PUT "; break;
+	case RestRequestType::delete_request: key = "DELETE "; break;
+	default: key = "GET "; break;
+	}
+	key.append(path);
+
+	auto weight_itr = RateLimiter::_ENDPOINT_WEIGHTS.find(key);
+	if (weight_itr == RateLimiter::_ENDPOINT_WEIGHTS.end()) return 1;
+
+	is_order = weight_itr->second.is_order;
+	bool has_symbol = query.find("?symbol=") != std::string_view::npos || query.find("&symbol=") != std::string_view::npos;
+
+	return has_symbol ? weight_itr->second.weight : weight_itr->second.weight_no_symbol;
+}
+
+/**
+	Get the latest time a request may be admitted at
+	signed requests are stamped before admission, so they are rejected by the exchange (-1021) once their recvWindow passes
+	@param full_path - the full path of the request, including the query
+	@param now - the time the request is stamped at (approximately)
+	@return now + the recvWindow of the request if signed, time_point::max() if not
+*/
+std::chrono::steady_clock::time_point RateLimiter::deadline_of(std::string_view full_path, const std::chrono::steady_clock::time_point now)
+{
+	if (full_path.find("&signature=") == std::string_view::npos) return std::chrono::steady_clock::time_point::max();
+
+	unsigned int recv_window = _DEFAULT_RECV_WINDOW_MS;
+	size_t recv_pos = full_path.find("recvWindow=");
+	if (recv_pos != std::string_view::npos) recv_window = std::strtoul(full_path.data() + recv_pos + 11, nullptr, 10);
+
+	return now + std::chrono::milliseconds{ recv_window };
+}
+
+/**
+	Check whether a request fits the limits and is next in line - '_limiter_lock' must be held
+	@param weight - the weight of the request
+	@param is_order - whether the request counts towards the order limits
+	@param priority - the priority of the request
+	@param now - the current time
+	@return 1 if the request can be sent now, 0 if not
+*/
+bool RateLimiter::_fits(const unsigned int weight, const bool is_order, const unsigned int priority, const std::chrono::steady_clock::time_point now)
+{
+	this->_weight_bucket.refill(now);
+	this->_order_bucket.refill(now);
+
+	bool next_in_line = this->_policy != RateLimitPolicy::priority_queue;
+	if (!next_in_line)
+	{
+		next_in_line = 1;
+		for (unsigned int higher = priority + 1; higher < 3; higher++)
+		{
+			if (this->_waiting[higher]) next_in_line = 0;
+		}
+	}
+
+	bool fits = now >= this->_banned_until && this->_weight_bucket.available(weight) && (!is_order || this->_order_bucket.available(1));
+	return this->_policy == RateLimitPolicy::none || (fits && next_in_line);
+}
+
+/**
+	Get the time until a request may fit the limits - '_limiter_lock' must be held
+	@param weight - the weight of the request
+	@param is_order - whether the request counts towards the order limits
+	@param now - the current time
+	@return the time to wait, at least 1ms
+*/
+std::chrono::milliseconds RateLimiter::_wait_time(const unsigned int weight, const bool is_order, const std::chrono::steady_clock::time_point now) const
+{
+	std::chrono::milliseconds wait_time = std::max(this->_weight_bucket.wait_time(weight), std::chrono::milliseconds{ 1 });
+	if (is_order) wait_time = std::max(wait_time, this->_order_bucket.wait_time(1));
+	if (now < this->_banned_until) wait_time = std::max(wait_time, std::chrono::duration_cast<std::chrono::milliseconds>(this->_banned_until - now));
+
+	return wait_time;
+}
+
+/**
+	Admit a request by the policy - called before the request is sent
+	a signed request is not waited for past its recvWindow - it is rejected instead
+	@param full_path - the full path of the request, including the query
+	@param request_type - the type of the request
+	@throw RateLimitExceeded - under the reject policy, or if a signed request would wait past its recvWindow
+*/
+void RateLimiter::acquire(std::string_view full_path, const RestRequestType request_type)
+{
+	if (this->_policy.load(std::memory_order_relaxed) == RateLimitPolicy::none) return;
+
+	bool is_order{ 0 };
+	unsigned int weight = RateLimiter::endpoint_weight(full_path, request_type, is_order);
+	unsigned int priority = RateLimiter::_priority_of(request_type);
+	std::chrono::steady_clock::time_point deadline = RateLimiter::deadline_of(full_path, std::chrono::steady_clock::now());
+
+	std::unique_lock<std::mutex> limiter_guard(this->_limiter_lock);
+	this->_waiting[priority]++;
+
+	while (1)
+	{
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (this->_fits(weight, is_order, priority, now)) break;
+
+		std::chrono::milliseconds wait_time = this->_wait_time(weight, is_order, now);
+		if (this->_policy == RateLimitPolicy::reject || wait_time > deadline - now)
+		{
+			this->_waiting[priority]--;
+			limiter_guard.unlock();
+			this->_limiter_cv.notify_all();
+
+			RateLimitExceeded e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		this->_limiter_cv.wait_for(limiter_guard, wait_time);
+	}
+
+	this->_waiting[priority]--;
+	this->_weight_bucket.consume(weight);
+	if (is_order) this->_order_bucket.consume(1);
+
+	limiter_guard.unlock();
+	this->_limiter_cv.notify_all(); // lower priorities may be next in line
+}
+
+/**
+	Admit a request by the policy without waiting - for requests admitted by the event loop
+	a request that does not fit is counted as waiting (for the priority of the others) until admitted, or until 'cancel_wait()'
+	@param full_path - the full path of the request, including the query
+	@param request_type - the type of the request
+	@param deadline - the latest time to admit it at, from 'deadline_of()' when the request was submitted
+	@param waiting - whether the request is counted as waiting - updated by the call
+	@param wait_time - set to the time until the request may fit, if not admitted
+	@return 1 if admitted, 0 if the request must wait
+	@throw RateLimitExceeded - if the request does not fit under the reject policy, or would wait past its deadline
+*/
+bool RateLimiter::try_acquire(std::string_view full_path, const RestRequestType request_type, const std::chrono::steady_clock::time_point deadline, bool& waiting, std::chrono::milliseconds& wait_time)
+{
+	if (!waiting && this->_policy.load(std::memory_order_relaxed) == RateLimitPolicy::none) return 1;
+
+	bool is_order{ 0 };
+	unsigned int weight = RateLimiter::endpoint_weight(full_path, request_type, is_order);
+	unsigned int priority = RateLimiter::_priority_of(request_type);
+
+	std::unique_lock<std::mutex> limiter_guard(this->_limiter_lock);
+
+	std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+	if (!this->_fits(weight, is_order, priority, now))
+	{
+		wait_time = this->_wait_time(weight, is_order, now);
+		if (this->_policy == RateLimitPolicy::reject || wait_time > deadline - now)
+		{
+			if (waiting) this->_waiting[priority]--;
+			waiting = 0;
+
+			limiter_guard.unlock();
+			this->_limiter_cv.notify_all();
+
+			RateLimitExceeded e{};
+			e.append_to_traceback(std::string(__FUNCTION__));
+			throw(e);
+		}
+
+		if (!waiting) this->_waiting[priority]++;
+		waiting = 1;
+
+		return 0;
+	}
+
+	if (waiting) this->_waiting[priority]--;
+	waiting = 0;
+	this->_weight_bucket.consume(weight);
+	if (is_order) this->_order_bucket.consume(1);
+
+	limiter_guard.unlock();
+	this->_limiter_cv.notify_all(); // lower priorities may be next in line
+
+	return 1;
+}
+
+/**
+	Stop counting a request as waiting - for a request left by 'try_acquire()' that is given up
+	@param request_type - the type of the request
+*/
+void RateLimiter::cancel_wait(const RestRequestType request_type)
+{
+	{
+		std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+		this->_waiting[RateLimiter::_priority_of(request_type)]--;
+	}
+	this->_limiter_cv.notify_all();
+}
+
+/**
+	Check whether a header starts with a prefix, ignoring case
+	@param header - the header
+	@param prefix - the prefix (lowercase)
+	@return 1 if it does, 0 if not
+*/
+static bool _header_starts_with(std::string_view header, std::string_view prefix)
+{
+	if (header.size() < prefix.size()) return 0;
+	for (size_t i = 0; i < prefix.size(); i++)
+	{
+		if (std::tolower(static_cast<unsigned char>(header[i])) != prefix[i]) return 0;
+	}
+
+	return 1;
+}
+
+/**
+	Update the usage from a response header
+	handles 'X-MBX-USED-WEIGHT-(interval)', 'X-MBX-ORDER-COUNT-(interval)' and 'Retry-After', other headers are ignored
+	@param header - a header line
+*/
+void RateLimiter::update_from_header(std::string_view header)
+{
+	std::string_view weight_prefix{ "x-mbx-used-weight-" };
+	std::string_view order_prefix{ "x-mbx-order-count-" };
+	std::string_view retry_prefix{ "retry-after:" };
+
+	bool is_weight = _header_starts_with(header, weight_prefix);
+	bool is_order = !is_weight && _header_starts_with(header, order_prefix);
+	bool is_retry = !is_weight && !is_order && _header_starts_with(header, retry_prefix);
+	if (!is_weight && !is_order && !is_retry) return;
+
+	size_t value_start = header.find(':');
+	if (value_start == std::string_view::npos) return;
+	unsigned int value = std::strtoul(std::string{ header.substr(value_start + 1) }.c_str(), nullptr, 10);
+
+	std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+
+	if (is_retry)
+	{
+		this->_banned_until = std::chrono::steady_clock::now() + std::chrono::seconds{ value };
+		return;
+	}
+
+	size_t interval_start = is_weight ? weight_prefix.size() : order_prefix.size();
+	std::string interval{ header.substr(interval_start, value_start - interval_start) };
+	std::transform(interval.begin(), interval.end(), interval.begin(), [](unsigned char c) { return std::tolower(c); });
+
+	if (is_weight)
+	{
+		this->_used_weight[interval] = value;
+		if (interval == "1m") this->_weight_bucket.reconcile(value);
+	}
+	else
+	{
+		this->_order_count[interval] = value;
+		if (interval == "10s") this->_order_bucket.reconcile(value);
+	}
+}
+
+/**
+	Get the used weight as last reported by the exchange
+	@param interval - the interval of the limit (i.e: "1m")
+	@return the used weight, 0 if not reported
+*/
+unsigned int RateLimiter::used_weight(const std::string& interval)
+{
+	std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+
+	auto used_itr = this->_used_weight.find(interval);
+	return used_itr == this->_used_weight.end() ? 0 : used_itr->second;
+}
+
+/**
+	Get the order count as last reported by the exchange
+	@param interval - the interval of the limit (i.e: "10s", "1d")
+	@return the order count, 0 if not reported
+*/
+unsigned int RateLimiter::order_count(const std::string& interval)
+{
+	std::lock_guard<std::mutex> limiter_guard(this->_limiter_lock);
+
+	auto count_itr = this->_order_count.find(interval);
+	return count_itr == this->_order_count.end() ? 0 : count_itr->second;
+}
+
+/**
+	Constructor
+	@param request_type - the type of the requests of the endpoint
+	@param path - the path of the endpoint
+*/
+EndpointStats::EndpointStats(const RestRequestType request_type, std::string_view path)
+	: request_type{ request_type }, path{ path }, requests{ 0 }, new_connections{ 0 }, transport_errors{ 0 }, http_errors{ 0 }
+{}
+
+/**
+	Clear all timings and counters - requests recorded during the reset may be partially kept
+*/
+void EndpointStats::reset()
+{
+	for (LatencyHistogram* histogram : { &this->dns, &this->connect, &this->tls, &this->first_byte, &this->total })
+	{
+		histogram->reset();
+	}
+	this->requests = 0;
+	this->new_connections = 0;
+	this->transport_errors = 0;
+	this->http_errors = 0;
+
+	std::lock_guard<std::mutex> errors_guard(this->errors_lock);
+	this->error_statuses.clear();
+	this->error_codes.clear();
+}
+
+/**
+	Constructor
+*/
+RestStats::RestStats()
+	: _used_slots{ 0 }
+{
+	for (std::atomic<EndpointStats*>& endpoint_slot : this->_endpoint_slots)
+	{
+		endpoint_slot.store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+/**
+	Record a finished transfer - before the handle is returned to its pool
+	@param handle - the handle of the request
+	@param request_type - the type of the request
+	@param result - the result of the transfer
+	@param response - the body of the response
+*/
+void RestStats::record(CURL* handle, const RestRequestType request_type, const CURLcode result, std::string_view response)
+{
+	char* url{ nullptr };
+	curl_easy_getinfo(handle, CURLINFO_EFFECTIVE_URL, &url);
+	EndpointStats* endpoint = this->_endpoint_of(url ? std::string_view{ url } : std::string_view{}, request_type);
+
+	endpoint->requests.fetch_add(1, std::memory_order_relaxed);
+	if (result != CURLE_OK)
+	{
+		endpoint->transport_errors.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+
+	curl_off_t dns_time{ 0 }, connect_time{ 0 }, tls_time{ 0 }, first_byte_time{ 0 }, total_time{ 0 }; // microseconds from the start of the request
+	curl_easy_getinfo(handle, CURLINFO_NAMELOOKUP_TIME_T, &dns_time);
+	curl_easy_getinfo(handle, CURLINFO_CONNECT_TIME_T, &connect_time);
+	curl_easy_getinfo(handle, CURLINFO_APPCONNECT_TIME_T, &tls_time);
+	curl_easy_getinfo(handle, CURLINFO_STARTTRANSFER_TIME_T, &first_byte_time);
+	curl_easy_getinfo(handle, CURLINFO_TOTAL_TIME_T, &total_time);
+
+	long new_connects{ 0 }; // connections created for this transfer - the connect time is also set for reused connections
+	curl_easy_getinfo(handle, CURLINFO_NUM_CONNECTS, &new_connects);
+	if (new_connects > 0)
+	{
+		endpoint->new_connections.fetch_add(1, std::memory_order_relaxed);
+		endpoint->dns.record(dns_time);
+		endpoint->connect.record(connect_time - dns_time);
+		if (tls_time > connect_time) endpoint->tls.record(tls_time - connect_time);
+	}
+	endpoint->first_byte.record(first_byte_time);
+	endpoint->total.record(total_time);
+
+	long status{ 0 };
+	curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &status);
+	if (status >= 400)
+	{
+		endpoint->http_errors.fetch_add(1, std::memory_order_relaxed);
+		const int error_code = RestStats::_error_code(response);
+
+		std::lock_guard<std::mutex> errors_guard(endpoint->errors_lock);
+		endpoint->error_statuses[status]++;
+		if (error_code) endpoint->error_codes[error_code]++;
+	}
+}
+
+/**
+	Get (or create) the stats of the endpoint of a request - known endpoints are found in the slots without locks or allocations
+	@param full_path - the full path of the request
+	@param request_type - the type of the request
+	@return the stats of the endpoint - valid until this object is destroyed
+*/
+EndpointStats* RestStats::_endpoint_of(std::string_view full_path, const RestRequestType request_type)
+{
+	size_t path_start = full_path.find("://");
+	path_start = full_path.find('/', path_start == std::string_view::npos ? 0 : path_start + 3);
+	std::string_view path = path_start == std::string_view::npos ? std::string_view{ "/" } : full_path.substr(path_start, full_path.find('?', path_start) - path_start);
+
+	const size_t path_hash = RestStats::_slot_of(path, request_type);
+	for (size_t probe = 0; probe < _ENDPOINT_SLOTS; probe++)
+	{
+		EndpointStats* endpoint = this->_endpoint_slots[(path_hash + probe) & (_ENDPOINT_SLOTS - 1)].load(std::memory_order_acquire);
+		if (!endpoint) break; // slots are only filled, so the endpoint is not in the slots
+		if (endpoint->request_type == request_type && endpoint->path == path) return endpoint;
+	}
+
+	return this->_add_endpoint(path, request_type, path_hash);
+}
+
+/**
+	Get (or create) the stats of an endpoint under the lock, and publish them in the slots while less than half are used
+	@param path - the path of the endpoint
+	@param request_type - the type of the request
+	@param path_hash - the hash of the endpoint ('_slot_of()')
+	@return the stats of the endpoint
+*/
+EndpointStats* RestStats::_add_endpoint(std::string_view path, const RestRequestType request_type, const size_t path_hash)
+{
+	std::string key{};
+	switch (request_type)
+	{
+	case RestRequestType::post_request: key = "POST "; break;
+	case RestRequestType::put_request: key = "PUT "; break;
+	case RestRequestType::delete_request: key = "DELETE "; break;
+	default: key = "GET "; break;
+	}
+	key.append(path);
+
+	std::lock_guard<std::mutex> stats_guard(this->_stats_lock);
+	EndpointStats*& endpoint = this->_endpoints[key];
+	if (endpoint) return endpoint; // added by another thread, or past the slots
+
+	endpoint = new EndpointStats{ request_type, path };
+	if (this->_used_slots < _ENDPOINT_SLOTS / 2)
+	{
+		size_t slot = path_hash & (_ENDPOINT_SLOTS - 1);
+		while (this->_endpoint_slots[slot].load(std::memory_order_relaxed)) slot = (slot + 1) & (_ENDPOINT_SLOTS - 1);
+
+		this->_endpoint_slots[slot].store(endpoint, std::memory_order_release); // the stats are constructed before they are seen
+		this->_used_slots++;
+	}
+
+	return endpoint;
+}
+
+/**
+	Hash an endpoint
+	@param path - the path of the endpoint
+	@param request_type - the type of the request
+	@return the hash, the first slot of the endpoint
+*/
+size_t RestStats::_slot_of(std::string_view path, const RestRequestType request_type)
+{
+	return std::hash<std::string_view>{}(path) + static_cast<size_t>(request_type) * 0x9E3779B97F4A7C15ull;
+}
+
+/**
+	Find the error code of an error response without parsing it ({"code":-1021,"msg":"..."})
+	@param response - the body of the response
+	@return the code, 0 if none
+*/
+int RestStats::_error_code(std::string_view response)
+{
+	const size_t key_pos = response.find("\"code\":");
+	if (key_pos == std::string_view::npos) return 0;
+
+	int error_code{ 0 };
+	std::from_chars(response.data() + key_pos + 7, response.data() + response.size(), error_code);
+	return error_code;
+}
+
+/**
+	Get the stats of all endpoints
+	@return a snapshot of each endpoint, sorted by endpoint
+*/
+std::vector<EndpointSnapshot> RestStats::snapshot() const
+{
+	std::vector<EndpointSnapshot> snapshots{};
+	std::lock_guard<std::mutex> stats_guard(this->_stats_lock);
+	snapshots.reserve(this->_endpoints.size());
+
+	for (const std::pair<const std::string, EndpointStats*>& endpoint : this->_endpoints)
+	{
+		EndpointSnapshot snapshot{};
+		snapshot.endpoint = endpoint.first;
+		snapshot.requests = endpoint.second->requests.load(std::memory_order_relaxed);
+		snapshot.new_connections = endpoint.second->new_connections.load(std::memory_order_relaxed);
+		snapshot.transport_errors = endpoint.second->transport_errors.load(std::memory_order_relaxed);
+		snapshot.http_errors = endpoint.second->http_errors.load(std::memory_order_relaxed);
+		{
+			std::lock_guard<std::mutex> errors_guard(endpoint.second->errors_lock);
+			snapshot.error_statuses = endpoint.second->error_statuses;
+			snapshot.error_codes = endpoint.second->error_codes;
+		}
+		snapshot.dns = endpoint.second->dns.snapshot();
+		snapshot.connect = endpoint.second->connect.snapshot();
+		snapshot.tls = endpoint.second->tls.snapshot();
+		snapshot.first_byte = endpoint.second->first_byte.snapshot();
+		snapshot.total = endpoint.second->total.snapshot();
+
+		snapshots.push_back(std::move(snapshot));
+	}
+
+	std::sort(snapshots.begin(), snapshots.end(), [](const EndpointSnapshot& first, const EndpointSnapshot& second) { return first.endpoint < second.endpoint; });
+	return snapshots;
+}
+
+/**
+	The stats of all endpoints as text - timings in microseconds
+	@return the report, a few lines per endpoint
+*/
+std::string RestStats::report() const
+{
+	std::vector<std::pair<std::string, EndpointStats*>> endpoints{}; // stats are not removed until destroyed
+	{
+		std::lock_guard<std::mutex> stats_guard(this->_stats_lock);
+		endpoints.assign(this->_endpoints.begin(), this->_endpoints.end());
+	}
+	std::sort(endpoints.begin(), endpoints.end());
+
+	std::string report{};
+	for (const std::pair<std::string, EndpointStats*>& endpoint_pair : endpoints)
+	{
+		EndpointStats* endpoint = endpoint_pair.second;
+		report += endpoint_pair.first + " requests=" + std::to_string(endpoint->requests.load()) +
+			" new_connections=" + std::to_string(endpoint->new_connections.load()) +
+			" transport_errors=" + std::to_string(endpoint->transport_errors.load()) +
+			" http_errors=" + std::to_string(endpoint->http_errors.load()) + "\n";
+		report += "  total_us: " + endpoint->total.summary() + "\n";
+		report += "  first_byte_us: " + endpoint->first_byte.summary() + "\n";
+		report += "  dns_us: " + endpoint->dns.summary() + "\n";
+		report += "  connect_us: " + endpoint->connect.summary() + "\n";
+		report += "  tls_us: " + endpoint->tls.summary() + "\n";
+
+		std::lock_guard<std::mutex> errors_guard(endpoint->errors_lock);
+		if (endpoint->error_statuses.empty()) continue;
+
+		report += "  errors:";
+		for (const std::pair<const long, uint64_t>& error_status : endpoint->error_statuses)
+		{
+			report += " http_" + std::to_string(error_status.first) + "=" + std::to_string(error_status.second);
+		}
+		for (const std::pair<const int, uint64_t>& error_code : endpoint->error_codes)
+		{
+			report += " code_" + std::to_string(error_code.first) + "=" + std::to_string(error_code.second);
+		}
+		report += "\n";
+	}
+
+	return report;
+}
+
+/**
+	Clear the stats of all endpoints - endpoints are kept
+*/
+void RestStats::reset()
+{
+	std::lock_guard<std::mutex> stats_guard(this->_stats_lock);
+	for (std::pair<const std::string, EndpointStats*>& endpoint : this->_endpoints)
+	{
+		endpoint.second->reset();
+	}
+}
+
+/**
+	Destructor
+*/
+RestStats::~RestStats()
+{
+	for (std::pair<const std::string, EndpointStats*>& endpoint : this->_endpoints)
+	{
+		delete endpoint.second;
+	}
+}
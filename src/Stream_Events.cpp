@@ -0,0 +1,352 @@
+#include "../include/Binance_Client.h"
+
+//  ------------------------------ Start | EventDecoder methods
+
+thread_local simdjson::ondemand::parser EventDecoder::_parser{};
+
+/**
+	Decode an aggregate trade event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, AggTradeEvent& event)
+{
+	event = AggTradeEvent{};
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "a") error = value.get_uint64().get(event.aggregate_trade_id);
+		else if (key == "p") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.price);
+		else if (key == "q") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.quantity);
+		else if (key == "f") error = value.get_uint64().get(event.first_trade_id);
+		else if (key == "l") error = value.get_uint64().get(event.last_trade_id);
+		else if (key == "T") error = value.get_uint64().get(event.trade_time);
+		else if (key == "m") error = value.get_bool().get(event.buyer_is_maker);
+		if (error) return error;
+	}
+
+	return event.symbol.empty() ? simdjson::NO_SUCH_FIELD : simdjson::SUCCESS;
+}
+
+/**
+	Decode a trade event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, TradeEvent& event)
+{
+	event = TradeEvent{};
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "t") error = value.get_uint64().get(event.trade_id);
+		else if (key == "p") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.price);
+		else if (key == "q") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.quantity);
+		else if (key == "T") error = value.get_uint64().get(event.trade_time);
+		else if (key == "m") error = value.get_bool().get(event.buyer_is_maker);
+		if (error) return error;
+	}
+
+	return event.symbol.empty() ? simdjson::NO_SUCH_FIELD : simdjson::SUCCESS;
+}
+
+/**
+	Decode a kline event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, KlineEvent& event)
+{
+	event = KlineEvent{};
+	bool has_kline{ 0 };
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "k")
+		{
+			simdjson::ondemand::object kline;
+			if ((error = value.get_object().get(kline))) return error;
+			has_kline = 1;
+
+			for (simdjson::simdjson_result<simdjson::ondemand::field> kline_field_result : kline)
+			{
+				simdjson::ondemand::field kline_field;
+				error = std::move(kline_field_result).get(kline_field);
+				if (!error) error = kline_field.unescaped_key().get(key);
+				if (error) return error;
+
+				simdjson::ondemand::value& kline_value = kline_field.value();
+				if (key == "t") error = kline_value.get_uint64().get(event.start_time);
+				else if (key == "T") error = kline_value.get_uint64().get(event.close_time);
+				else if (key == "i") error = kline_value.get_string().get(event.interval);
+				else if (key == "f") error = kline_value.get_int64().get(event.first_trade_id);
+				else if (key == "L") error = kline_value.get_int64().get(event.last_trade_id);
+				else if (key == "o") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.open);
+				else if (key == "c") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.close);
+				else if (key == "h") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.high);
+				else if (key == "l") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.low);
+				else if (key == "v") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.volume);
+				else if (key == "n") error = kline_value.get_uint64().get(event.trades);
+				else if (key == "x") error = kline_value.get_bool().get(event.closed);
+				else if (key == "q") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.quote_volume);
+				else if (key == "V") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.taker_buy_volume);
+				else if (key == "Q") error = EventDecoder::_decode_decimal(kline_value.get_raw_json_string(), event.taker_buy_quote_volume);
+				if (error) return error;
+			}
+		}
+		if (error) return error;
+	}
+
+	return has_kline ? simdjson::SUCCESS : simdjson::NO_SUCH_FIELD;
+}
+
+/**
+	Decode a book ticker event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, BookTickerEvent& event)
+{
+	event = BookTickerEvent{};
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "u") error = value.get_uint64().get(event.update_id);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "b") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.bid_price);
+		else if (key == "B") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.bid_quantity);
+		else if (key == "a") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.ask_price);
+		else if (key == "A") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.ask_quantity);
+		else if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "T") error = value.get_uint64().get(event.transaction_time);
+		if (error) return error;
+	}
+
+	return event.symbol.empty() ? simdjson::NO_SUCH_FIELD : simdjson::SUCCESS;
+}
+
+/**
+	Decode a depth update (or partial depth) event
+	@param object - the event
+	@param event - the event struct to fill - the levels keep their capacity
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, DepthUpdateEvent& event)
+{
+	event.event_time = 0;
+	event.transaction_time = 0;
+	event.symbol = std::string_view{};
+	event.first_update_id = 0;
+	event.final_update_id = 0;
+	event.previous_final_update_id = 0;
+	event.bids.clear();
+	event.asks.clear();
+	bool has_levels{ 0 };
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "T") error = value.get_uint64().get(event.transaction_time);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "U") error = value.get_uint64().get(event.first_update_id);
+		else if (key == "u" || key == "lastUpdateId") error = value.get_uint64().get(event.final_update_id);
+		else if (key == "pu") error = value.get_uint64().get(event.previous_final_update_id);
+		else if (key == "b" || key == "bids")
+		{
+			error = EventDecoder::_decode_levels(value, event.bids);
+			has_levels = 1;
+		}
+		else if (key == "a" || key == "asks")
+		{
+			error = EventDecoder::_decode_levels(value, event.asks);
+			has_levels = 1;
+		}
+		if (error) return error;
+	}
+
+	return has_levels ? simdjson::SUCCESS : simdjson::NO_SUCH_FIELD;
+}
+
+/**
+	Decode a decimal string ("27100.10") - at the scale of the string, without unescaping it
+	@param raw_result - the raw string
+	@param decimal - the value to set
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode_decimal(simdjson::simdjson_result<simdjson::ondemand::raw_json_string> raw_result, Decimal& decimal)
+{
+	simdjson::ondemand::raw_json_string raw_string;
+	simdjson::error_code error = std::move(raw_result).get(raw_string);
+	if (error) return error;
+
+	const char* string_end = raw_string.raw();
+	while (*string_end != '"') string_end++; // the closing quote was found by the parser
+
+	return Decimal::parse(std::string_view{ raw_string.raw(), static_cast<size_t>(string_end - raw_string.raw()) }, decimal) ? simdjson::SUCCESS : simdjson::NUMBER_ERROR;
+}
+
+/**
+	Decode the levels of a depth event ([["price","quantity"], ...])
+	@param value - the array of levels
+	@param levels - the vector to append the levels to
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode_levels(simdjson::ondemand::value& value, std::vector<PriceLevel>& levels)
+{
+	simdjson::ondemand::array levels_array;
+	simdjson::error_code error = value.get_array().get(levels_array);
+	if (error) return error;
+
+	for (simdjson::simdjson_result<simdjson::ondemand::value> level_result : levels_array)
+	{
+		simdjson::ondemand::array level;
+		if ((error = level_result.get_array().get(level))) return error;
+
+		PriceLevel price_level{};
+		unsigned int index{ 0 };
+		for (simdjson::simdjson_result<simdjson::ondemand::value> number : level)
+		{
+			if (index == 0) error = EventDecoder::_decode_decimal(number.get_raw_json_string(), price_level.price);
+			else if (index == 1) error = EventDecoder::_decode_decimal(number.get_raw_json_string(), price_level.quantity);
+			if (error) return error;
+			index++;
+		}
+		levels.push_back(price_level);
+	}
+
+	return simdjson::SUCCESS;
+}
+
+/**
+	Decode a mark price event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, MarkPriceEvent& event)
+{
+	event = MarkPriceEvent{};
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "s") error = value.get_string().get(event.symbol);
+		else if (key == "p") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.mark_price);
+		else if (key == "i") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.index_price);
+		else if (key == "P") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.estimated_settle_price);
+		else if (key == "r") error = EventDecoder::_decode_decimal(value.get_raw_json_string(), event.funding_rate);
+		else if (key == "T") error = value.get_uint64().get(event.next_funding_time);
+		if (error) return error;
+	}
+
+	return event.symbol.empty() ? simdjson::NO_SUCH_FIELD : simdjson::SUCCESS;
+}
+
+/**
+	Decode a liquidation order event
+	@param object - the event
+	@param event - the event struct to fill
+	@return an error code, SUCCESS if decoded
+*/
+simdjson::error_code EventDecoder::_decode(simdjson::ondemand::object& object, ForceOrderEvent& event)
+{
+	event = ForceOrderEvent{};
+	bool has_order{ 0 };
+
+	for (simdjson::simdjson_result<simdjson::ondemand::field> field_result : object)
+	{
+		simdjson::ondemand::field field;
+		std::string_view key;
+		simdjson::error_code error = std::move(field_result).get(field);
+		if (!error) error = field.unescaped_key().get(key);
+		if (error) return error;
+
+		simdjson::ondemand::value& value = field.value();
+		if (key == "E") error = value.get_uint64().get(event.event_time);
+		else if (key == "o")
+		{
+			simdjson::ondemand::object order;
+			if ((error = value.get_object().get(order))) return error;
+			has_order = 1;
+
+			for (simdjson::simdjson_result<simdjson::ondemand::field> order_field_result : order)
+			{
+				simdjson::ondemand::field order_field;
+				error = std::move(order_field_result).get(order_field);
+				if (!error) error = order_field.unescaped_key().get(key);
+				if (error) return error;
+
+				simdjson::ondemand::value& order_value = order_field.value();
+				if (key == "s") error = order_value.get_string().get(event.symbol);
+				else if (key == "S") error = order_value.get_string().get(event.side);
+				else if (key == "o") error = order_value.get_string().get(event.order_type);
+				else if (key == "f") error = order_value.get_string().get(event.time_in_force);
+				else if (key == "q") error = EventDecoder::_decode_decimal(order_value.get_raw_json_string(), event.quantity);
+				else if (key == "p") error = EventDecoder::_decode_decimal(order_value.get_raw_json_string(), event.price);
+				else if (key == "ap") error = EventDecoder::_decode_decimal(order_value.get_raw_json_string(), event.average_price);
+				else if (key == "X") error = order_value.get_string().get(event.status);
+				else if (key == "l") error = EventDecoder::_decode_decimal(order_value.get_raw_json_string(), event.last_filled_quantity);
+				else if (key == "z") error = EventDecoder::_decode_decimal(order_value.get_raw_json_string(), event.filled_quantity);
+				else if (key == "T") error = order_value.get_uint64().get(event.trade_time);
+				if (error) return error;
+			}
+		}
+		if (error) return error;
+	}
+
+	return has_order ? simdjson::SUCCESS : simdjson::NO_SUCH_FIELD;
+}
+
+//  ------------------------------ End | EventDecoder methods
@@ -8,7 +8,7 @@
 */
 template <typename T>
 WebsocketClient<T>::WebsocketClient(T* exchange_client, const std::string host, const unsigned int port)
-    : _host{ host }, _port{ std::to_string(port) }, _reconnect_on_error{ 0 }, exchange_client { exchange_client }, _max_reconnect_count{ 20 }, _gzip_conversion { 0 }
+    : _host{ host }, _port{ std::to_string(port) }, _gzip_conversion { 0 }, exchange_client { exchange_client }, _context_pool{ nullptr }, _measure_latency{ 0 }, _max_reconnect_count{ 20 }, _reconnect_on_error{ 0 }
 {}
 
 /**
@@ -20,7 +20,7 @@ void WebsocketClient<T>::close_stream(const std::string& full_stream_name)
 {
 	try
 	{
-		this->running_streams[full_stream_name] = 0;
+		this->_streams.stop(full_stream_name);
 	}
 	catch(...)
 	{
@@ -37,15 +37,7 @@ void WebsocketClient<T>::close_stream(const std::string& full_stream_name)
 template <typename T>
 std::vector<std::string> WebsocketClient<T>::open_streams()
 {
-	std::unordered_map<std::string, bool>::iterator itr;
-	std::vector<std::string> results;
-
-	for (itr = this->running_streams.begin(); itr != this->running_streams.end(); itr++)
-	{
-		if (itr->second) results.push_back(itr->first);
-	}
-
-	return results;
+	return this->_streams.open_streams();
 };
 
 /**
@@ -56,14 +48,7 @@ std::vector<std::string> WebsocketClient<T>::open_streams()
 template <typename T>
 bool WebsocketClient<T>::is_open(const std::string& full_stream_name) const
 {
-	std::unordered_map<std::string, bool>::const_iterator itr;
-
-	for (itr = this->running_streams.begin(); itr != this->running_streams.end(); itr++)
-	{
-		if (itr->first == full_stream_name) return itr->second;
-	}
-
-	return 0; 
+	return this->_streams.is_open(full_stream_name);
 };
 
 /**
@@ -104,23 +89,1605 @@ void WebsocketClient<T>::set_gzip_conversion(const unsigned int state)
 	this->_gzip_conversion = state;
 }
 
+/**
+	Sets a pool of io_contexts for new streams
+	streams opened while a pool is set run asynchronously on its threads, instead of blocking the calling thread
+	@param context_pool - the pool (not owned, must outlive the client), nullptr for blocking streams
+*/
+template <typename T>
+void WebsocketClient<T>::set_context_pool(WebsocketContextPool* context_pool)
+{
+	this->_context_pool = context_pool;
+}
+
+/**
+	Sets the capacity kept by the receive buffers of new streams
+	@param reserve - bytes reserved before the first message, and after shrinking
+	@param max_capacity - a buffer grown beyond it by a large message is shrunk back to 'reserve' -
+		should be well above the read size of the stream (1536 bytes), or buffers are shrunk after each message
+*/
+template <typename T>
+void WebsocketClient<T>::set_receive_buffer(const size_t reserve, const size_t max_capacity)
+{
+	this->_receive_buffer = ReceiveBufferPolicy{ reserve, max_capacity };
+}
+
+/**
+	Open a connection for subscribing to streams - requires a context pool
+	the connection is owned by this client, and closed when the client is destroyed
+	@return a pointer to the open connection
+*/
+template <typename T>
+StreamConnection* WebsocketClient<T>::open_connection()
+{
+	if (!this->_context_pool)
+	{
+		CustomException e{ "ws_connection_requires_context_pool" };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+
+	StreamConnection* connection = new StreamConnection{ this->_context_pool, this->_host, this->_port, static_cast<bool>(this->_gzip_conversion), this->_reconnect_on_error, this->_max_reconnect_count };
+	try
+	{
+		connection->open();
+	}
+	catch (ClientException& e)
+	{
+		delete connection;
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw;
+	}
+
+	std::unique_lock<std::mutex> connections_lock{ this->_connections_lock };
+	this->_connections.push_back(connection);
+
+	return connection;
+}
+
+/**
+	Set whether the latency of new streams is measured - off by default
+	@param state - the state
+*/
+template <typename T>
+void WebsocketClient<T>::set_latency_stats(const bool state)
+{
+	this->_measure_latency = state;
+}
+
+/**
+	Get the latency histograms of a stream - kept after the stream is closed, and shared with the stream if it is reopened
+	@param stream_name - the name of the stream
+	@return a pointer to the histograms, null if the stream was not measured
+*/
+template <typename T>
+std::shared_ptr<const StreamLatency> WebsocketClient<T>::latency_stats(const std::string& stream_name) const
+{
+	std::unique_lock<std::mutex> latency_lock{ this->_latency_lock };
+	typename std::unordered_map<std::string, std::shared_ptr<StreamLatency>>::const_iterator latency_itr = this->_latency_stats.find(stream_name);
+	return latency_itr == this->_latency_stats.end() ? nullptr : latency_itr->second;
+}
+
+/**
+	Percentiles of the latency of all measured streams, in microseconds
+	@return the report of each stream, after a line with its name
+*/
+template <typename T>
+std::string WebsocketClient<T>::latency_report() const
+{
+	std::unique_lock<std::mutex> latency_lock{ this->_latency_lock };
+	std::string report{};
+	for (const std::pair<const std::string, std::shared_ptr<StreamLatency>>& stream_latency : this->_latency_stats)
+	{
+		report += stream_latency.first + "\n" + stream_latency.second->report();
+	}
+	return report;
+}
+
+/**
+	Clear the latency histograms of all streams
+*/
+template <typename T>
+void WebsocketClient<T>::reset_latency_stats()
+{
+	std::unique_lock<std::mutex> latency_lock{ this->_latency_lock };
+	for (std::pair<const std::string, std::shared_ptr<StreamLatency>>& stream_latency : this->_latency_stats)
+	{
+		stream_latency.second->reset();
+	}
+}
+
+/**
+	Get (or create) the latency histograms of a new stream
+	@param stream_map_name - the name of the stream
+	@return a pointer to the histograms, null if latency is not measured
+*/
+template <typename T>
+std::shared_ptr<StreamLatency> WebsocketClient<T>::_stream_latency(const std::string& stream_map_name)
+{
+	if (!this->_measure_latency) return nullptr;
+
+	std::unique_lock<std::mutex> latency_lock{ this->_latency_lock };
+	std::shared_ptr<StreamLatency>& stream_latency = this->_latency_stats[stream_map_name];
+	if (!stream_latency) stream_latency = std::make_shared<StreamLatency>();
+	return stream_latency;
+}
+
+/**
+	Start a stream on the context pool and wait until it is open
+	@param stream_map_name - The name of the stream
+	@param stream_path - The path of the string (query)
+	@param buf - a reference of the string buffer to load responses to - must outlive the stream
+	@param on_message - called with 'buf' for each message, from the thread of the context
+*/
+template <typename T>
+void WebsocketClient<T>::_start_async_stream(const std::string& stream_map_name, const std::string& stream_path, std::string& buf, std::function<void(std::string&)> on_message)
+{
+	std::shared_ptr<StreamHandle> stream_handle = std::make_shared<StreamHandle>(stream_map_name);
+	const StreamHandle* handle_ptr = stream_handle.get();
+	stream_handle->async_stream = std::make_shared<AsyncStream>(this->_context_pool, this->_host, this->_port, stream_path, buf,
+		std::move(on_message),
+		[this, stream_map_name, handle_ptr](AsyncStream*) { this->_streams.remove(stream_map_name, handle_ptr); }, // a replaced handle is not removed
+		this->_gzip_conversion, this->_reconnect_on_error, this->_max_reconnect_count);
+	stream_handle->async_stream->set_receive_buffer(this->_receive_buffer);
+	stream_handle->latency = this->_stream_latency(stream_map_name);
+	stream_handle->async_stream->set_latency(stream_handle->latency);
+	this->_streams.add(stream_handle); // replaces (and closes) a stream of the same name
+
+	std::future<bool> opened = stream_handle->async_stream->start();
+	if (!stream_handle->running) stream_handle->async_stream->close(); // closed before started
+	if (!opened.get())
+	{
+		BadStreamOpenWS e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+
+	stream_handle->open = 1;
+}
+
 /**
 	Destructor
 	setting 'exchange_client' to nullptr to avoid deleting an external exchange client
 	iterates over open streams and closes them one by one
+	closes the connections, and waits for async streams to close, since their callbacks refer to this client
 */
 template <typename T>
 WebsocketClient<T>::~WebsocketClient()
 {
 	this->exchange_client = nullptr;
-    std::unordered_map<std::string, bool>::iterator stream_itr; // while status != 0: set 0 and delete thread pointer!
+	this->_streams.stop_all(); // set status to false to ensure closing streams
+
+	for (StreamConnection* connection : this->_connections)
+	{
+		delete connection;
+	}
+
+	this->_streams.wait_async_streams();
+}
+
+
+//  ------------------------------ Start | StreamRegistry methods
+
+/**
+	Constructor
+	@param stream_name - the name of the stream
+*/
+StreamHandle::StreamHandle(const std::string& stream_name)
+	: name{ stream_name }, running{ 1 }, open{ 0 }, async_stream{ nullptr }
+{}
+
+/**
+	Add a stream - a stream of the same name is closed and replaced
+	@param handle - the handle of the stream
+*/
+void StreamRegistry::add(std::shared_ptr<StreamHandle> handle)
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	std::shared_ptr<StreamHandle>& registered_handle = this->_handles[handle->name];
+	if (registered_handle)
+	{
+		StreamRegistry::_stop(*registered_handle);
+		if (registered_handle->async_stream) this->_replaced_handles.push_back(std::move(registered_handle)); // its callbacks may still run
+	}
+	registered_handle = std::move(handle);
+}
+
+/**
+	Remove a stream that is done
+	@param stream_name - the name of the stream
+	@param handle - the handle of the stream - removed from the replaced handles if it was replaced (the handle is not accessed)
+*/
+void StreamRegistry::remove(const std::string& stream_name, const StreamHandle* handle)
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	std::unordered_map<std::string, std::shared_ptr<StreamHandle>>::iterator handle_itr = this->_handles.find(stream_name);
+	if (handle_itr != this->_handles.end() && handle_itr->second.get() == handle)
+	{
+		this->_handles.erase(handle_itr);
+	}
+	else
+	{
+		std::vector<std::shared_ptr<StreamHandle>>::iterator replaced_itr = std::find_if(this->_replaced_handles.begin(), this->_replaced_handles.end(),
+			[handle](const std::shared_ptr<StreamHandle>& replaced_handle) { return replaced_handle.get() == handle; });
+		if (replaced_itr != this->_replaced_handles.end()) this->_replaced_handles.erase(replaced_itr);
+	}
+	this->_handle_removed.notify_all(); // while locked - the waiter may destroy the registry once it wakes
+}
+
+/**
+	Close a stream - returns immediately
+	@param stream_name - the name of the stream
+	@return a bool for whether the stream was found
+*/
+bool StreamRegistry::stop(const std::string& stream_name)
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	std::unordered_map<std::string, std::shared_ptr<StreamHandle>>::iterator handle_itr = this->_handles.find(stream_name);
+	if (handle_itr == this->_handles.end()) return 0;
+
+	StreamRegistry::_stop(*handle_itr->second);
+	return 1;
+}
+
+/**
+	Close all streams - returns immediately
+*/
+void StreamRegistry::stop_all()
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	for (std::pair<const std::string, std::shared_ptr<StreamHandle>>& handle : this->_handles)
+	{
+		StreamRegistry::_stop(*handle.second);
+	}
+}
 
-    for (stream_itr = this->running_streams.begin(); stream_itr != this->running_streams.end(); stream_itr++)
-    {
-        this->close_stream(stream_itr->first); // set status to false to ensure closing streams
-    }
+/**
+	Wait until all async streams are done, including replaced streams that are still closing
+*/
+void StreamRegistry::wait_async_streams()
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	this->_handle_removed.wait(registry_lock, [this]()
+		{
+			if (!this->_replaced_handles.empty()) return false;
+			for (std::pair<const std::string, std::shared_ptr<StreamHandle>>& handle : this->_handles)
+			{
+				if (handle.second->async_stream) return false;
+			}
+			return true;
+		});
+}
+
+/**
+	Checks whether a stream is open
+	@param stream_name - the name of the stream
+	@return a bool for whether is open or not
+*/
+bool StreamRegistry::is_open(const std::string& stream_name) const
+{
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	std::unordered_map<std::string, std::shared_ptr<StreamHandle>>::const_iterator handle_itr = this->_handles.find(stream_name);
+
+	return handle_itr != this->_handles.end() && handle_itr->second->running && handle_itr->second->open;
+}
+
+/**
+	Get open streams
+	@return a vector containing the names of open streams
+*/
+std::vector<std::string> StreamRegistry::open_streams() const
+{
+	std::vector<std::string> results;
+
+	std::unique_lock<std::mutex> registry_lock{ this->_registry_lock };
+	for (const std::pair<const std::string, std::shared_ptr<StreamHandle>>& handle : this->_handles)
+	{
+		if (handle.second->running && handle.second->open) results.push_back(handle.first);
+	}
+
+	return results;
+}
+
+/**
+	Close a stream - '_registry_lock' must be held
+	@param handle - the handle of the stream
+*/
+void StreamRegistry::_stop(StreamHandle& handle)
+{
+	handle.running = 0;
+	if (handle.async_stream) handle.async_stream->close();
+}
+
+//  ------------------------------ End | StreamRegistry methods
+
+
+//  ------------------------------ Start | WebsocketContextPool methods
+
+/**
+	Constructor
+	@param threads - number of io_contexts, each run by one thread
+*/
+WebsocketContextPool::WebsocketContextPool(const unsigned int threads)
+	: _next_context{ 0 }, _ssl_context{ ssl::context::tlsv12_client }
+{
+	unsigned int context_count = threads ? threads : 1;
+
+	for (unsigned int i = 0; i < context_count; i++)
+	{
+		net::io_context* ioc = new net::io_context{ 1 }; // one thread per context
+		this->_contexts.push_back(ioc);
+		this->_work_guards.push_back(new net::executor_work_guard<net::io_context::executor_type>{ ioc->get_executor() });
+		this->_threads.push_back(new std::thread{ [ioc]() { ioc->run(); } });
+	}
+}
+
+/**
+	Get the context for a new stream - round robin
+	@return a reference to the context
+*/
+net::io_context& WebsocketContextPool::next_context()
+{
+	return *this->_contexts[this->_next_context++ % this->_contexts.size()];
+}
+
+/**
+	Get the SSL context shared by the streams of the pool
+	@return a reference to the SSL context
+*/
+ssl::context& WebsocketContextPool::ssl_context()
+{
+	return this->_ssl_context;
+}
+
+/**
+	Get the number of contexts (and threads) of the pool
+	@return the number of contexts
+*/
+unsigned int WebsocketContextPool::size() const
+{
+	return this->_contexts.size();
+}
+
+/**
+	Stop the contexts and join their threads
+	streams should be closed first - handlers that did not run are dropped
+*/
+void WebsocketContextPool::stop()
+{
+	for (net::executor_work_guard<net::io_context::executor_type>* work_guard : this->_work_guards)
+	{
+		work_guard->reset();
+		delete work_guard;
+	}
+	this->_work_guards.clear();
+
+	for (net::io_context* ioc : this->_contexts)
+	{
+		ioc->stop();
+	}
+
+	for (std::thread* context_thread : this->_threads)
+	{
+		if (context_thread->joinable()) context_thread->join();
+		delete context_thread;
+	}
+	this->_threads.clear();
+}
+
+/**
+	Destructor
+	stops the contexts and deletes them
+*/
+WebsocketContextPool::~WebsocketContextPool()
+{
+	this->stop();
+
+	for (net::io_context* ioc : this->_contexts)
+	{
+		delete ioc;
+	}
+}
+
+//  ------------------------------ End | WebsocketContextPool methods
+
+
+//  ------------------------------ Start | ReceiveBufferPolicy methods
+
+/**
+	Constructor
+	@param reserve - bytes reserved before the first message, and after shrinking
+	@param max_capacity - a buffer grown beyond it by a large message is shrunk back to 'reserve'
+*/
+ReceiveBufferPolicy::ReceiveBufferPolicy(const size_t reserve, const size_t max_capacity)
+	: reserve{ reserve }, max_capacity{ max_capacity }
+{}
+
+/**
+	Reserve the capacity of a buffer - before reading
+	@param buffer - the buffer
+*/
+void ReceiveBufferPolicy::prepare(std::string& buffer) const
+{
+	if (buffer.capacity() < this->reserve + simdjson::SIMDJSON_PADDING) buffer.reserve(this->reserve + simdjson::SIMDJSON_PADDING);
+}
+
+/**
+	Make sure a message read into a buffer is followed by SIMDJSON_PADDING bytes of capacity -
+	reallocates only if the message did not fit the reserved capacity
+	@param buffer - the buffer, holding the message
+*/
+void ReceiveBufferPolicy::pad(std::string& buffer) const
+{
+	if (buffer.capacity() < buffer.size() + simdjson::SIMDJSON_PADDING) buffer.reserve(buffer.size() + simdjson::SIMDJSON_PADDING);
+}
+
+/**
+	Shrink a buffer grown beyond 'max_capacity' - after the message is consumed
+	@param buffer - the (empty) buffer
+*/
+void ReceiveBufferPolicy::recycle(std::string& buffer) const
+{
+	if (buffer.capacity() <= this->max_capacity) return;
+
+	buffer.shrink_to_fit();
+	buffer.reserve(this->reserve + simdjson::SIMDJSON_PADDING);
+}
+
+//  ------------------------------ End | ReceiveBufferPolicy methods
+
+
+//  ------------------------------ Start | AsyncStream methods
+
+/**
+	Constructor - called by 'WebsocketClient::_start_async_stream()'
+	@param context_pool - the pool, a context is assigned to the stream
+	@param host - the host of the path
+	@param port - the port of the path
+	@param path - the path of the stream (query)
+	@param buffer - a reference of the string buffer to load responses to
+	@param on_message - called with the buffer for each message
+	@param on_close - called once when the stream is done
+	@param gzip_conversion - request binary messages when the stream is set up (options)
+	@param reconnect_on_error - reconnect if the connection is broken
+	@param max_reconnect_count - max number of attempts to reconnect
+*/
+AsyncStream::AsyncStream(WebsocketContextPool* context_pool, const std::string& host, const std::string& port, const std::string& path, std::string& buffer,
+	std::function<void(std::string&)> on_message, std::function<void(AsyncStream*)> on_close,
+	const bool gzip_conversion, const bool reconnect_on_error, const unsigned int max_reconnect_count)
+	: _ioc{ context_pool->next_context() }, _ssl_context{ context_pool->ssl_context() }, _resolver{ _ioc }, _reconnect_timer{ _ioc }, _ws{ nullptr },
+	_host{ host }, _port{ port }, _path{ path }, _buffer{ buffer }, _read_buffer{ buffer },
+	_on_message{ std::move(on_message) }, _on_close{ std::move(on_close) }, _connected{ 0 },
+	_gzip_conversion{ gzip_conversion }, _awaiting_conversion{ 0 }, _reconnect_on_error{ reconnect_on_error }, _max_reconnect_count{ max_reconnect_count }, _reconnect_attempts{ 0 },
+	_running{ 0 }, _closing{ 0 }, _finished{ 0 }, _open_reported{ 0 }
+{}
+
+/**
+	Set a callback for each time the stream is connected (and reconnected) - before 'start()'
+	called from the thread of the context, messages queued by it are sent first
+	@param on_open - the callback
+*/
+void AsyncStream::set_on_open(std::function<void()> on_open)
+{
+	this->_on_open = std::move(on_open);
+}
+
+/**
+	Set the capacity kept by the buffer - before 'start()'
+	@param receive_buffer - the policy
+*/
+void AsyncStream::set_receive_buffer(const ReceiveBufferPolicy& receive_buffer)
+{
+	this->_receive_buffer = receive_buffer;
+}
+
+/**
+	Measure the latency of each message - before 'start()'
+	@param latency - the histograms to record to, null to not measure
+*/
+void AsyncStream::set_latency(std::shared_ptr<StreamLatency> latency)
+{
+	this->_latency = std::move(latency);
 }
 
+/**
+	Start connecting - returns immediately
+	@return a future of whether the stream was opened
+*/
+std::future<bool> AsyncStream::start()
+{
+	std::future<bool> opened = this->_opened.get_future();
+	this->_running = 1;
+
+	std::shared_ptr<AsyncStream> self = this->shared_from_this();
+	net::post(this->_ioc, [self]() { self->_connect(); });
+
+	return opened;
+}
+
+/**
+	Send a message to the server - returns immediately
+	messages are written in order, and messages not yet written when the connection breaks are dropped
+	@param message - the message
+*/
+void AsyncStream::send(std::string message)
+{
+	std::shared_ptr<AsyncStream> self = this->shared_from_this();
+	net::post(this->_ioc, [self, message = std::move(message)]() mutable { self->queue_message(std::move(message)); });
+}
+
+/**
+	Queue a message to the server - from the thread of the context only (i.e: in 'on_open')
+	@param message - the message
+*/
+void AsyncStream::queue_message(std::string message)
+{
+	if (this->_finished) return;
+
+	this->_write_queue.push_back(std::move(message));
+	if (this->_connected && this->_write_queue.size() == 1) this->_write();
+}
+
+/**
+	Close the stream - returns immediately, 'on_close' is called when the stream is closed
+*/
+void AsyncStream::close()
+{
+	if (!this->_running.exchange(0)) return;
+
+	std::shared_ptr<AsyncStream> self = this->shared_from_this();
+	net::post(this->_ioc, [self]() { self->_close(websocket::close_code::normal); });
+}
+
+/**
+	Checks whether the stream is running (open, or reconnecting)
+	@return a bool for whether is running or not
+*/
+bool AsyncStream::is_running() const
+{
+	return this->_running;
+}
+
+/**
+	Open a new connection - resolve, TCP connect, SSL handshake, websocket handshake
+*/
+void AsyncStream::_connect()
+{
+	if (!this->_running)
+	{
+		this->_finish();
+		return;
+	}
+
+	this->_connected = 0;
+	this->_write_queue.clear();
+	delete this->_ws;
+	this->_ws = new websocket::stream<beast::ssl_stream<tcp::socket>>{ this->_ioc, this->_ssl_context };
+	SSL_set_tlsext_host_name(this->_ws->next_layer().native_handle(), this->_host.c_str()); // SNI
+
+	this->_resolver.async_resolve(this->_host, this->_port,
+		beast::bind_front_handler(&AsyncStream::_on_resolve, this->shared_from_this()));
+}
+
+void AsyncStream::_on_resolve(beast::error_code ec, tcp::resolver::results_type results)
+{
+	if (ec) return this->_fail();
+
+	net::async_connect(beast::get_lowest_layer(*this->_ws), results,
+		beast::bind_front_handler(&AsyncStream::_on_connect, this->shared_from_this()));
+}
+
+void AsyncStream::_on_connect(beast::error_code ec, tcp::resolver::results_type::endpoint_type endpoint)
+{
+	if (ec) return this->_fail();
+
+	this->_host += ':' + std::to_string(endpoint.port()); // for the websocket handshake
+	this->_ws->next_layer().async_handshake(ssl::stream_base::client,
+		beast::bind_front_handler(&AsyncStream::_on_ssl_handshake, this->shared_from_this()));
+}
+
+void AsyncStream::_on_ssl_handshake(beast::error_code ec)
+{
+	if (ec)
+	{
+		this->_host.erase(this->_host.rfind(':'));
+		return this->_fail();
+	}
+
+	this->_ws->set_option(websocket::stream_base::timeout::suggested(beast::role_type::client));
+	this->_ws->async_handshake(this->_host, this->_path,
+		beast::bind_front_handler(&AsyncStream::_on_handshake, this->shared_from_this()));
+	this->_host.erase(this->_host.rfind(':'));
+}
+
+void AsyncStream::_on_handshake(beast::error_code ec)
+{
+	if (ec) return this->_fail();
+
+	if (!this->_open_reported)
+	{
+		this->_open_reported = 1;
+		this->_opened.set_value(1);
+	}
+
+	this->_read_buffer.consume(this->_read_buffer.size());
+	this->_receive_buffer.prepare(this->_buffer);
+	if (this->_gzip_conversion)
+	{
+		this->_awaiting_conversion = 1;
+		this->_write_queue.push_front("{\"method\":\"BINARY\", \"params\":[\"false\"], \"id\":1}");
+	}
+	if (this->_on_open) this->_on_open();
+
+	this->_connected = 1;
+	if (!this->_write_queue.empty()) this->_write();
+	this->_read();
+}
+
+/**
+	Write the first queued message - one write at a time
+*/
+void AsyncStream::_write()
+{
+	std::shared_ptr<AsyncStream> self = this->shared_from_this();
+	websocket::stream<beast::ssl_stream<tcp::socket>>* ws = this->_ws;
+
+	this->_ws->async_write(net::buffer(this->_write_queue.front()),
+		[self, ws](beast::error_code ec, size_t)
+		{
+			if (ws != self->_ws || ec) return; // a broken connection is reported by the pending read
+
+			self->_write_queue.pop_front();
+			if (!self->_write_queue.empty() && !self->_closing) self->_write();
+		});
+}
+
+/**
+	Read the next message into the buffer
+*/
+void AsyncStream::_read()
+{
+	this->_ws->async_read(this->_read_buffer,
+		beast::bind_front_handler(&AsyncStream::_on_read, this->shared_from_this()));
+}
+
+void AsyncStream::_on_read(beast::error_code ec, size_t /*bytes_transferred*/)
+{
+	if (this->_closing) return; // finished by the close handler
+	if (ec) return this->_fail();
+
+	if (this->_awaiting_conversion)
+	{
+		this->_awaiting_conversion = (this->_buffer != "{\"id\":1}");
+		this->_read_buffer.consume(this->_read_buffer.size());
+		return this->_read();
+	}
+
+	try
+	{
+		if (this->_latency)
+		{
+			const std::chrono::steady_clock::time_point received = std::chrono::steady_clock::now();
+			this->_latency->record_receive(this->_buffer);
+			this->_receive_buffer.pad(this->_buffer);
+
+			const std::chrono::steady_clock::time_point callback_start = std::chrono::steady_clock::now();
+			this->_on_message(this->_buffer);
+			this->_latency->record_callback(received, callback_start, std::chrono::steady_clock::now());
+		}
+		else
+		{
+			this->_receive_buffer.pad(this->_buffer);
+			this->_on_message(this->_buffer);
+		}
+		this->_read_buffer.consume(this->_read_buffer.size());
+		this->_receive_buffer.recycle(this->_buffer);
+	}
+	catch (...)
+	{
+		if (this->_reconnect_on_error && this->_reconnect_attempts < this->_max_reconnect_count) return this->_fail();
+
+		this->_running = 0;
+		return this->_close(websocket::close_code::bad_payload);
+	}
+
+	if (!this->_running) return this->_close(websocket::close_code::normal); // closed by the callback
+	this->_read();
+}
+
+/**
+	Close the connection (on the thread of the context)
+	@param code - the close code sent to the server
+*/
+void AsyncStream::_close(const websocket::close_code code)
+{
+	if (this->_finished || this->_closing) return;
+
+	if (this->_ws && this->_ws->is_open())
+	{
+		this->_closing = 1;
+		std::shared_ptr<AsyncStream> self = this->shared_from_this();
+		this->_ws->async_close(code, [self](beast::error_code) { self->_finish(); });
+	}
+	else // connecting - the pending operation fails and finishes the stream
+	{
+		this->_resolver.cancel();
+		this->_reconnect_timer.cancel();
+		if (this->_ws) beast::get_lowest_layer(*this->_ws).close();
+	}
+}
+
+/**
+	Handle a broken connection - reconnect, or finish the stream
+*/
+void AsyncStream::_fail()
+{
+	if (this->_finished || this->_closing) return;
+
+	if (this->_running && this->_open_reported && this->_reconnect_on_error && this->_reconnect_attempts < this->_max_reconnect_count)
+	{
+		this->_reconnect_attempts++;
+		this->_awaiting_conversion = 0;
+
+		std::shared_ptr<AsyncStream> self = this->shared_from_this();
+		this->_reconnect_timer.expires_after(std::chrono::milliseconds(std::min(200u * this->_reconnect_attempts, 5000u))); // back off while the server is unreachable
+		this->_reconnect_timer.async_wait([self](beast::error_code) { self->_connect(); });
+		return;
+	}
+
+	this->_finish();
+}
+
+/**
+	The stream is done - report it once
+*/
+void AsyncStream::_finish()
+{
+	if (this->_finished) return;
+	this->_finished = 1;
+	this->_running = 0;
+
+	if (!this->_open_reported)
+	{
+		this->_open_reported = 1;
+		this->_opened.set_value(0);
+	}
+	if (this->_on_close) this->_on_close(this);
+}
+
+/**
+	Destructor
+*/
+AsyncStream::~AsyncStream()
+{
+	delete this->_ws;
+}
+
+//  ------------------------------ End | AsyncStream methods
+
+
+//  ------------------------------ Start | StreamConnection methods
+
+/**
+	Constructor - called by 'WebsocketClient::open_connection()'
+	@param context_pool - the pool, a context is assigned to the connection
+	@param host - the host of the path
+	@param port - the port of the path
+	@param gzip_conversion - request binary messages when connected (options)
+	@param reconnect_on_error - reconnect (and subscribe again) if the connection is broken
+	@param max_reconnect_count - max number of attempts to reconnect
+*/
+StreamConnection::StreamConnection(WebsocketContextPool* context_pool, const std::string& host, const std::string& port,
+	const bool gzip_conversion, const bool reconnect_on_error, const unsigned int max_reconnect_count)
+	: _buffer{}, _next_request_id{ 2 }, _closed{ 1 }, _dispatching{ nullptr }, _dispatch_thread{}, _dispatch_waiters{ 0 } // id 1 is taken by the BINARY request of options streams
+{
+	this->_async_stream = std::make_shared<AsyncStream>(context_pool, host, port, "/stream", this->_buffer,
+		[this](std::string& message) { this->_on_message(message); },
+		[this](AsyncStream*) { this->_on_close(); },
+		gzip_conversion, reconnect_on_error, max_reconnect_count);
+	this->_async_stream->set_on_open([this]() { this->_on_open(); });
+}
+
+/**
+	Connect, and wait until the connection is open
+*/
+void StreamConnection::open()
+{
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	this->_closed = 0;
+	connection_lock.unlock();
+
+	if (!this->_async_stream->start().get())
+	{
+		BadStreamOpenWS e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+}
+
+/**
+	Close the connection - returns immediately
+*/
+void StreamConnection::close()
+{
+	this->_async_stream->close();
+}
+
+/**
+	Checks whether the connection is open (or reconnecting)
+	@return a bool for whether is open or not
+*/
+bool StreamConnection::is_open() const
+{
+	return this->_async_stream->is_running();
+}
+
+/**
+	Subscribe to streams, with one handler
+	the handler is set before the request is sent, so no message is missed
+	@param stream_names - names of the streams (i.e: btcusdt@aggTrade)
+	@param handler - called with each message of the streams
+	@return a future of whether the server accepted the request - false if the connection is closed first
+*/
+std::future<bool> StreamConnection::_subscribe(const std::vector<std::string>& stream_names, std::function<void(std::string&)> handler)
+{
+	std::shared_ptr<std::function<void(std::string&)>> shared_handler = std::make_shared<std::function<void(std::string&)>>(std::move(handler));
+	std::string request{};
+	std::future<bool> reply{};
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	if (this->_closed)
+	{
+		std::promise<bool> rejected{};
+		rejected.set_value(0);
+		return rejected.get_future();
+	}
+
+	for (const std::string& stream_name : stream_names)
+	{
+		this->_handlers[stream_name] = shared_handler;
+	}
+	unsigned int request_id = this->_new_request("SUBSCRIBE", stream_names, request);
+	reply = this->_pending_requests[request_id].back().get_future();
+	connection_lock.unlock();
+
+	this->_async_stream->send(std::move(request));
+	return reply;
+}
+
+/**
+	Unsubscribe from a stream - waits for its handler if it is being called, so it is not called after this returns
+	(called from the handler itself, the handler may return to a message of the stream)
+	@param stream_name - name of the stream
+	@return a future of whether the server accepted the request - false if the connection is closed first
+*/
+std::future<bool> StreamConnection::unsubscribe(const std::string& stream_name)
+{
+	return this->unsubscribe(std::vector<std::string>{ stream_name });
+}
+
+/**
+	Unsubscribe from streams - waits for their handlers if being called, so they are not called after this returns
+	(called from a handler itself, the handler may return to a message of the streams)
+	@param stream_names - names of the streams
+	@return a future of whether the server accepted the request - false if the connection is closed first
+*/
+std::future<bool> StreamConnection::unsubscribe(const std::vector<std::string>& stream_names)
+{
+	std::string request{};
+	std::future<bool> reply{};
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	if (this->_closed)
+	{
+		std::promise<bool> rejected{};
+		rejected.set_value(0);
+		return rejected.get_future();
+	}
+
+	std::vector<const std::function<void(std::string&)>*> removed_handlers;
+	for (const std::string& stream_name : stream_names)
+	{
+		std::unordered_map<std::string, std::shared_ptr<std::function<void(std::string&)>>>::iterator handler_itr = this->_handlers.find(stream_name);
+		if (handler_itr == this->_handlers.end()) continue;
+
+		removed_handlers.push_back(handler_itr->second.get());
+		this->_handlers.erase(handler_itr);
+	}
+	unsigned int request_id = this->_new_request("UNSUBSCRIBE", stream_names, request);
+	reply = this->_pending_requests[request_id].back().get_future();
+
+	if (this->_dispatch_thread != std::this_thread::get_id()) // from a handler, the dispatch in flight is the caller
+	{
+		this->_dispatch_waiters++;
+		this->_dispatch_done.wait(connection_lock, [this, &removed_handlers]()
+			{
+				return std::find(removed_handlers.begin(), removed_handlers.end(), this->_dispatching) == removed_handlers.end();
+			});
+		this->_dispatch_waiters--;
+	}
+	connection_lock.unlock();
+
+	this->_async_stream->send(std::move(request));
+	return reply;
+}
+
+/**
+	Get the subscribed streams
+	@return a vector containing the names of the streams
+*/
+std::vector<std::string> StreamConnection::streams()
+{
+	std::vector<std::string> results;
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	results.reserve(this->_handlers.size());
+	for (const std::pair<const std::string, std::shared_ptr<std::function<void(std::string&)>>>& handler : this->_handlers)
+	{
+		results.push_back(handler.first);
+	}
+
+	return results;
+}
+
+/**
+	Build a request and add a pending reply for it - '_connection_lock' must be held
+	@param method - SUBSCRIBE / UNSUBSCRIBE
+	@param stream_names - the params of the request
+	@param request - a reference of the string to build the request into
+	@return the id of the request
+*/
+unsigned int StreamConnection::_new_request(const char* method, const std::vector<std::string>& stream_names, std::string& request)
+{
+	unsigned int request_id = this->_next_request_id++;
+
+	request.append("{\"method\":\"").append(method).append("\",\"params\":[");
+	for (size_t i = 0; i < stream_names.size(); i++)
+	{
+		if (i) request.push_back(',');
+		request.append(1, '"').append(stream_names[i]).append(1, '"');
+	}
+	request.append("],\"id\":").append(std::to_string(request_id)).append(1, '}');
+
+	this->_pending_requests[request_id].emplace_back();
+	return request_id;
+}
+
+/**
+	Called after each handshake - subscribes to all streams again after a reconnect
+	replies pending from the broken connection are given by the reply to the new request
+*/
+void StreamConnection::_on_open()
+{
+	std::string request{};
+	std::vector<std::string> stream_names;
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	if (this->_handlers.empty()) return;
+
+	stream_names.reserve(this->_handlers.size());
+	for (const std::pair<const std::string, std::shared_ptr<std::function<void(std::string&)>>>& handler : this->_handlers)
+	{
+		stream_names.push_back(handler.first);
+	}
+
+	unsigned int request_id = this->_new_request("SUBSCRIBE", stream_names, request);
+	std::vector<std::promise<bool>>& resubscribe_replies = this->_pending_requests[request_id];
+	for (std::pair<const unsigned int, std::vector<std::promise<bool>>>& pending_request : this->_pending_requests)
+	{
+		if (pending_request.first == request_id) continue;
+		for (std::promise<bool>& reply : pending_request.second)
+		{
+			resubscribe_replies.push_back(std::move(reply));
+		}
+	}
+	std::vector<std::promise<bool>> replies = std::move(resubscribe_replies);
+	this->_pending_requests.clear();
+	this->_pending_requests[request_id] = std::move(replies);
+	connection_lock.unlock();
+
+	this->_async_stream->queue_message(std::move(request)); // on the thread of the context - sent before other messages
+}
+
+/**
+	Dispatch a message to the handler of its stream ({"stream":"<name>","data":{...}}), or handle a reply
+	@param message - the message
+*/
+void StreamConnection::_on_message(std::string& message)
+{
+	std::string_view stream_name;
+	std::string_view data;
+
+	if (!StreamMultiplexer::split(message, stream_name, data)) return this->_on_reply(message);
+	this->_stream_name.assign(stream_name); // keeps its capacity
+
+	std::shared_ptr<std::function<void(std::string&)>> handler{};
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	std::unordered_map<std::string, std::shared_ptr<std::function<void(std::string&)>>>::iterator handler_itr = this->_handlers.find(this->_stream_name);
+	if (handler_itr == this->_handlers.end()) return;
+
+	handler = handler_itr->second;
+	this->_dispatching = handler.get(); // waited for by 'unsubscribe()'
+	this->_dispatch_thread = std::this_thread::get_id();
+	connection_lock.unlock();
+
+	try
+	{
+		(*handler)(message); // not under the lock - handlers may subscribe / unsubscribe
+	}
+	catch (...)
+	{
+		this->_end_dispatch();
+		throw;
+	}
+	this->_end_dispatch();
+}
+
+/**
+	Mark the handler called by '_on_message()' as returned, and wake up unsubscribes waiting for it
+*/
+void StreamConnection::_end_dispatch()
+{
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	this->_dispatching = nullptr;
+	this->_dispatch_thread = std::thread::id{};
+	bool waited_for = this->_dispatch_waiters;
+	connection_lock.unlock();
+
+	if (waited_for) this->_dispatch_done.notify_all();
+}
+
+/**
+	Handle a reply to a request ({"result":null,"id":<id>}, or {"error":{...},"id":<id>})
+	@param message - the message
+*/
+void StreamConnection::_on_reply(std::string& message)
+{
+	simdjson::dom::element reply;
+	uint64_t request_id;
+
+	if (this->_reply_parser.parse(message).get(reply)) return;
+	if (reply["id"].get(request_id)) return;
+	bool accepted = (reply["error"].error() == simdjson::NO_SUCH_FIELD);
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	std::unordered_map<unsigned int, std::vector<std::promise<bool>>>::iterator request_itr = this->_pending_requests.find(static_cast<unsigned int>(request_id));
+	if (request_itr == this->_pending_requests.end()) return;
+
+	for (std::promise<bool>& pending_reply : request_itr->second)
+	{
+		pending_reply.set_value(accepted);
+	}
+	this->_pending_requests.erase(request_itr);
+}
+
+/**
+	Called once when the connection is done - pending replies are rejected
+*/
+void StreamConnection::_on_close()
+{
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	this->_closed = 1;
+
+	for (std::pair<const unsigned int, std::vector<std::promise<bool>>>& pending_request : this->_pending_requests)
+	{
+		for (std::promise<bool>& pending_reply : pending_request.second)
+		{
+			pending_reply.set_value(0);
+		}
+	}
+	this->_pending_requests.clear();
+	this->_connection_closed.notify_all();
+}
+
+/**
+	Destructor
+	closes the connection, and waits for it to close
+*/
+StreamConnection::~StreamConnection()
+{
+	this->close();
+
+	std::unique_lock<std::mutex> connection_lock{ this->_connection_lock };
+	this->_connection_closed.wait(connection_lock, [this]() { return this->_closed; });
+}
+
+//  ------------------------------ End | StreamConnection methods
+
+
+//  ------------------------------ Start | StreamMultiplexer methods
+
+/**
+	Constructor
+	@param capacity - expected number of streams, the table grows if needed
+*/
+StreamMultiplexer::StreamMultiplexer(const size_t capacity)
+	: _size{ 0 }, _unrouted{ 0 }
+{
+	size_t slot_count = 8;
+	while (slot_count < capacity * 2) slot_count *= 2; // load factor of up to 0.5
+	this->_slots.resize(slot_count);
+}
+
+/**
+	Set the handler of a stream - replaces the current one
+	@param stream_name - name of the stream, as in the messages (i.e: btcusdt@aggTrade)
+	@param handler - called with a view of the payload ("data") of each message - valid only during the call
+*/
+void StreamMultiplexer::set_handler(const std::string& stream_name, std::function<void(std::string_view)> handler)
+{
+	uint64_t hash = StreamMultiplexer::_hash(stream_name);
+	Slot* slot = this->_find(stream_name, hash);
+
+	if (!slot->hash)
+	{
+		if ((this->_size + 1) * 2 > this->_slots.size())
+		{
+			this->_grow();
+			slot = this->_find(stream_name, hash);
+		}
+		slot->hash = hash;
+		slot->stream_name = stream_name;
+		this->_size++;
+	}
+	slot->handler = std::move(handler);
+}
+
+/**
+	Remove the handler of a stream
+	@param stream_name - name of the stream
+	@return - bool for success
+*/
+bool StreamMultiplexer::remove_handler(const std::string& stream_name)
+{
+	Slot* slot = this->_find(stream_name, StreamMultiplexer::_hash(stream_name));
+	if (!slot->hash) return 0;
+
+	// backward shift deletion - moves back the following slots of the probe sequence, no tombstones
+	size_t mask = this->_slots.size() - 1;
+	size_t empty_index = slot - this->_slots.data();
+	size_t index = (empty_index + 1) & mask;
+	while (this->_slots[index].hash)
+	{
+		size_t home_index = this->_slots[index].hash & mask;
+		if (((index - home_index) & mask) >= ((index - empty_index) & mask)) // the slot may move back to the empty one
+		{
+			this->_slots[empty_index] = std::move(this->_slots[index]);
+			empty_index = index;
+		}
+		index = (index + 1) & mask;
+	}
+	this->_slots[empty_index] = Slot{};
+	this->_size--;
+
+	return 1;
+}
+
+/**
+	Get the number of streams with handlers
+	@return the number of streams
+*/
+size_t StreamMultiplexer::size() const
+{
+	return this->_size;
+}
+
+/**
+	Get the number of messages that were not routed
+	@return the number of messages
+*/
+size_t StreamMultiplexer::unrouted() const
+{
+	return this->_unrouted;
+}
+
+/**
+	Route a message to the handler of its stream
+	@param message - the message of a combined stream
+	@return a bool for whether a handler was called
+*/
+bool StreamMultiplexer::dispatch(std::string_view message)
+{
+	std::string_view stream_name;
+	std::string_view data;
+
+	if (StreamMultiplexer::split(message, stream_name, data))
+	{
+		Slot* slot = this->_find(stream_name, StreamMultiplexer::_hash(stream_name));
+		if (slot->hash && slot->handler)
+		{
+			slot->handler(data);
+			return 1;
+		}
+	}
+
+	this->_unrouted++;
+	return 0;
+}
+
+/**
+	Stream callback - routes the message, for use as the functor of a stream
+	@param message - the buffer of the stream
+*/
+void StreamMultiplexer::operator()(std::string& message)
+{
+	this->dispatch(message);
+}
+
+/**
+	Peek the name of the stream and the payload of a message, without parsing it
+	@param message - the message ({"stream":"<name>","data":<payload>})
+	@param stream_name - a reference of the view to set to the name
+	@param data - a reference of the view to set to the payload
+	@return a bool for whether the message is of a combined stream
+*/
+bool StreamMultiplexer::split(std::string_view message, std::string_view& stream_name, std::string_view& data)
+{
+	static const std::string_view stream_prefix{ "{\"stream\":\"" };
+	static const std::string_view data_prefix{ "\",\"data\":" };
+
+	if (message.substr(0, stream_prefix.size()) != stream_prefix) return 0;
+
+	size_t name_end = message.find('"', stream_prefix.size());
+	if (name_end == std::string_view::npos || message.substr(name_end, data_prefix.size()) != data_prefix) return 0;
+
+	size_t data_start = name_end + data_prefix.size();
+	size_t data_end = message.find_last_of('}'); // closes the message
+	if (data_end == std::string_view::npos || data_end <= data_start) return 0;
+
+	stream_name = message.substr(stream_prefix.size(), name_end - stream_prefix.size());
+	data = message.substr(data_start, data_end - data_start);
+	return 1;
+}
+
+/**
+	Hash a stream name - FNV-1a
+	@param stream_name - the name
+	@return the hash, never 0 (marks empty slots)
+*/
+uint64_t StreamMultiplexer::_hash(std::string_view stream_name)
+{
+	uint64_t hash = 14695981039346656037ull;
+	for (const char c : stream_name)
+	{
+		hash ^= static_cast<unsigned char>(c);
+		hash *= 1099511628211ull;
+	}
+	return hash ? hash : 1;
+}
+
+/**
+	Find the slot of a stream
+	@param stream_name - the name
+	@param hash - the hash of the name
+	@return the slot of the stream, or the empty slot where it would be set
+*/
+StreamMultiplexer::Slot* StreamMultiplexer::_find(std::string_view stream_name, const uint64_t hash)
+{
+	size_t mask = this->_slots.size() - 1;
+	size_t index = hash & mask;
+
+	while (this->_slots[index].hash)
+	{
+		if (this->_slots[index].hash == hash && this->_slots[index].stream_name == stream_name) break;
+		index = (index + 1) & mask;
+	}
+	return &this->_slots[index];
+}
+
+/**
+	Double the size of the table
+*/
+void StreamMultiplexer::_grow()
+{
+	std::vector<Slot> old_slots(this->_slots.size() * 2);
+	old_slots.swap(this->_slots);
+
+	for (Slot& old_slot : old_slots)
+	{
+		if (!old_slot.hash) continue;
+		*this->_find(old_slot.stream_name, old_slot.hash) = std::move(old_slot);
+	}
+}
+
+//  ------------------------------ End | StreamMultiplexer methods
+
+
+//  ------------------------------ Start | StreamQueue methods
+
+/**
+	Constructor
+	@param capacity - max number of queued messages, rounded up to a power of 2
+	@param policy - what the stream does when the queue is full
+*/
+StreamQueue::StreamQueue(const size_t capacity, const QueueOverflowPolicy policy)
+	: _slots{ nullptr }, _capacity{ 2 }, _policy{ policy },
+	_head{ 0 }, _tail{ 0 }, _dropped{ 0 }, _conflated{ 0 }, _pending_index{ 0 },
+	_conflating{ 0 }, _consumer_waiting{ 0 }, _producer_waiting{ 0 }, _closed{ 0 }
+{
+	while (this->_capacity < capacity) this->_capacity *= 2;
+	this->_slots = new Slot[this->_capacity];
+	for (size_t i = 0; i < this->_capacity; i++)
+	{
+		this->_slots[i].sequence.store(i, std::memory_order_relaxed);
+	}
+}
+
+/**
+	Queue a message (producer) - with the 'block' policy, waits while the queue is full
+	@param message - the message, copied into the queue
+	@return a bool for whether the message was queued (false once closed)
+*/
+bool StreamQueue::push(std::string_view message)
+{
+	if (this->_closed.load(std::memory_order_relaxed)) return 0;
+
+	if (this->_conflating.load(std::memory_order_acquire)) // keeps the order of messages of a key while conflating
+	{
+		this->_conflate(message);
+		this->_notify(this->_consumer_cv, this->_consumer_waiting);
+		return 1;
+	}
+
+	while (!this->_try_push(message))
+	{
+		if (this->_policy == QueueOverflowPolicy::drop_oldest)
+		{
+			if (!this->_drop_oldest()) std::this_thread::yield(); // the oldest is being read by the consumer
+		}
+		else if (this->_policy == QueueOverflowPolicy::conflate)
+		{
+			this->_conflate(message);
+			break;
+		}
+		else
+		{
+			std::unique_lock<std::mutex> wait_lock{ this->_wait_lock };
+			this->_producer_waiting = 1;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			this->_producer_cv.wait(wait_lock, [this]()
+				{
+					size_t tail = this->_tail.load(std::memory_order_relaxed);
+					return this->_slots[tail & (this->_capacity - 1)].sequence.load(std::memory_order_acquire) == tail || this->_closed;
+				});
+			this->_producer_waiting = 0;
+			if (this->_closed) return 0;
+		}
+	}
+
+	this->_notify(this->_consumer_cv, this->_consumer_waiting);
+	return 1;
+}
+
+/**
+	The functor of a stream - queues each message
+	@param message - the message
+*/
+void StreamQueue::operator()(std::string& message)
+{
+	this->push(message);
+}
+
+/**
+	Close the queue - new messages are not queued, and waiting threads are woken up
+*/
+void StreamQueue::close()
+{
+	this->_closed = 1;
+
+	std::unique_lock<std::mutex> wait_lock{ this->_wait_lock };
+	this->_consumer_cv.notify_all();
+	this->_producer_cv.notify_all();
+}
+
+/**
+	@return a bool for whether the queue is closed
+*/
+bool StreamQueue::closed() const
+{
+	return this->_closed;
+}
+
+/**
+	@return the number of messages in the ring (approximate while in use)
+*/
+size_t StreamQueue::size() const
+{
+	size_t head = this->_head.load(std::memory_order_acquire);
+	size_t tail = this->_tail.load(std::memory_order_acquire);
+	return tail > head ? tail - head : 0;
+}
+
+/**
+	@return max number of messages in the ring
+*/
+size_t StreamQueue::capacity() const
+{
+	return this->_capacity;
+}
+
+/**
+	@return the number of messages dropped by the 'drop_oldest' policy
+*/
+size_t StreamQueue::dropped() const
+{
+	return this->_dropped;
+}
+
+/**
+	@return the number of messages replaced by a newer message of their key ('conflate' policy)
+*/
+size_t StreamQueue::conflated() const
+{
+	return this->_conflated;
+}
+
+/**
+	Write a message to the slot of the tail (producer)
+	@param message - the message
+	@return a bool for whether there was room
+*/
+bool StreamQueue::_try_push(std::string_view message)
+{
+	size_t tail = this->_tail.load(std::memory_order_relaxed);
+	Slot& slot = this->_slots[tail & (this->_capacity - 1)];
+	if (slot.sequence.load(std::memory_order_acquire) != tail) return 0; // full (or the oldest is being read)
+
+	slot.message.assign(message.data(), message.size()); // keeps the capacity of the slot
+	slot.sequence.store(tail + 1, std::memory_order_release);
+	this->_tail.store(tail + 1, std::memory_order_release);
+	return 1;
+}
+
+/**
+	Drop the oldest message (producer)
+	@return a bool for whether a message was dropped - false if the consumer is reading it
+*/
+bool StreamQueue::_drop_oldest()
+{
+	size_t head = this->_head.load(std::memory_order_acquire);
+	Slot& slot = this->_slots[head & (this->_capacity - 1)];
+	if (slot.sequence.load(std::memory_order_acquire) != head + 1) return 0;
+	if (!this->_head.compare_exchange_strong(head, head + 1, std::memory_order_acq_rel)) return 0;
+
+	slot.sequence.store(head + this->_capacity, std::memory_order_release);
+	this->_dropped.fetch_add(1, std::memory_order_relaxed);
+	return 1;
+}
+
+/**
+	Keep a message as the latest of its key, until the consumer takes the conflated messages (producer)
+	@param message - the message
+*/
+void StreamQueue::_conflate(std::string_view message)
+{
+	std::unique_lock<std::mutex> overflow_lock{ this->_overflow_lock };
+
+	std::string_view key = StreamQueue::_key(message);
+	std::unordered_map<std::string, size_t>::iterator key_itr = this->_conflated_keys.find(std::string(key));
+	if (key_itr != this->_conflated_keys.end())
+	{
+		this->_conflated_messages[key_itr->second].assign(message.data(), message.size());
+		this->_conflated.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		this->_conflated_keys.emplace(std::string(key), this->_conflated_messages.size());
+		this->_conflated_messages.emplace_back(message);
+	}
+
+	this->_conflating.store(1, std::memory_order_release);
+}
+
+/**
+	Take the next message into '_consumer_buffer' (consumer) -
+	conflated messages taken before are consumed first, then the ring, then newly conflated messages
+	@return a bool for whether there was a message
+*/
+bool StreamQueue::_try_pop()
+{
+	if (this->_pending_index < this->_pending.size())
+	{
+		this->_consumer_buffer.swap(this->_pending[this->_pending_index++]);
+		return 1;
+	}
+
+	while (1)
+	{
+		size_t head = this->_head.load(std::memory_order_acquire);
+		Slot& slot = this->_slots[head & (this->_capacity - 1)];
+		size_t sequence = slot.sequence.load(std::memory_order_acquire);
+
+		if (sequence == head) // the ring is empty
+		{
+			if (this->_take_conflated()) return this->_try_pop();
+			if (!this->_conflating.load(std::memory_order_acquire)) return 0;
+			continue; // the ring was written to before the producer started conflating
+		}
+		if (sequence != head + 1) continue; // dropped by the producer meanwhile
+		if (!this->_head.compare_exchange_weak(head, head + 1, std::memory_order_acq_rel)) continue;
+
+		this->_consumer_buffer.assign(slot.message); // the slot is released before the functor is called
+		slot.sequence.store(head + this->_capacity, std::memory_order_release);
+		if (this->_policy == QueueOverflowPolicy::block) this->_notify(this->_producer_cv, this->_producer_waiting);
+		return 1;
+	}
+}
+
+/**
+	Take the conflated messages (consumer), once the ring is empty - the producer writes to the ring again after that
+	@return a bool for whether conflated messages were taken
+*/
+bool StreamQueue::_take_conflated()
+{
+	if (!this->_conflating.load(std::memory_order_acquire)) return 0;
+
+	std::unique_lock<std::mutex> overflow_lock{ this->_overflow_lock };
+	size_t head = this->_head.load(std::memory_order_acquire);
+	if (this->_slots[head & (this->_capacity - 1)].sequence.load(std::memory_order_acquire) != head) return 0; // older messages are in the ring
+
+	this->_pending.swap(this->_conflated_messages);
+	this->_conflated_messages.clear();
+	this->_conflated_keys.clear();
+	this->_pending_index = 0;
+	this->_conflating.store(0, std::memory_order_release);
+
+	return !this->_pending.empty();
+}
+
+/**
+	@return a bool for whether a message can be consumed
+*/
+bool StreamQueue::_ready() const
+{
+	size_t head = this->_head.load(std::memory_order_acquire);
+	return this->_pending_index < this->_pending.size() || this->_conflating.load(std::memory_order_acquire) ||
+		this->_slots[head & (this->_capacity - 1)].sequence.load(std::memory_order_acquire) == head + 1;
+}
+
+/**
+	Wake up the other side, if it is waiting
+	@param cv - the condition variable it waits on
+	@param waiting - its waiting flag
+*/
+void StreamQueue::_notify(std::condition_variable& cv, std::atomic<bool>& waiting)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!waiting.load(std::memory_order_relaxed)) return; // no lock while the other side is busy
+
+	std::unique_lock<std::mutex> wait_lock{ this->_wait_lock };
+	cv.notify_all();
+}
+
+/**
+	Get the key of a message for conflation
+	@param message - the message
+	@return the name of the stream for combined streams, else the symbol ("s"), else empty
+*/
+std::string_view StreamQueue::_key(std::string_view message)
+{
+	std::string_view stream_name;
+	std::string_view data;
+	if (StreamMultiplexer::split(message, stream_name, data)) return stream_name;
+
+	static const std::string_view symbol_prefix{ "\"s\":\"" };
+	size_t symbol_start = message.find(symbol_prefix);
+	if (symbol_start == std::string_view::npos) return std::string_view{};
+
+	symbol_start += symbol_prefix.size();
+	size_t symbol_end = message.find('"', symbol_start);
+	if (symbol_end == std::string_view::npos) return std::string_view{};
+
+	return message.substr(symbol_start, symbol_end - symbol_start);
+}
+
+StreamQueue::~StreamQueue()
+{
+	delete[] this->_slots;
+}
+
+//  ------------------------------ End | StreamQueue methods
+
 template class WebsocketClient<SpotClient>;
 template class WebsocketClient<FuturesClient<FuturesClientCoin>>;
 template class WebsocketClient<FuturesClient<FuturesClientUSDT>>;
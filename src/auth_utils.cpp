@@ -25,6 +25,70 @@ std::string binary_to_hex(unsigned char const* binary, unsigned binary_len)
 	return r;
 }
 
+/**
+	Convert binary to hex, into a buffer
+	@param hex_buffer - the buffer, of at least binary_len * 2 characters (not null terminated)
+*/
+void binary_to_hex(unsigned char const* binary, unsigned binary_len, char* hex_buffer)
+{
+	static const char hex_digits[] = "0123456789abcdef";
+	for (unsigned i = 0; i < binary_len; ++i) {
+		hex_buffer[i * 2] = hex_digits[binary[i] >> 4];
+		hex_buffer[i * 2 + 1] = hex_digits[binary[i] & 15];
+	}
+}
+
+/**
+	Percent-encode a value for a query string - all characters but letters, digits and '-', '_', '.', '~'
+	@param text - the value
+	@param encoded - the string to append the encoded value to
+*/
+void url_encode(std::string_view text, std::string& encoded)
+{
+	static const char hex_digits[] = "0123456789ABCDEF";
+	for (const char c : text)
+	{
+		if (std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || c == '.' || c == '~')
+		{
+			encoded.push_back(c);
+			continue;
+		}
+		encoded.push_back('%');
+		encoded.push_back(hex_digits[static_cast<unsigned char>(c) >> 4]);
+		encoded.push_back(hex_digits[static_cast<unsigned char>(c) & 15]);
+	}
+}
+
+/**
+	Decode a percent-encoded value of a query string - malformed sequences are kept as they are
+	@param text - the value
+	@param decoded - the string to set to the decoded value
+*/
+void url_decode(std::string_view text, std::string& decoded)
+{
+	auto hex_value = [](const char c) -> int
+	{
+		if (c >= '0' && c <= '9') return c - '0';
+		if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+		if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+		return -1;
+	};
+
+	decoded.clear();
+	for (size_t i = 0; i < text.size(); i++)
+	{
+		const int high = (text[i] == '%' && i + 2 < text.size()) ? hex_value(text[i + 1]) : -1;
+		const int low = (high >= 0) ? hex_value(text[i + 2]) : -1;
+		if (low < 0)
+		{
+			decoded.push_back(text[i]);
+			continue;
+		}
+		decoded.push_back(static_cast<char>(high * 16 + low));
+		i += 2;
+	}
+}
+
 /**
 	Generate an HMAC sha256 signature - as required by Binance
 */
@@ -36,3 +100,167 @@ std::string HMACsha256(std::string const& message, std::string const& secret)
 	std::string signature = binary_to_hex(result, result_len);
 	return signature;
 }
+
+/**
+	Write an endpoint with a version into a buffer (i.e: "/sapi/v" 2 "/futures/loan/wallet"), without allocating
+	@param buffer - the buffer
+	@param buffer_size - the size of the buffer
+	@param prefix - the endpoint up to the version
+	@param version - the version
+	@param suffix - the endpoint after the version
+	@return a view of the endpoint in the buffer - throws BadQuery if it does not fit
+*/
+std::string_view versioned_endpoint(char* buffer, const size_t buffer_size, std::string_view prefix, const unsigned int version, std::string_view suffix)
+{
+	char* const buffer_end = buffer + buffer_size;
+	if (prefix.size() > buffer_size)
+	{
+		BadQuery e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+	char* position = std::copy(prefix.begin(), prefix.end(), buffer);
+
+	const std::to_chars_result version_end = std::to_chars(position, buffer_end, version);
+	if (version_end.ec != std::errc{} || static_cast<size_t>(buffer_end - version_end.ptr) < suffix.size())
+	{
+		BadQuery e{};
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+	position = std::copy(suffix.begin(), suffix.end(), version_end.ptr);
+
+	return std::string_view{ buffer, static_cast<size_t>(position - buffer) };
+}
+
+struct _SigningContext
+	// a context per thread, the keyed states of the signer are copied into it
+{
+	EVP_MD_CTX* ctx;
+	_SigningContext() : ctx{ EVP_MD_CTX_new() } {}
+	~_SigningContext() { EVP_MD_CTX_free(ctx); }
+};
+
+/**
+	Constructor
+	hashes the padded key into the inner and outer states, as in the first block of HMAC
+	@param secret - the API secret
+*/
+HMACSigner::HMACSigner(const std::string& secret)
+	: _inner_ctx{ EVP_MD_CTX_new() }, _outer_ctx{ EVP_MD_CTX_new() }
+{
+	const EVP_MD* sha256 = EVP_sha256();
+	const unsigned int block_size = EVP_MD_block_size(sha256);
+
+	unsigned char key_block[EVP_MAX_MD_SIZE * 2]{}; // sha256 block size is 64
+	if (secret.size() > block_size)
+	{
+		unsigned int key_len{ 0 };
+		EVP_Digest(secret.data(), secret.size(), key_block, &key_len, sha256, nullptr);
+	}
+	else
+	{
+		std::copy(secret.begin(), secret.end(), key_block);
+	}
+
+	unsigned char inner_pad[EVP_MAX_MD_SIZE * 2];
+	unsigned char outer_pad[EVP_MAX_MD_SIZE * 2];
+	for (unsigned int i = 0; i < block_size; i++)
+	{
+		inner_pad[i] = key_block[i] ^ 0x36;
+		outer_pad[i] = key_block[i] ^ 0x5c;
+	}
+
+	if (!this->_inner_ctx || !this->_outer_ctx
+		|| !EVP_DigestInit_ex(this->_inner_ctx, sha256, nullptr) || !EVP_DigestUpdate(this->_inner_ctx, inner_pad, block_size)
+		|| !EVP_DigestInit_ex(this->_outer_ctx, sha256, nullptr) || !EVP_DigestUpdate(this->_outer_ctx, outer_pad, block_size))
+	{
+		EVP_MD_CTX_free(this->_inner_ctx);
+		EVP_MD_CTX_free(this->_outer_ctx);
+
+		CustomException e{ "bad_hmac_signer_setup" };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+	OPENSSL_cleanse(key_block, sizeof(key_block));
+	OPENSSL_cleanse(inner_pad, sizeof(inner_pad));
+	OPENSSL_cleanse(outer_pad, sizeof(outer_pad));
+}
+
+/**
+	Constructor - a signer of messages that start with a known prefix
+	the prefix is hashed once, so 'sign()' takes only the rest of the message
+	@param signer - the signer of the key
+	@param message_prefix - the start of all messages
+*/
+HMACSigner::HMACSigner(const HMACSigner& signer, std::string_view message_prefix)
+	: _inner_ctx{ EVP_MD_CTX_new() }, _outer_ctx{ EVP_MD_CTX_new() }
+{
+	if (!this->_inner_ctx || !this->_outer_ctx
+		|| !EVP_MD_CTX_copy_ex(this->_inner_ctx, signer._inner_ctx) || !EVP_MD_CTX_copy_ex(this->_outer_ctx, signer._outer_ctx)
+		|| !EVP_DigestUpdate(this->_inner_ctx, message_prefix.data(), message_prefix.size()))
+	{
+		EVP_MD_CTX_free(this->_inner_ctx);
+		EVP_MD_CTX_free(this->_outer_ctx);
+
+		CustomException e{ "bad_hmac_signer_setup" };
+		e.append_to_traceback(std::string(__FUNCTION__));
+		throw(e);
+	}
+}
+
+/**
+	Move constructor
+*/
+HMACSigner::HMACSigner(HMACSigner&& signer) noexcept
+	: _inner_ctx{ signer._inner_ctx }, _outer_ctx{ signer._outer_ctx }
+{
+	signer._inner_ctx = nullptr;
+	signer._outer_ctx = nullptr;
+}
+
+/**
+	Sign a message
+	thread safe - the keyed states are only read
+	@param message - the message (query)
+	@param signature_buffer - a buffer of at least SIGNATURE_SIZE characters, the hex signature is written to (not null terminated)
+*/
+void HMACSigner::sign(std::string_view message, char* signature_buffer) const
+{
+	static thread_local _SigningContext signing_ctx{};
+
+	unsigned char digest[EVP_MAX_MD_SIZE];
+	unsigned int digest_len{ 0 };
+
+	EVP_MD_CTX_copy_ex(signing_ctx.ctx, this->_inner_ctx);
+	EVP_DigestUpdate(signing_ctx.ctx, message.data(), message.size());
+	EVP_DigestFinal_ex(signing_ctx.ctx, digest, &digest_len);
+
+	EVP_MD_CTX_copy_ex(signing_ctx.ctx, this->_outer_ctx);
+	EVP_DigestUpdate(signing_ctx.ctx, digest, digest_len);
+	EVP_DigestFinal_ex(signing_ctx.ctx, digest, &digest_len);
+
+	binary_to_hex(digest, digest_len, signature_buffer);
+}
+
+/**
+	Sign a message
+	@param message - the message (query)
+	@return the hex signature
+*/
+std::string HMACSigner::sign(std::string_view message) const
+{
+	std::string signature(HMACSigner::SIGNATURE_SIZE, '\0');
+	this->sign(message, signature.data());
+
+	return signature;
+}
+
+/**
+	Destructor
+*/
+HMACSigner::~HMACSigner()
+{
+	EVP_MD_CTX_free(this->_inner_ctx);
+	EVP_MD_CTX_free(this->_outer_ctx);
+}
@@ -40,6 +40,10 @@ BadSetupHeadersREST::BadSetupHeadersREST()
 	: ClientException("bad_rest_client_headers_setup")
 {};
 
+RateLimitExceeded::RateLimitExceeded()
+	: ClientException("rest_client_rate_limit_exceeded")
+{};
+
 //  ------------------------------ WS Client Exceptions
 
 BadStreamOpenWS::BadStreamOpenWS()
@@ -72,6 +76,10 @@ MissingEndpoint::MissingEndpoint()
 	: ClientException("missing_exchange_client_method_endpoint")
 {};
 
+OrderRejected::OrderRejected(const std::string& rejection_reason)
+	: ClientException("order_rejected_" + rejection_reason), reason{ rejection_reason }
+{};
+
 //  ------------------------------ Custom Client Exception
 
 CustomException::CustomException(const std::string error_msg)